@@ -33,7 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Eigen/Core>
 
 // STL
+#include <memory>
 #include <string>
+#include <vector>
 
 // CppAD
 #include <cppad/cg.hpp>
@@ -56,6 +58,26 @@ class CppAdInterface {
   using ad_parameterized_function_t = std::function<void(const ad_vector_t&, const ad_vector_t&, ad_vector_t&)>;
   using ad_fun_t = CppAD::ADFun<ad_base_t>;
 
+  /**
+   * Preallocated memory for the evaluation methods that take a workspace. The results are written into the workspace and
+   * remain valid until the next call with the same workspace. Since only the structural nonzeros of the Jacobian and
+   * the Hessian are written, a workspace should not be modified by the user. A workspace must not be shared between threads.
+   */
+  struct Workspace {
+    vector_t functionValue;
+    matrix_t jacobian;
+    matrix_t hessian;
+    ScalarFunctionQuadraticApproximation gaussNewtonApproximation;
+
+    // internal buffers
+    vector_t xp;
+    vector_t weights;
+    std::vector<scalar_t> sparseValues;
+    const CppAdInterface* jacobianOwner = nullptr;
+    const CppAdInterface* hessianOwner = nullptr;
+    const CppAdInterface* gaussNewtonOwner = nullptr;
+  };
+
   /**
    * Constructor for parameterized functions
    *
@@ -82,10 +104,11 @@ class CppAdInterface {
   CppAdInterface(ad_function_t adFunction, size_t variableDim, std::string modelName, std::string folderName = "/tmp/ocs2",
                  std::vector<std::string> compileFlags = {"-O3", "-g", "-march=native", "-mtune=native", "-ffast-math"});
 
-  ~CppAdInterface() = default;
+  ~CppAdInterface();
 
   /**
-   * Copy constructor. Models are reloaded if available.
+   * Copy constructor. The loaded library is shared with rhs, only the model that holds the evaluation buffers is created
+   * for the copy. If rhs has no loaded library, the models are loaded from disk if available.
    */
   CppAdInterface(const CppAdInterface& rhs);
 
@@ -108,13 +131,35 @@ class CppAdInterface {
   void createModels(ApproximationOrder approximationOrder = ApproximationOrder::Second, bool verbose = true);
 
   /**
-   * Load models if they are available on disk. Creates a new library otherwise.
+   * Load models if they are available on disk and were generated from the same sources. Creates a new library otherwise.
+   * The function is taped and its source code is generated in any case, such that a hash of the sources, the compile flags,
+   * and the tape signature can be compared against the hash stored next to the library.
    *
    * @param approximationOrder : Order of derivatives to generate
    * @param verbose : Print out extra information
    */
   void loadModelsIfAvailable(ApproximationOrder approximationOrder = ApproximationOrder::Second, bool verbose = true);
 
+  /**
+   * Creates the models of several interfaces. The source code is generated sequentially, since CppAD taping is not thread-safe,
+   * while the libraries are compiled concurrently. The number of concurrent compilations is bounded process-wide.
+   *
+   * @param interfaces : The interfaces to create the models for.
+   * @param approximationOrder : Order of derivatives to generate
+   * @param verbose : Print out extra information
+   */
+  static void createModels(const std::vector<CppAdInterface*>& interfaces, ApproximationOrder approximationOrder, bool verbose);
+
+  /**
+   * Loads the models of several interfaces if they are up to date. Outdated or missing libraries are compiled concurrently
+   * as in createModels(interfaces, approximationOrder, verbose).
+   *
+   * @param interfaces : The interfaces to load the models for.
+   * @param approximationOrder : Order of derivatives to generate
+   * @param verbose : Print out extra information
+   */
+  static void loadModelsIfAvailable(const std::vector<CppAdInterface*>& interfaces, ApproximationOrder approximationOrder, bool verbose);
+
   /**
    * @param x : input vector of size variableDim
    * @param p : parameter vector of size parameterDim
@@ -165,7 +210,100 @@ class CppAdInterface {
    */
   matrix_t getHessian(const vector_t& w, const vector_t& x, const vector_t& p = vector_t(0)) const;
 
+  /**
+   * Same as getFunctionValue(x, p) but uses the memory of the workspace.
+   *
+   * @param x : input vector of size variableDim
+   * @param p : parameter vector of size parameterDim
+   * @param workspace : The workspace to evaluate in.
+   * @return y = f(x,p), a reference to workspace.functionValue.
+   */
+  const vector_t& getFunctionValue(const vector_t& x, const vector_t& p, Workspace& workspace) const;
+
+  /**
+   * Same as getJacobian(x, p) but uses the memory of the workspace.
+   *
+   * @param x : input vector of size variableDim
+   * @param p : parameter vector of size parameterDim
+   * @param workspace : The workspace to evaluate in.
+   * @return d/dx( f(x,p) ), a reference to workspace.jacobian.
+   */
+  const matrix_t& getJacobian(const vector_t& x, const vector_t& p, Workspace& workspace) const;
+
+  /**
+   * Same as getGaussNewtonApproximation(x, p) but uses the memory of the workspace.
+   *
+   * @param x : input vector of size variableDim
+   * @param p : parameter vector of size parameterDim
+   * @param workspace : The workspace to evaluate in.
+   * @return Quadratic approximation with the values stored in f, dfdx, dfdxx, a reference to workspace.gaussNewtonApproximation.
+   */
+  const ScalarFunctionQuadraticApproximation& getGaussNewtonApproximation(const vector_t& x, const vector_t& p, Workspace& workspace) const;
+
+  /**
+   * Same as getHessian(outputIndex, x, p) but uses the memory of the workspace.
+   *
+   * @param outputIndex : Output to get the hessian for.
+   * @param x : input vector of size variableDim
+   * @param p : parameter vector of size parameterDim
+   * @param workspace : The workspace to evaluate in.
+   * @return dd/dxdx( f_i(x,p) ), a reference to workspace.hessian.
+   */
+  const matrix_t& getHessian(size_t outputIndex, const vector_t& x, const vector_t& p, Workspace& workspace) const;
+
+  /**
+   * Same as getHessian(w, x, p) but uses the memory of the workspace.
+   *
+   * @param w: vector of weights of size rangeDim
+   * @param x : input vector of size variableDim
+   * @param p : parameter vector of size parameterDim
+   * @param workspace : The workspace to evaluate in.
+   * @return dd/dxdx(sum_i  w_i*f_i(x,p) ), a reference to workspace.hessian.
+   */
+  const matrix_t& getHessian(const vector_t& w, const vector_t& x, const vector_t& p, Workspace& workspace) const;
+
  private:
+  /** Loaded library with its metadata, shared by all copies of an interface. */
+  struct ModelLibrary;
+
+  /** Taped function together with its source generators and the compiler, kept alive until the library is compiled. */
+  struct ModelGenerator;
+
+  /**
+   * Tapes the function and generates the source code of the library.
+   * @param approximationOrder : Order of derivatives to generate
+   * @return generator holding the sources and their hash
+   */
+  std::unique_ptr<ModelGenerator> generateSources(ApproximationOrder approximationOrder);
+
+  /**
+   * Compiles the generated sources, loads the library and stores the hash of the sources next to it.
+   * @param generator : generator returned by generateSources
+   * @param verbose : Print out extra information
+   */
+  void compileModels(ModelGenerator& generator, bool verbose);
+
+  /**
+   * Compiles the libraries of several interfaces concurrently.
+   * @param interfaces : The interfaces to compile the libraries for.
+   * @param generators : The generators of the interfaces.
+   * @param verbose : Print out extra information
+   */
+  static void compileModelsConcurrently(const std::vector<CppAdInterface*>& interfaces,
+                                        const std::vector<std::unique_ptr<ModelGenerator>>& generators, bool verbose);
+
+  /**
+   * Reads the hash of the sources the library on disk was compiled from.
+   * @return hash, empty if not available
+   */
+  std::string readLibraryHash() const;
+
+  /**
+   * Stores the hash of the sources the library on disk was compiled from.
+   * @param hash : hash of the sources
+   */
+  void writeLibraryHash(const std::string& hash) const;
+
   /**
    * Defines library folder names
    */
@@ -203,9 +341,22 @@ class CppAdInterface {
   void setApproximationOrder(ApproximationOrder approximationOrder, CppAD::cg::ModelCSourceGen<scalar_t>& sourceGen, ad_fun_t& fun) const;
 
   /**
-   * Stores the sparisty nonzeros
+   * Wraps a loaded library such that it can be shared between copies and reads its metadata.
+   * @param dynamicLib : loaded library
+   * @return shared library
+   */
+  std::shared_ptr<ModelLibrary> createModelLibrary(std::unique_ptr<CppAD::cg::DynamicLib<scalar_t>> dynamicLib) const;
+
+  /**
+   * Creates the model of this interface from a shared library.
+   * @param modelLibrary : shared library
+   */
+  void setModelLibrary(std::shared_ptr<ModelLibrary> modelLibrary);
+
+  /**
+   * Destroys the model, which is registered in the shared library.
    */
-  void setSparsityNonzeros();
+  void releaseModel();
 
   /**
    * Creates sparsity pattern for the Jacobian that will be generated
@@ -221,8 +372,8 @@ class CppAdInterface {
    */
   cppad_sparsity::SparsityPattern createHessianSparsity(ad_fun_t& fun) const;
 
-  std::unique_ptr<CppAD::cg::DynamicLib<scalar_t>> dynamicLib_;
-  std::unique_ptr<CppAD::cg::GenericModel<scalar_t>> model_;
+  std::shared_ptr<ModelLibrary> modelLibrary_;
+  std::unique_ptr<CppAD::cg::GenericModel<scalar_t>> model_;  // not thread-safe, therefore owned by each copy
   ad_parameterized_function_t adFunction_;
   std::vector<std::string> compileFlags_;
 
@@ -38,7 +38,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
-/** CppAD state-only constraint base class*/
+/**
+ * CppAD state-only constraint base class.
+ *
+ * @note The evaluation results are written into a mutable CppAdInterface::Workspace, so the const methods of one instance are not
+ * reentrant. Use one clone per thread.
+ */
 class StateConstraintCppAd : public StateConstraint {
  public:
   explicit StateConstraintCppAd(ConstraintOrder order) : StateConstraint(order) {}
@@ -73,6 +78,7 @@ class StateConstraintCppAd : public StateConstraint {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  mutable CppAdInterface::Workspace adWorkspace_;
 };
 
 }  // namespace ocs2
@@ -37,6 +37,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+// Forward declaration
+class MultidimensionalPenalty;
+
 /** State-input constraint function base class */
 class StateInputConstraint {
  public:
@@ -66,6 +69,27 @@ class StateInputConstraint {
     }
   }
 
+  /**
+   * Writes the constraint linear approximation into the rows [rowOffset, rowOffset + getNumConstraints(time)) of a stacked linear
+   * approximation. These rows are zero on entry, such that constraints which only depend on a few state and input entries only need to
+   * set those. The default implementation copies getLinearApproximation().
+   *
+   * @param [in] time: The current time.
+   * @param [in] state: The current state.
+   * @param [in] input: The current input.
+   * @param [in] preComp: The pre-computation.
+   * @param [in] rowOffset: The first row of this constraint in the stacked approximation.
+   * @param [in, out] stackedApproximation: The stacked linear approximation into which the constraint rows are written.
+   */
+  virtual void fillLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp,
+                                       size_t rowOffset, VectorFunctionLinearApproximation& stackedApproximation) const {
+    const auto approximation = getLinearApproximation(time, state, input, preComp);
+    const auto nc = approximation.f.rows();
+    stackedApproximation.f.segment(rowOffset, nc) = approximation.f;
+    stackedApproximation.dfdx.middleRows(rowOffset, nc) = approximation.dfdx;
+    stackedApproximation.dfdu.middleRows(rowOffset, nc) = approximation.dfdu;
+  }
+
   /** Get the constraint quadratic approximation */
   virtual VectorFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                          const PreComputation& preComp) const {
@@ -76,6 +100,23 @@ class StateInputConstraint {
     }
   }
 
+  /**
+   * Adds the penalty cost quadratic approximation of the constraint to the given approximation in place, see
+   * StateInputSoftConstraint. Constraints which only depend on a few state and input entries can override this to apply the chain rule
+   * on those blocks only, using MultidimensionalPenalty::getPenaltyValue1stDev2ndDev(). The default implementation passes the linear or
+   * quadratic approximation of getOrder() to MultidimensionalPenalty::accumulateQuadraticApproximation().
+   *
+   * @param [in] time: The current time.
+   * @param [in] state: The current state.
+   * @param [in] input: The current input.
+   * @param [in] preComp: The pre-computation.
+   * @param [in] penalty: The penalty on the constraint.
+   * @param [in, out] approximation: The quadratic approximation to which the penalty cost is added.
+   */
+  virtual void accumulatePenaltyQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                       const PreComputation& preComp, const MultidimensionalPenalty& penalty,
+                                                       ScalarFunctionQuadraticApproximation& approximation) const;
+
  protected:
   StateInputConstraint(const StateInputConstraint& rhs) = default;
 
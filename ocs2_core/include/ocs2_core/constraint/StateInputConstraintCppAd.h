@@ -38,7 +38,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
-/** CppAD state-input constraint base class*/
+/**
+ * CppAD state-input constraint base class.
+ *
+ * @note The evaluation results are written into a mutable CppAdInterface::Workspace, so the const methods of one instance are not
+ * reentrant. Use one clone per thread.
+ */
 class StateInputConstraintCppAd : public StateInputConstraint {
  public:
   explicit StateInputConstraintCppAd(ConstraintOrder order) : StateInputConstraint(order) {}
@@ -75,6 +80,7 @@ class StateInputConstraintCppAd : public StateInputConstraint {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  mutable CppAdInterface::Workspace adWorkspace_;
 };
 
 }  // namespace ocs2
@@ -54,6 +54,15 @@ class ControllerBase {
    */
   virtual vector_t computeInput(scalar_t t, const vector_t& x) = 0;
 
+  /**
+   * @brief Computes the control command at a given time and state into a preallocated output.
+   *
+   * @param [in] t: Current time.
+   * @param [in] x: Current state.
+   * @param [out] u: Current input.
+   */
+  virtual void computeInput(scalar_t t, const vector_t& x, vector_t& u) { u = computeInput(t, x); }
+
   /**
    * @brief Merges this controller with another controller that comes active later in time
    * This method is typically used to merge controllers from multiple time partitions.
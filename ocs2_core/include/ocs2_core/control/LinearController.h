@@ -79,6 +79,8 @@ class LinearController final : public ControllerBase {
 
   vector_t computeInput(scalar_t t, const vector_t& x) override;
 
+  void computeInput(scalar_t t, const vector_t& x, vector_t& u) override;
+
   void concatenate(const ControllerBase* nextController, int index, int length) override;
 
   int size() const override;
@@ -105,6 +107,8 @@ class LinearController final : public ControllerBase {
  private:
   void flattenSingle(scalar_t time, std::vector<float>& flatArray) const;
 
+  LinearInterpolation::TimeSegmentCursor timeSegmentCursor_;
+
  public:
   scalar_array_t timeStamp_;
   vector_array_t biasArray_;
@@ -62,6 +62,7 @@ class StateBasedLinearController final : public ControllerBase {
   static vector_t computeTrajectorySpreadingInput(scalar_t t, const vector_t& x, const scalar_array_t& ctrlEventTimes,
                                                   ControllerBase* ctrlPtr);
 
+  using ControllerBase::computeInput;
   vector_t computeInput(scalar_t t, const vector_t& x) override;
 
   void concatenate(const ControllerBase* nextController, int index, int length) override;
@@ -38,7 +38,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
-/** CppAD state-only cost base class*/
+/**
+ * CppAD state-only cost base class.
+ *
+ * @note The evaluation results are written into a mutable CppAdInterface::Workspace, so the const methods of one instance are not
+ * reentrant. Use one clone per thread.
+ */
 class StateCostCppAd : public StateCost {
  public:
   StateCostCppAd() = default;
@@ -73,6 +78,7 @@ class StateCostCppAd : public StateCost {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  mutable CppAdInterface::Workspace adWorkspace_;
 };
 
 }  // namespace ocs2
@@ -56,6 +56,23 @@ class StateInputCost {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the cost term quadratic approximation to the given approximation in place. Cost terms which only depend on a few state and
+   * input entries can override this to only touch those blocks. The default implementation adds getQuadraticApproximation().
+   *
+   * @param [in] time: The current time.
+   * @param [in] state: The current state.
+   * @param [in] input: The current input.
+   * @param [in] targetTrajectories: The desired trajectories.
+   * @param [in] preComp: The pre-computation.
+   * @param [in, out] approximation: The quadratic approximation to which the cost term is added.
+   */
+  virtual void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                                ScalarFunctionQuadraticApproximation& approximation) const {
+    approximation += getQuadraticApproximation(time, state, input, targetTrajectories, preComp);
+  }
+
  protected:
   StateInputCost(const StateInputCost& rhs) = default;
 };
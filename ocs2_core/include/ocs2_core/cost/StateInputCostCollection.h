@@ -59,6 +59,14 @@ class StateInputCostCollection : public Collection<StateInputCost> {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const;
 
+  /**
+   * Adds the state-input cost quadratic approximation to the given approximation. Its memory is reused, such that no allocation is
+   * needed if the active cost terms also accumulate in place.
+   */
+  virtual void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                                ScalarFunctionQuadraticApproximation& approximation) const;
+
  protected:
   /** Copy constructor */
   StateInputCostCollection(const StateInputCostCollection& other);
@@ -75,6 +75,7 @@ class StateInputCostCppAd : public StateInputCost {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  mutable CppAdInterface::Workspace adWorkspace_;
 };
 
 }  // namespace ocs2
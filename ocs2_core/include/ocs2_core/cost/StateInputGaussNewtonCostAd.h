@@ -91,6 +91,7 @@ class StateInputCostGaussNewtonAd : public StateInputCost {
 
  private:
   std::unique_ptr<CppAdInterface> adInterfacePtr_;
+  mutable CppAdInterface::Workspace adWorkspace_;
 };
 
 }  // namespace ocs2
@@ -137,6 +137,7 @@ class ControlledSystemBase : public OdeBase {
 
  private:
   ControllerBase* controllerPtr_ = nullptr;  //! pointer to controller
+  vector_t input_;                           //! input of the controller, reused between the flow map evaluations
 };
 
 }  // namespace ocs2
@@ -56,6 +56,9 @@ class LinearSystemDynamics : public SystemDynamicsBase {
 
   VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) override;
 
+  void linearApproximationInPlace(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&,
+                                  VectorFunctionLinearApproximation& approximation) override;
+
   VectorFunctionLinearApproximation jumpMapLinearApproximation(scalar_t t, const vector_t& x, const PreComputation&) override;
 
  protected:
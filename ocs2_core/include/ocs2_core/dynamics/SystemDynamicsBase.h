@@ -70,6 +70,20 @@ class SystemDynamicsBase : public ControlledSystemBase {
   virtual VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
                                                                 const PreComputation& preComp) = 0;
 
+  /**
+   * Computes the linear approximation into an existing approximation. Its memory is reused if the dimensions do not change.
+   * The default implementation assigns the result of linearApproximation(t, x, u, preComp). Override it to avoid the allocations.
+   *
+   * @param [in] t: The current time.
+   * @param [in] x: The current state.
+   * @param [in] u: The current input.
+   * @param [in] preComp: pre-computation module, safely ignore this parameter if not used.
+   *                      @see PreComputation class documentation.
+   * @param [out] approximation: The state time derivative linear approximation.
+   */
+  virtual void linearApproximationInPlace(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp,
+                                          VectorFunctionLinearApproximation& approximation);
+
   /** Computes the jump map linear approximation.
    *
    * @param [in] t: The current time.
@@ -122,6 +136,15 @@ class SystemDynamicsBase : public ControlledSystemBase {
    */
   VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u);
 
+  /**
+   * Computes the flow map linear approximation into an existing approximation.
+   *
+   * @note This method updates the internal preComputation with the request() callback and passes it
+   *       to the virtual linearApproximationInPlace() with the preComputation parameter.
+   *       This interface is used by the in-place SensitivityIntegrator.
+   */
+  void linearApproximationInPlace(scalar_t t, const vector_t& x, const vector_t& u, VectorFunctionLinearApproximation& approximation);
+
   /** Computes the jump map linear approximation.
    *
    * @note This method updates the internal preComputation with the requestPreJump() callback and
@@ -71,6 +71,9 @@ class SystemDynamicsBaseAD : public SystemDynamicsBase {
 
   VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) final;
 
+  void linearApproximationInPlace(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&,
+                                  VectorFunctionLinearApproximation& approximation) final;
+
   VectorFunctionLinearApproximation jumpMapLinearApproximation(scalar_t t, const vector_t& x, const PreComputation&) final;
 
   VectorFunctionLinearApproximation guardSurfacesLinearApproximation(scalar_t t, const vector_t& x, const vector_t& u) final;
@@ -174,10 +177,10 @@ class SystemDynamicsBaseAD : public SystemDynamicsBase {
   vector_t tapedTimeStateInput_;
   vector_t tapedTimeState_;
 
-  /** Cached jacobians for time derivative */
-  matrix_t flowJacobian_;
-  matrix_t jumpJacobian_;
-  matrix_t guardJacobian_;
+  /** Evaluation memory. The cached jacobians are used for the time derivatives */
+  CppAdInterface::Workspace flowMapWorkspace_;
+  CppAdInterface::Workspace jumpMapWorkspace_;
+  CppAdInterface::Workspace guardSurfacesWorkspace_;
 };
 
 }  // namespace ocs2
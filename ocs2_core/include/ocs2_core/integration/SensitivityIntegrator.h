@@ -87,4 +87,36 @@ using DynamicsSensitivityDiscretizer =
  */
 DynamicsSensitivityDiscretizer selectDynamicsSensitivityDiscretization(SensitivityIntegratorType integratorType);
 
+/**
+ * Memory for the stages and temporaries of the sensitivity discretizations. Reusing it across calls avoids reallocations.
+ */
+struct SensitivityDiscretizationWorkspace {
+  VectorFunctionLinearApproximation k1;
+  VectorFunctionLinearApproximation k2;
+  VectorFunctionLinearApproximation k3;
+  VectorFunctionLinearApproximation k4;
+  vector_t state;
+  matrix_t sensitivity;
+};
+
+/**
+ * A function handle to compute the linear approximation of the discretized system's flowmap in-place.
+ *
+ * @param system : system to be discretized
+ * @param t : starting time of the discretization interval
+ * @param x : starting state x_{k}
+ * @param u : input u_{k}, assumed constant over the entire interval
+ * @param dt : interval duration
+ * @param workspace : memory for the integrator stages
+ * @param [out] approximation : Approximation of the form x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}. Its memory is reused if the
+ * sizes match.
+ */
+using DynamicsSensitivityDiscretizerInPlace = std::function<void(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t,
+                                                                 SensitivityDiscretizationWorkspace&, VectorFunctionLinearApproximation&)>;
+
+/**
+ * Select available in-place integrator based on enum
+ */
+DynamicsSensitivityDiscretizerInPlace selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType integratorType);
+
 }  // namespace ocs2
\ No newline at end of file
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/dynamics/SystemDynamicsBase.h>
+#include <ocs2_core/integration/SensitivityIntegrator.h>
 
 namespace ocs2 {
 
@@ -48,6 +49,10 @@ vector_t eulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vecto
 VectorFunctionLinearApproximation eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
                                                                  const vector_t& u, scalar_t dt);
 
+/** In-place version of eulerSensitivityDiscretization, writes into approximation and keeps the stages in the workspace. */
+void eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                    SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation);
+
 /**
  * Computes the discretized dynamics. Uses an Runge-Kutta 2nd order discretization.
  * Returns x_{k+1}
@@ -62,6 +67,10 @@ vector_t rk2Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 VectorFunctionLinearApproximation rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt);
 
+/** In-place version of rk2SensitivityDiscretization, writes into approximation and keeps the stages in the workspace. */
+void rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation);
+
 /**
  * Computes the discretized dynamics. Uses an Runge-Kutta 4th order discretization.
  * Returns x_{k+1}
@@ -76,4 +85,8 @@ vector_t rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt);
 
+/** In-place version of rk4SensitivityDiscretization, writes into approximation and keeps the stages in the workspace. */
+void rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation);
+
 }  // namespace ocs2
\ No newline at end of file
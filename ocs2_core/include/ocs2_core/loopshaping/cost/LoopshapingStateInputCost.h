@@ -47,6 +47,10 @@ class LoopshapingStateInputCost : public StateInputCostCollection {
   scalar_t getValue(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories& targetTrajectories,
                     const PreComputation& preComp) const final;
 
+  /** Adds the loopshaping quadratic approximation, which is computed by the derived getQuadraticApproximation(). */
+  void accumulateQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories& targetTrajectories,
+                                        const PreComputation& preComp, ScalarFunctionQuadraticApproximation& approximation) const final;
+
  protected:
   /** Constructor */
   LoopshapingStateInputCost(const StateInputCostCollection& systemCost, std::shared_ptr<LoopshapingDefinition> loopshapingDefinition)
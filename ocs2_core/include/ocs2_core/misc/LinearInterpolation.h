@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <atomic>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -53,6 +54,38 @@ using remove_cvref_t = typename std::remove_cv<typename std::remove_reference<T>
  */
 index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray);
 
+/**
+ * A stateful variant of timeSegment() for enquiry times which change monotonically, e.g. during integration or when following a policy.
+ * The interval of the previous enquiry and its neighbours are checked first before falling back to a binary search. The result is
+ * identical to timeSegment(). The time array may change between the enquiries, and a cursor may be shared between threads, in which case
+ * they only compete for the cached interval.
+ */
+class TimeSegmentCursor {
+ public:
+  TimeSegmentCursor() = default;
+  TimeSegmentCursor(const TimeSegmentCursor& other) : interval_(other.interval_.load(std::memory_order_relaxed)) {}
+  TimeSegmentCursor& operator=(const TimeSegmentCursor& other) {
+    interval_.store(other.interval_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+  }
+
+  /**
+   * Get the interval index and interpolation coefficient alpha.
+   * Alpha = 1 at the start of the interval and alpha = 0 at the end.
+   *
+   * @param [in] enquiryTime: The enquiry time for interpolation.
+   * @param [in] timeArray: interpolation time array.
+   * @return {index, alpha}
+   */
+  index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray);
+
+  /** Forgets the interval of the previous enquiry. */
+  void reset() { interval_.store(0, std::memory_order_relaxed); }
+
+ private:
+  std::atomic_int interval_{0};
+};
+
 /**
  * Directly uses the index and interpolation coefficient provided by the user
  * @note If sizes in data array are not equal, the interpolation will snap to the data
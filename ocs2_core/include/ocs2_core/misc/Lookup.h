@@ -115,6 +115,38 @@ int findIntervalInTimeArray(const std::vector<SCALAR>& timeArray, SCALAR time) {
   }
 }
 
+/**
+ * Same as findIntervalInTimeArray, but the hinted interval and its neighbours are checked before falling back to a binary search.
+ * For enquiry times which change monotonically, e.g. during integration, the lookup then takes constant time.
+ *
+ * @tparam SCALAR : numerical type of time
+ * @param timeArray : sorted time array to perform the lookup in
+ * @param time : enquiry time
+ * @param intervalHint : a guess of the interval, e.g. the result of the previous lookup
+ * @return interval between [-1, size(timeArray)-1]
+ */
+template <typename SCALAR = double>
+int findIntervalInTimeArray(const std::vector<SCALAR>& timeArray, SCALAR time, int intervalHint) {
+  if (timeArray.empty()) {
+    return 0;
+  }
+
+  // interval i is selected iff t(i) < time <= t(i+1), where t(-1) = -inf and t(n) = +inf
+  const auto lastInterval = static_cast<int>(timeArray.size()) - 1;
+  auto isInInterval = [&](int i) { return (i < 0 || timeArray[i] < time) && (i >= lastInterval || time <= timeArray[i + 1]); };
+
+  intervalHint = std::min(std::max(intervalHint, -1), lastInterval);
+  if (isInInterval(intervalHint)) {
+    return intervalHint;
+  } else if (intervalHint < lastInterval && isInInterval(intervalHint + 1)) {
+    return intervalHint + 1;
+  } else if (intervalHint > -1 && isInInterval(intervalHint - 1)) {
+    return intervalHint - 1;
+  } else {
+    return findIndexInTimeArray(timeArray, time) - 1;
+  }
+}
+
 /**
  * Same as findIntervalInTimeArray except for 1 rule:
  * if t = t0, a 0 is returned instead of -1
@@ -66,13 +66,10 @@ const Data& stdAccessFun(const std::vector<Data, Alloc>& vec, size_t ind) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
-  // corner cases (no time set OR single time element)
-  if (timeArray.size() <= 1) {
-    return {0, scalar_t(1.0)};
-  }
-
-  const int index = lookup::findIntervalInTimeArray(timeArray, enquiryTime);
+/**
+ * Computes the interval index and interpolation coefficient from the interval found by lookup::findIntervalInTimeArray.
+ */
+inline index_alpha_t timeSegmentOfInterval(int index, scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
   const auto lastInterval = static_cast<int>(timeArray.size() - 1);
   if (index >= 0) {
     if (index < lastInterval) {
@@ -104,6 +101,32 @@ inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
+  // corner cases (no time set OR single time element)
+  if (timeArray.size() <= 1) {
+    return {0, scalar_t(1.0)};
+  }
+
+  return timeSegmentOfInterval(lookup::findIntervalInTimeArray(timeArray, enquiryTime), enquiryTime, timeArray);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline index_alpha_t TimeSegmentCursor::timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
+  // corner cases (no time set OR single time element)
+  if (timeArray.size() <= 1) {
+    return {0, scalar_t(1.0)};
+  }
+
+  const int interval = lookup::findIntervalInTimeArray(timeArray, enquiryTime, interval_.load(std::memory_order_relaxed));
+  interval_.store(interval, std::memory_order_relaxed);
+  return timeSegmentOfInterval(interval, enquiryTime, timeArray);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <memory>
+#include <tuple>
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/penalties/augmented_penalties/AugmentedPenaltyBase.h>
@@ -102,6 +103,39 @@ class MultidimensionalPenalty final {
   ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h,
                                                                  const vector_t* l = nullptr) const;
 
+  /**
+   * Adds the penalty cost quadratic approximation to the given approximation in place.
+   *
+   * @param [in] t: The time that the constraint is evaluated.
+   * @param [in] h: The constraint linear approximation.
+   * @param [in, out] approximation: The quadratic approximation to which the penalty cost is added.
+   * @param [in] l: The Lagrange multipliers, if the penalty uses them.
+   */
+  void accumulateQuadraticApproximation(scalar_t t, const VectorFunctionLinearApproximation& h,
+                                        ScalarFunctionQuadraticApproximation& approximation, const vector_t* l = nullptr) const;
+
+  /**
+   * Adds the penalty cost quadratic approximation to the given approximation in place.
+   *
+   * @param [in] t: The time that the constraint is evaluated.
+   * @param [in] h: The constraint quadratic approximation.
+   * @param [in, out] approximation: The quadratic approximation to which the penalty cost is added.
+   * @param [in] l: The Lagrange multipliers, if the penalty uses them.
+   */
+  void accumulateQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h,
+                                        ScalarFunctionQuadraticApproximation& approximation, const vector_t* l = nullptr) const;
+
+  /**
+   * Gets the penalty cost and its first and second derivatives with respect to each constraint value. Constraints which only depend on a
+   * few state and input entries use them to apply the chain rule on those blocks only.
+   *
+   * @param [in] t: The time that the constraint is evaluated.
+   * @param [in] h: Vector of inequality constraint values.
+   * @param [in] l: The Lagrange multipliers, if the penalty uses them.
+   * @return The penalty cost, and the vectors of its first and second derivatives.
+   */
+  std::tuple<scalar_t, vector_t, vector_t> getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h, const vector_t* l = nullptr) const;
+
   /**
    * Updates the Lagrange multipliers.
    *
@@ -121,8 +155,6 @@ class MultidimensionalPenalty final {
   vector_t initializeMultipliers(size_t numConstraints) const;
 
  private:
-  std::tuple<scalar_t, vector_t, vector_t> getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h, const vector_t* l) const;
-
   std::vector<std::unique_ptr<AugmentedPenaltyBase>> penaltyPtrArray_;
 };
 
@@ -29,10 +29,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -40,6 +43,9 @@ namespace ocs2 {
 
 /**
  * Thread pool class to execute tasks on multiple threads.
+ *
+ * Each worker owns a task deque. Tasks submitted from a worker thread are pushed to its own deque, while tasks submitted from outside
+ * the pool are distributed round-robin over the workers. An idle worker first serves its own deque and then steals from the others.
  */
 class ThreadPool {
  public:
@@ -80,6 +86,24 @@ class ThreadPool {
    */
   void runParallel(std::function<void(int)> taskFunction, int N);
 
+  /**
+   * Helper function to run a loop body over the index range [begin, end) in parallel with the help of the pool.
+   * The range is split into chunks of grainSize indices. Each participating thread (the pool workers with ID in [0, nThreads-1] and the
+   * calling thread with ID = nThreads) starts on its own contiguous block of chunks and, once done, steals the remaining chunks of the
+   * other participants. Therefore, there is no shared counter that is incremented per index.
+   *
+   * @note This is a blocking operation, returns when all indices are processed. Exceptions thrown by the loop body are rethrown.
+   * @note A given workerIndex is never used by two threads at the same time, so it can be used to index designated thread resources.
+   *
+   * @tparam Functor: Type of the loop body with signature void(int workerIndex, int index).
+   * @param [in] begin: The first index.
+   * @param [in] end: One past the last index.
+   * @param [in] grainSize: The number of consecutive indices which are processed as one chunk (at least 1).
+   * @param [in] loopBody: The loop body function.
+   */
+  template <typename Functor>
+  void parallelFor(int begin, int end, int grainSize, Functor&& loopBody);
+
   /** Get the number of threads. */
   size_t numThreads() const { return workerThreads_.size(); }
 
@@ -89,6 +113,26 @@ class ThreadPool {
   template <typename Functor>
   struct Task;
 
+  struct WorkerQueue;
+
+  /**
+   * Type erased implementation of parallelFor.
+   *
+   * @param [in] begin: The first index.
+   * @param [in] end: One past the last index.
+   * @param [in] grainSize: The chunk size.
+   * @param [in] chunkFunction: Processes the indices [chunkBegin, chunkEnd) with signature void(workerIndex, chunkBegin, chunkEnd).
+   */
+  void parallelForImpl(int begin, int end, int grainSize, const std::function<void(int, int, int)>& chunkFunction);
+
+  /**
+   * Takes a task from the worker's own deque or steals one from the other workers.
+   *
+   * @param [in] workerIndex: worker thread index
+   * @return The task or nullptr if all deques are empty.
+   */
+  std::unique_ptr<TaskBase> popTask(int workerIndex);
+
   /**
    * Thread worker loop
    *
@@ -103,11 +147,15 @@ class ThreadPool {
    */
   void runTask(std::unique_ptr<TaskBase> taskPtr);
 
-  bool stop_{false};  //!< flag telling all threads to stop, protected by taskQueueLock_
+  std::atomic_bool stop_{false};  //!< flag telling all threads to stop
+
+  std::vector<std::unique_ptr<WorkerQueue>> workerQueues_;
+  std::atomic_size_t nextQueueIndex_{0};  //!< round-robin index for tasks submitted from outside the pool
 
-  std::queue<std::unique_ptr<TaskBase>> taskQueue_;  // protected by taskQueueLock_
-  std::condition_variable taskQueueCondition_;
-  std::mutex taskQueueLock_;
+  std::atomic_size_t numPendingTasks_{0};  //!< number of tasks in all deques
+  std::atomic_size_t numIdleWorkers_{0};   //!< number of workers waiting on idleCondition_
+  std::condition_variable idleCondition_;
+  std::mutex idleLock_;
 
   std::vector<std::thread> workerThreads_;
 };
@@ -136,6 +184,14 @@ struct ThreadPool::Task final : public ThreadPool::TaskBase {
   std::packaged_task<ReturnType(int)> packagedTask;
 };
 
+/**
+ * Task deque of a single worker.
+ */
+struct ThreadPool::WorkerQueue {
+  std::deque<std::unique_ptr<TaskBase>> tasks;  // protected by lock
+  std::mutex lock;
+};
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -154,4 +210,16 @@ std::future<typename std::result_of<Functor(int)>::type> ThreadPool::run(Functor
   return future;
 }
 
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+template <typename Functor>
+void ThreadPool::parallelFor(int begin, int end, int grainSize, Functor&& loopBody) {
+  parallelForImpl(begin, end, grainSize, [&loopBody](int workerIndex, int chunkBegin, int chunkEnd) {
+    for (int i = chunkBegin; i < chunkEnd; ++i) {
+      loopBody(workerIndex, i);
+    }
+  });
+}
+
 }  // namespace ocs2
@@ -29,10 +29,129 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/automatic_differentiation/CppAdInterface.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
 #include <boost/filesystem.hpp>
 
 namespace ocs2 {
 
+namespace {
+
+const std::string hashExtension = ".hash";
+
+/** 64-bit FNV-1a hash. Unlike std::hash, its value is stable across runs and standard library implementations. */
+class SourceHash {
+ public:
+  void add(const std::string& data) {
+    add(data.size());
+    for (const char c : data) {
+      addByte(static_cast<unsigned char>(c));
+    }
+  }
+
+  void add(size_t data) {
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+      addByte(static_cast<unsigned char>((static_cast<uint64_t>(data) >> (8 * i)) & 0xff));
+    }
+  }
+
+  std::string toString() const {
+    std::ostringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << value_;
+    return stream.str();
+  }
+
+ private:
+  void addByte(unsigned char byte) {
+    value_ ^= byte;
+    value_ *= 1099511628211ULL;
+  }
+
+  uint64_t value_ = 14695981039346656037ULL;
+};
+
+/** Gives access to the generated sources, which are cached by the source generators and reused during the compilation. */
+class HashingLibraryProcessor : public CppAD::cg::DynamicModelLibraryProcessor<scalar_t> {
+ public:
+  using CppAD::cg::DynamicModelLibraryProcessor<scalar_t>::DynamicModelLibraryProcessor;
+
+  void addSources(CppAD::cg::ModelCSourceGen<scalar_t>& sourceGen, SourceHash& hash) {
+    auto addSourceFiles = [&hash](const std::map<std::string, std::string>& sources) {
+      for (const auto& source : sources) {
+        hash.add(source.first);
+        hash.add(source.second);
+      }
+    };
+    addSourceFiles(getSources(sourceGen));
+    addSourceFiles(getLibrarySources());
+  }
+};
+
+/** Counting semaphore that bounds the number of libraries compiled concurrently within the process. */
+class CompilationJobLimit {
+ public:
+  explicit CompilationJobLimit(size_t numJobs) : numAvailableJobs_(numJobs) {}
+
+  void acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return numAvailableJobs_ > 0; });
+    --numAvailableJobs_;
+  }
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++numAvailableJobs_;
+    }
+    condition_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t numAvailableJobs_;
+};
+
+CompilationJobLimit& getCompilationJobLimit() {
+  static CompilationJobLimit compilationJobLimit(std::max(1U, std::thread::hardware_concurrency()));
+  return compilationJobLimit;
+}
+
+struct CompilationJobGuard {
+  explicit CompilationJobGuard(CompilationJobLimit& limit) : limit_(limit) { limit_.acquire(); }
+  ~CompilationJobGuard() { limit_.release(); }
+  CompilationJobLimit& limit_;
+};
+
+}  // namespace
+
+struct CppAdInterface::ModelLibrary {
+  std::unique_ptr<CppAD::cg::DynamicLib<scalar_t>> dynamicLib;
+  // The models register themselves in the library on creation and destruction
+  std::mutex modelMutex;
+
+  size_t rangeDim = 0;
+  size_t nnzJacobian = 0;
+  size_t nnzHessian = 0;
+};
+
+struct CppAdInterface::ModelGenerator {
+  ad_fun_t fun;
+  std::unique_ptr<CppAD::cg::ModelCSourceGen<scalar_t>> sourceGen;
+  std::unique_ptr<CppAD::cg::ModelLibraryCSourceGen<scalar_t>> libraryCSourceGen;
+  std::unique_ptr<HashingLibraryProcessor> libraryProcessor;
+  CppAD::cg::GccCompiler<scalar_t> gccCompiler;
+  std::string hash;
+};
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -60,7 +179,9 @@ CppAdInterface::CppAdInterface(ad_function_t adFunction, size_t variableDim, std
 /******************************************************************************************************/
 CppAdInterface::CppAdInterface(const CppAdInterface& rhs)
     : CppAdInterface(rhs.adFunction_, rhs.variableDim_, rhs.parameterDim_, rhs.modelName_, rhs.folderName_, rhs.compileFlags_) {
-  if (isLibraryAvailable()) {
+  if (rhs.modelLibrary_ != nullptr) {
+    setModelLibrary(rhs.modelLibrary_);
+  } else if (isLibraryAvailable()) {
     loadModels(false);
   }
 }
@@ -68,55 +189,15 @@ CppAdInterface::CppAdInterface(const CppAdInterface& rhs)
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void CppAdInterface::createModels(ApproximationOrder approximationOrder, bool verbose) {
-  createFolderStructure();
-
-  // set and declare independent variables and start tape recording
-  ad_vector_t xp(variableDim_ + parameterDim_);
-  xp.setOnes();  // Ones are better than zero, to prevent devision by zero in taping
-  CppAD::Independent(xp);
-
-  // Split in variables and parameters
-  ad_vector_t x = xp.segment(0, variableDim_);
-  ad_vector_t p = xp.segment(variableDim_, parameterDim_);
-  // dependent variable vector
-  ad_vector_t y;
-  // the model equation
-  adFunction_(x, p, y);
-  rangeDim_ = y.rows();
-  // create f: xp -> y and stop tape recording
-  ad_fun_t fun(xp, y);
-  // Optimize the operation sequence
-  fun.optimize();
-
-  // generates source code
-  CppAD::cg::ModelCSourceGen<scalar_t> sourceGen(fun, modelName_);
-  setApproximationOrder(approximationOrder, sourceGen, fun);
-
-  // Compiler objects, compile to temporary shared library file to avoid interference between processes
-  CppAD::cg::ModelLibraryCSourceGen<scalar_t> libraryCSourceGen(sourceGen);
-  CppAD::cg::GccCompiler<scalar_t> gccCompiler;
-  CppAD::cg::DynamicModelLibraryProcessor<scalar_t> libraryProcessor(libraryCSourceGen, libraryName_ + tmpName_);
-  setCompilerOptions(gccCompiler);
-
-  if (verbose) {
-    std::cerr << "[CppAdInterface] Compiling Shared Library: "
-              << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
-  }
-
-  // Compile and store the library
-  dynamicLib_ = libraryProcessor.createDynamicLibrary(gccCompiler);
-  model_ = dynamicLib_->model(modelName_);
-
-  setSparsityNonzeros();
+CppAdInterface::~CppAdInterface() {
+  releaseModel();
+}
 
-  // Rename generated library after loading
-  if (verbose) {
-    std::cerr << "[CppAdInterface] Renaming " << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << " to "
-              << libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
-  }
-  boost::filesystem::rename(libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION,
-                            libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION);
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::createModels(ApproximationOrder approximationOrder, bool verbose) {
+  createModels({this}, approximationOrder, verbose);
 }
 
 /******************************************************************************************************/
@@ -127,59 +208,137 @@ void CppAdInterface::loadModels(bool verbose) {
     std::cerr << "[CppAdInterface] Loading Shared Library: " << libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION
               << std::endl;
   }
-  dynamicLib_.reset(new CppAD::cg::LinuxDynamicLib<scalar_t>(libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION));
-  model_ = dynamicLib_->model(modelName_);
-  rangeDim_ = model_->Range();
-
-  setSparsityNonzeros();
+  std::unique_ptr<CppAD::cg::DynamicLib<scalar_t>> dynamicLib(
+      new CppAD::cg::LinuxDynamicLib<scalar_t>(libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION));
+  setModelLibrary(createModelLibrary(std::move(dynamicLib)));
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void CppAdInterface::loadModelsIfAvailable(ApproximationOrder approximationOrder, bool verbose) {
-  if (isLibraryAvailable()) {
-    loadModels(verbose);
-  } else {
-    createModels(approximationOrder, verbose);
+  loadModelsIfAvailable({this}, approximationOrder, verbose);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::createModels(const std::vector<CppAdInterface*>& interfaces, ApproximationOrder approximationOrder, bool verbose) {
+  std::vector<std::unique_ptr<ModelGenerator>> generators;
+  generators.reserve(interfaces.size());
+  for (auto* interface : interfaces) {
+    generators.push_back(interface->generateSources(approximationOrder));
+  }
+  compileModelsConcurrently(interfaces, generators, verbose);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::loadModelsIfAvailable(const std::vector<CppAdInterface*>& interfaces, ApproximationOrder approximationOrder,
+                                           bool verbose) {
+  std::vector<CppAdInterface*> outdatedInterfaces;
+  std::vector<std::unique_ptr<ModelGenerator>> generators;
+  for (auto* interface : interfaces) {
+    auto generator = interface->generateSources(approximationOrder);
+    if (interface->isLibraryAvailable() && interface->readLibraryHash() == generator->hash) {
+      interface->loadModels(verbose);
+    } else {
+      if (verbose && interface->isLibraryAvailable()) {
+        std::cerr << "[CppAdInterface] Library " << interface->libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION
+                  << " is outdated." << std::endl;
+      }
+      outdatedInterfaces.push_back(interface);
+      generators.push_back(std::move(generator));
+    }
   }
+  compileModelsConcurrently(outdatedInterfaces, generators, verbose);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t CppAdInterface::getFunctionValue(const vector_t& x, const vector_t& p) const {
-  vector_t xp(variableDim_ + parameterDim_);
-  xp << x, p;
+  Workspace workspace;
+  return getFunctionValue(x, p, workspace);
+}
 
-  vector_t functionValue(model_->Range());
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+matrix_t CppAdInterface::getJacobian(const vector_t& x, const vector_t& p) const {
+  Workspace workspace;
+  return getJacobian(x, p, workspace);
+}
 
-  model_->ForwardZero(xp, functionValue);
-  assert(functionValue.allFinite());
-  return functionValue;
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ScalarFunctionQuadraticApproximation CppAdInterface::getGaussNewtonApproximation(const vector_t& x, const vector_t& p) const {
+  Workspace workspace;
+  return getGaussNewtonApproximation(x, p, workspace);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-matrix_t CppAdInterface::getJacobian(const vector_t& x, const vector_t& p) const {
+matrix_t CppAdInterface::getHessian(size_t outputIndex, const vector_t& x, const vector_t& p) const {
+  Workspace workspace;
+  return getHessian(outputIndex, x, p, workspace);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+matrix_t CppAdInterface::getHessian(const vector_t& w, const vector_t& x, const vector_t& p) const {
+  Workspace workspace;
+  return getHessian(w, x, p, workspace);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+const vector_t& CppAdInterface::getFunctionValue(const vector_t& x, const vector_t& p, Workspace& workspace) const {
+  // Concatenate input
+  workspace.xp.resize(variableDim_ + parameterDim_);
+  workspace.xp << x, p;
+
+  workspace.functionValue.resize(model_->Range());
+  model_->ForwardZero(workspace.xp, workspace.functionValue);
+
+  assert(workspace.functionValue.allFinite());
+  return workspace.functionValue;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+const matrix_t& CppAdInterface::getJacobian(const vector_t& x, const vector_t& p, Workspace& workspace) const {
   // Concatenate input
-  vector_t xp(variableDim_ + parameterDim_);
-  xp << x, p;
-  CppAD::cg::ArrayView<scalar_t> xpArrayView(xp.data(), xp.size());
+  workspace.xp.resize(variableDim_ + parameterDim_);
+  workspace.xp << x, p;
+  CppAD::cg::ArrayView<scalar_t> xpArrayView(workspace.xp.data(), workspace.xp.size());
 
-  std::vector<scalar_t> sparseJacobian(nnzJacobian_);
-  CppAD::cg::ArrayView<scalar_t> sparseJacobianArrayView(sparseJacobian);
+  workspace.sparseValues.resize(nnzJacobian_);
+  CppAD::cg::ArrayView<scalar_t> sparseJacobianArrayView(workspace.sparseValues);
   size_t const* rows;
   size_t const* cols;
   // Call this particular SparseJacobian. Other CppAd functions allocate internal vectors that are incompatible with multithreading.
   model_->SparseJacobian(xpArrayView, sparseJacobianArrayView, &rows, &cols);
 
+  // The structural zeros are only written when the workspace was filled by another interface or has the wrong size.
+  auto& jacobian = workspace.jacobian;
+  const auto rangeDim = static_cast<Eigen::Index>(model_->Range());
+  const auto variableDim = static_cast<Eigen::Index>(variableDim_);
+  if (workspace.jacobianOwner != this || jacobian.rows() != rangeDim || jacobian.cols() != variableDim) {
+    jacobian.setZero(rangeDim, variableDim);
+    workspace.jacobianOwner = this;
+  }
+
   // Write sparse elements into Eigen type. Only jacobian w.r.t. variables was requested, so cols should not contain elements corresponding
   // to parameters.
-  matrix_t jacobian = matrix_t::Zero(model_->Range(), variableDim_);
   for (size_t i = 0; i < nnzJacobian_; i++) {
-    jacobian(rows[i], cols[i]) = sparseJacobian[i];
+    jacobian(rows[i], cols[i]) = workspace.sparseValues[i];
   }
 
   assert(jacobian.allFinite());
@@ -189,22 +348,19 @@ matrix_t CppAdInterface::getJacobian(const vector_t& x, const vector_t& p) const
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-ScalarFunctionQuadraticApproximation CppAdInterface::getGaussNewtonApproximation(const vector_t& x, const vector_t& p) const {
-  // Concatenate input
-  vector_t xp(variableDim_ + parameterDim_);
-  xp << x, p;
-  CppAD::cg::ArrayView<scalar_t> xpArrayView(xp.data(), xp.size());
-
-  ScalarFunctionQuadraticApproximation gnApprox;
+const ScalarFunctionQuadraticApproximation& CppAdInterface::getGaussNewtonApproximation(const vector_t& x, const vector_t& p,
+                                                                                          Workspace& workspace) const {
+  // Zero order, also concatenates the input in workspace.xp
+  const vector_t& valueVector = getFunctionValue(x, p, workspace);
+  CppAD::cg::ArrayView<scalar_t> xpArrayView(workspace.xp.data(), workspace.xp.size());
 
-  // Zero order
-  vector_t valueVector(model_->Range());
-  model_->ForwardZero(xp, valueVector);
+  auto& gnApprox = workspace.gaussNewtonApproximation;
   gnApprox.f = 0.5 * valueVector.squaredNorm();
 
   // Jacobian
-  std::vector<scalar_t> sparseJacobian(nnzJacobian_);
-  CppAD::cg::ArrayView<scalar_t> sparseJacobianArrayView(sparseJacobian);
+  workspace.sparseValues.resize(nnzJacobian_);
+  const auto& sparseJacobian = workspace.sparseValues;
+  CppAD::cg::ArrayView<scalar_t> sparseJacobianArrayView(workspace.sparseValues);
   size_t const* rows;
   size_t const* cols;
   model_->SparseJacobian(xpArrayView, sparseJacobianArrayView, &rows, &cols);
@@ -221,19 +377,32 @@ ScalarFunctionQuadraticApproximation CppAdInterface::getGaussNewtonApproximation
    * Because the sparse elements are ordered first by row, then by column, we process J row-by-row.
    * For each row of J, we add the non-zero pairs (i, j) to H(i, j).
    */
-  gnApprox.dfdxx.setZero(variableDim_, variableDim_);
+  auto& hessian = gnApprox.dfdxx;
+  const auto variableDim = static_cast<Eigen::Index>(variableDim_);
+  if (workspace.gaussNewtonOwner != this || hessian.rows() != variableDim || hessian.cols() != variableDim) {
+    hessian.setZero(variableDim, variableDim);
+    workspace.gaussNewtonOwner = this;
+  } else {
+    // Only reset the entries that are accumulated below
+    for (size_t i = 0; i < nnzJacobian_; ++i) {
+      for (size_t j = i; j < nnzJacobian_ && rows[j] == rows[i]; ++j) {
+        hessian(cols[j], cols[i]) = 0.0;
+        hessian(cols[i], cols[j]) = 0.0;
+      }
+    }
+  }
   for (size_t i = 0; i < nnzJacobian_; ++i) {
     const size_t row_i = rows[i];
     const size_t col_i = cols[i];
     const scalar_t v_i = sparseJacobian[i];
     // Diagonal element always exists:
-    gnApprox.dfdxx(col_i, col_i) += v_i * v_i;
+    hessian(col_i, col_i) += v_i * v_i;
     // Process off-diagonals
     size_t j = i + 1;
-    while (rows[j] == row_i) {
+    while (j < nnzJacobian_ && rows[j] == row_i) {
       const size_t col_j = cols[j];
-      gnApprox.dfdxx(col_j, col_i) += v_i * sparseJacobian[j];
-      gnApprox.dfdxx(col_i, col_j) = gnApprox.dfdxx(col_j, col_i);  // Maintain symmetry as we go.
+      hessian(col_j, col_i) += v_i * sparseJacobian[j];
+      hessian(col_i, col_j) = hessian(col_j, col_i);  // Maintain symmetry as we go.
       ++j;
     }
   }
@@ -246,24 +415,24 @@ ScalarFunctionQuadraticApproximation CppAdInterface::getGaussNewtonApproximation
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-matrix_t CppAdInterface::getHessian(size_t outputIndex, const vector_t& x, const vector_t& p) const {
-  vector_t w = vector_t::Zero(rangeDim_);
-  w[outputIndex] = 1.0;
+const matrix_t& CppAdInterface::getHessian(size_t outputIndex, const vector_t& x, const vector_t& p, Workspace& workspace) const {
+  workspace.weights.setZero(rangeDim_);
+  workspace.weights[outputIndex] = 1.0;
 
-  return getHessian(w, x, p);
+  return getHessian(workspace.weights, x, p, workspace);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-matrix_t CppAdInterface::getHessian(const vector_t& w, const vector_t& x, const vector_t& p) const {
+const matrix_t& CppAdInterface::getHessian(const vector_t& w, const vector_t& x, const vector_t& p, Workspace& workspace) const {
   // Concatenate input
-  vector_t xp(variableDim_ + parameterDim_);
-  xp << x, p;
-  CppAD::cg::ArrayView<const scalar_t> xpArrayView(xp.data(), xp.size());
+  workspace.xp.resize(variableDim_ + parameterDim_);
+  workspace.xp << x, p;
+  CppAD::cg::ArrayView<const scalar_t> xpArrayView(workspace.xp.data(), workspace.xp.size());
 
-  std::vector<scalar_t> sparseHessian(nnzHessian_);
-  CppAD::cg::ArrayView<scalar_t> sparseHessianArrayView(sparseHessian);
+  workspace.sparseValues.resize(nnzHessian_);
+  CppAD::cg::ArrayView<scalar_t> sparseHessianArrayView(workspace.sparseValues);
   size_t const* rows;
   size_t const* cols;
 
@@ -272,19 +441,167 @@ matrix_t CppAdInterface::getHessian(const vector_t& w, const vector_t& x, const
   // Call this particular SparseHessian. Other CppAd functions allocate internal vectors that are incompatible with multithreading.
   model_->SparseHessian(xpArrayView, wArrayView, sparseHessianArrayView, &rows, &cols);
 
-  // Fills upper triangular sparsity of hessian w.r.t variables.
-  matrix_t hessian = matrix_t::Zero(variableDim_, variableDim_);
-  for (size_t i = 0; i < nnzHessian_; i++) {
-    hessian(rows[i], cols[i]) = sparseHessian[i];
+  // The structural zeros are only written when the workspace was filled by another interface or has the wrong size.
+  auto& hessian = workspace.hessian;
+  const auto variableDim = static_cast<Eigen::Index>(variableDim_);
+  if (workspace.hessianOwner != this || hessian.rows() != variableDim || hessian.cols() != variableDim) {
+    hessian.setZero(variableDim, variableDim);
+    workspace.hessianOwner = this;
   }
 
-  // Copy upper triangular to lower triangular part
-  hessian.template triangularView<Eigen::StrictlyLower>() = hessian.template triangularView<Eigen::StrictlyUpper>().transpose();
+  // Fills upper triangular sparsity of hessian w.r.t variables and mirrors it to the lower triangular part.
+  for (size_t i = 0; i < nnzHessian_; i++) {
+    hessian(rows[i], cols[i]) = workspace.sparseValues[i];
+    hessian(cols[i], rows[i]) = workspace.sparseValues[i];
+  }
 
   assert(hessian.allFinite());
   return hessian;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::unique_ptr<CppAdInterface::ModelGenerator> CppAdInterface::generateSources(ApproximationOrder approximationOrder) {
+  std::unique_ptr<ModelGenerator> generator(new ModelGenerator);
+
+  // set and declare independent variables and start tape recording
+  ad_vector_t xp(variableDim_ + parameterDim_);
+  xp.setOnes();  // Ones are better than zero, to prevent devision by zero in taping
+  CppAD::Independent(xp);
+
+  // Split in variables and parameters
+  ad_vector_t x = xp.segment(0, variableDim_);
+  ad_vector_t p = xp.segment(variableDim_, parameterDim_);
+  // dependent variable vector
+  ad_vector_t y;
+  // the model equation
+  adFunction_(x, p, y);
+  rangeDim_ = y.rows();
+  // create f: xp -> y and stop tape recording
+  auto& fun = generator->fun;
+  fun.Dependent(xp, y);
+  // Optimize the operation sequence
+  fun.optimize();
+
+  // generates source code
+  generator->sourceGen.reset(new CppAD::cg::ModelCSourceGen<scalar_t>(fun, modelName_));
+  setApproximationOrder(approximationOrder, *generator->sourceGen, fun);
+
+  // Compiler objects, compile to temporary shared library file to avoid interference between processes
+  generator->libraryCSourceGen.reset(new CppAD::cg::ModelLibraryCSourceGen<scalar_t>(*generator->sourceGen));
+  generator->libraryProcessor.reset(new HashingLibraryProcessor(*generator->libraryCSourceGen, libraryName_ + tmpName_));
+  setCompilerOptions(generator->gccCompiler);
+
+  // The cache key covers the tape signature, the compiler with its flags, and the generated sources
+  SourceHash hash;
+  hash.add(variableDim_);
+  hash.add(parameterDim_);
+  hash.add(rangeDim_);
+  hash.add(fun.size_var());
+  hash.add(fun.size_op());
+  hash.add(generator->gccCompiler.getCompilerPath());
+  for (const auto& flags : {generator->gccCompiler.getCompileFlags(), generator->gccCompiler.getCompileLibFlags(),
+                            generator->gccCompiler.getLinkFlags()}) {
+    hash.add(flags.size());
+    for (const auto& flag : flags) {
+      hash.add(flag);
+    }
+  }
+  generator->libraryProcessor->addSources(*generator->sourceGen, hash);
+  generator->hash = hash.toString();
+
+  return generator;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::compileModels(ModelGenerator& generator, bool verbose) {
+  createFolderStructure();
+
+  if (verbose) {
+    std::cerr << "[CppAdInterface] Compiling Shared Library: "
+              << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
+  }
+
+  // Compile and store the library
+  setModelLibrary(createModelLibrary(generator.libraryProcessor->createDynamicLibrary(generator.gccCompiler)));
+
+  // Rename generated library after loading. The old hash is removed first such that an interrupted renaming invalidates the cache.
+  if (verbose) {
+    std::cerr << "[CppAdInterface] Renaming " << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << " to "
+              << libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
+  }
+  boost::filesystem::remove(libraryName_ + hashExtension);
+  boost::filesystem::rename(libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION,
+                            libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION);
+  writeLibraryHash(generator.hash);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::compileModelsConcurrently(const std::vector<CppAdInterface*>& interfaces,
+                                               const std::vector<std::unique_ptr<ModelGenerator>>& generators, bool verbose) {
+  auto compile = [&](size_t i) {
+    CompilationJobGuard jobGuard(getCompilationJobLimit());
+    interfaces[i]->compileModels(*generators[i], verbose);
+  };
+
+  if (interfaces.size() == 1) {
+    compile(0);
+    return;
+  }
+
+  // The compilation only runs the compiler and loads the library, it does not touch the CppAD tape.
+  std::vector<std::future<void>> compilations;
+  compilations.reserve(interfaces.size());
+  for (size_t i = 0; i < interfaces.size(); i++) {
+    compilations.push_back(std::async(std::launch::async, compile, i));
+  }
+
+  // Wait for all compilations before rethrowing, since they refer to the generators
+  std::exception_ptr exceptionPtr;
+  for (auto& compilation : compilations) {
+    try {
+      compilation.get();
+    } catch (...) {
+      if (!exceptionPtr) {
+        exceptionPtr = std::current_exception();
+      }
+    }
+  }
+  if (exceptionPtr) {
+    std::rethrow_exception(exceptionPtr);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::string CppAdInterface::readLibraryHash() const {
+  std::string hash;
+  std::ifstream hashFile(libraryName_ + hashExtension);
+  if (hashFile.is_open()) {
+    std::getline(hashFile, hash);
+  }
+  return hash;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::writeLibraryHash(const std::string& hash) const {
+  // Write to a temporary file first such that other processes never read a partial hash
+  const std::string tmpHashFileName = libraryName_ + tmpName_ + hashExtension;
+  {
+    std::ofstream hashFile(tmpHashFileName);
+    hashFile << hash << std::endl;
+  }
+  boost::filesystem::rename(tmpHashFileName, libraryName_ + hashExtension);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -366,12 +683,47 @@ void CppAdInterface::setApproximationOrder(ApproximationOrder approximationOrder
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void CppAdInterface::setSparsityNonzeros() {
-  if (model_->isJacobianSparsityAvailable()) {
-    nnzJacobian_ = cppad_sparsity::getNumberOfNonZeros(model_->JacobianSparsitySet());
+std::shared_ptr<CppAdInterface::ModelLibrary> CppAdInterface::createModelLibrary(
+    std::unique_ptr<CppAD::cg::DynamicLib<scalar_t>> dynamicLib) const {
+  auto modelLibrary = std::make_shared<ModelLibrary>();
+  modelLibrary->dynamicLib = std::move(dynamicLib);
+
+  // The library is not shared yet, the temporary model does not need to be guarded
+  const auto model = modelLibrary->dynamicLib->model(modelName_);
+  modelLibrary->rangeDim = model->Range();
+  if (model->isJacobianSparsityAvailable()) {
+    modelLibrary->nnzJacobian = cppad_sparsity::getNumberOfNonZeros(model->JacobianSparsitySet());
+  }
+  if (model->isHessianSparsityAvailable()) {
+    modelLibrary->nnzHessian = cppad_sparsity::getNumberOfNonZeros(model->HessianSparsitySet());
   }
-  if (model_->isHessianSparsityAvailable()) {
-    nnzHessian_ = cppad_sparsity::getNumberOfNonZeros(model_->HessianSparsitySet());
+
+  return modelLibrary;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::setModelLibrary(std::shared_ptr<ModelLibrary> modelLibrary) {
+  releaseModel();
+
+  modelLibrary_ = std::move(modelLibrary);
+  {
+    std::lock_guard<std::mutex> lock(modelLibrary_->modelMutex);
+    model_ = modelLibrary_->dynamicLib->model(modelName_);
+  }
+  rangeDim_ = modelLibrary_->rangeDim;
+  nnzJacobian_ = modelLibrary_->nnzJacobian;
+  nnzHessian_ = modelLibrary_->nnzHessian;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::releaseModel() {
+  if (model_ != nullptr) {
+    std::lock_guard<std::mutex> lock(modelLibrary_->modelMutex);
+    model_.reset();
   }
 }
 
@@ -70,7 +70,7 @@ StateConstraintCppAd::StateConstraintCppAd(const StateConstraintCppAd& rhs)
 vector_t StateConstraintCppAd::getValue(scalar_t time, const vector_t& state, const PreComputation&) const {
   vector_t tapedTimeState(1 + state.rows());
   tapedTimeState << time, state;
-  return adInterfacePtr_->getFunctionValue(tapedTimeState, getParameters(time));
+  return adInterfacePtr_->getFunctionValue(tapedTimeState, getParameters(time), adWorkspace_);
 }
 
 /******************************************************************************************************/
@@ -85,8 +85,8 @@ VectorFunctionLinearApproximation StateConstraintCppAd::getLinearApproximation(s
   vector_t tapedTimeState(1 + stateDim);
   tapedTimeState << time, state;
 
-  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params);
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeState, params);
+  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params, adWorkspace_);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeState, params, adWorkspace_);
   constraint.dfdx = J.rightCols(stateDim);
 
   return constraint;
@@ -108,8 +108,8 @@ VectorFunctionQuadraticApproximation StateConstraintCppAd::getQuadraticApproxima
   vector_t tapedTimeState(1 + stateDim);
   tapedTimeState << time, state;
 
-  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params);
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeState, params);
+  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params, adWorkspace_);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeState, params, adWorkspace_);
   constraint.dfdx = J.rightCols(stateDim);
 
   const size_t numConstraints = constraint.f.rows();
@@ -117,7 +117,7 @@ VectorFunctionQuadraticApproximation StateConstraintCppAd::getQuadraticApproxima
   constraint.dfdux.resize(numConstraints);
   constraint.dfduu.resize(numConstraints);
   for (int i = 0; i < numConstraints; i++) {
-    const matrix_t H = adInterfacePtr_->getHessian(i, tapedTimeState, params);
+    const matrix_t& H = adInterfacePtr_->getHessian(i, tapedTimeState, params, adWorkspace_);
     constraint.dfdxx[i] = H.bottomRightCorner(stateDim, stateDim);
   }
 
@@ -87,18 +87,14 @@ vector_t StateInputConstraintCollection::getValue(scalar_t time, const vector_t&
 VectorFunctionLinearApproximation StateInputConstraintCollection::getLinearApproximation(scalar_t time, const vector_t& state,
                                                                                          const vector_t& input,
                                                                                          const PreComputation& preComp) const {
-  VectorFunctionLinearApproximation linearApproximation(getNumConstraints(time), state.rows(), input.rows());
+  auto linearApproximation = VectorFunctionLinearApproximation::Zero(getNumConstraints(time), state.rows(), input.rows());
 
-  // append linearApproximation of each constraintTerm
+  // fill in the rows of each constraintTerm
   size_t i = 0;
   for (const auto& constraintTerm : this->terms_) {
     if (constraintTerm->isActive(time)) {
-      const auto constraintTermApproximation = constraintTerm->getLinearApproximation(time, state, input, preComp);
-      const size_t nc = constraintTermApproximation.f.rows();
-      linearApproximation.f.segment(i, nc) = constraintTermApproximation.f;
-      linearApproximation.dfdx.middleRows(i, nc) = constraintTermApproximation.dfdx;
-      linearApproximation.dfdu.middleRows(i, nc) = constraintTermApproximation.dfdu;
-      i += nc;
+      constraintTerm->fillLinearApproximation(time, state, input, preComp, i, linearApproximation);
+      i += constraintTerm->getNumConstraints(time);
     }
   }
 
@@ -71,7 +71,7 @@ StateInputConstraintCppAd::StateInputConstraintCppAd(const StateInputConstraintC
 vector_t StateInputConstraintCppAd::getValue(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation&) const {
   vector_t tapedTimeStateInput(1 + state.rows() + input.rows());
   tapedTimeStateInput << time, state, input;
-  return adInterfacePtr_->getFunctionValue(tapedTimeStateInput, getParameters(time));
+  return adInterfacePtr_->getFunctionValue(tapedTimeStateInput, getParameters(time), adWorkspace_);
 }
 
 /******************************************************************************************************/
@@ -87,8 +87,8 @@ VectorFunctionLinearApproximation StateInputConstraintCppAd::getLinearApproximat
   vector_t tapedTimeStateInput(1 + stateDim + inputDim);
   tapedTimeStateInput << time, state, input;
 
-  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params);
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params);
+  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params, adWorkspace_);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params, adWorkspace_);
   constraint.dfdx = J.middleCols(1, stateDim);
   constraint.dfdu = J.rightCols(inputDim);
 
@@ -113,8 +113,8 @@ VectorFunctionQuadraticApproximation StateInputConstraintCppAd::getQuadraticAppr
   vector_t tapedTimeStateInput(1 + stateDim + inputDim);
   tapedTimeStateInput << time, state, input;
 
-  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params);
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params);
+  constraint.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params, adWorkspace_);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params, adWorkspace_);
   constraint.dfdx = J.middleCols(1, stateDim);
   constraint.dfdu = J.rightCols(inputDim);
 
@@ -123,7 +123,7 @@ VectorFunctionQuadraticApproximation StateInputConstraintCppAd::getQuadraticAppr
   constraint.dfdux.resize(numConstraints);
   constraint.dfduu.resize(numConstraints);
   for (int i = 0; i < numConstraints; i++) {
-    const matrix_t H = adInterfacePtr_->getHessian(i, tapedTimeStateInput, params);
+    const matrix_t& H = adInterfacePtr_->getHessian(i, tapedTimeStateInput, params, adWorkspace_);
     constraint.dfdxx[i] = H.block(1, 1, stateDim, stateDim);
     constraint.dfdux[i] = H.block(1 + stateDim, 1, inputDim, stateDim);
     constraint.dfduu[i] = H.bottomRightCorner(inputDim, inputDim);
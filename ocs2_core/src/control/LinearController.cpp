@@ -77,13 +77,28 @@ void LinearController::setController(const scalar_array_t& controllerTime, const
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t LinearController::computeInput(scalar_t t, const vector_t& x) {
-  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_);
+  vector_t u;
+  computeInput(t, x, u);
+  return u;
+}
 
-  vector_t uff = LinearInterpolation::interpolate(indexAlpha, biasArray_);
-  const matrix_t k = LinearInterpolation::interpolate(indexAlpha, gainArray_);
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LinearController::computeInput(scalar_t t, const vector_t& x, vector_t& u) {
+  const auto indexAlpha = timeSegmentCursor_.timeSegment(t, timeStamp_);
+  const int index = indexAlpha.first;
+  const scalar_t alpha = indexAlpha.second;
 
-  uff.noalias() += k * x;
-  return uff;
+  if (gainArray_.size() > 1 && gainArray_[index].rows() == gainArray_[index + 1].rows() &&
+      gainArray_[index].cols() == gainArray_[index + 1].cols()) {
+    // the lazy product evaluates the interpolated gain coefficient-wise instead of forming it
+    u = alpha * biasArray_[index] + (scalar_t(1.0) - alpha) * biasArray_[index + 1];
+    u.noalias() += (alpha * gainArray_[index] + (scalar_t(1.0) - alpha) * gainArray_[index + 1]).lazyProduct(x);
+  } else {
+    u = LinearInterpolation::interpolate(indexAlpha, biasArray_);
+    u.noalias() += LinearInterpolation::interpolate(indexAlpha, gainArray_) * x;
+  }
 }
 
 /******************************************************************************************************/
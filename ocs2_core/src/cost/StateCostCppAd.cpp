@@ -65,7 +65,7 @@ scalar_t StateCostCppAd::getValue(scalar_t time, const vector_t& state, const Ta
                                   const PreComputation&) const {
   vector_t tapedTimeState(1 + state.rows());
   tapedTimeState << time, state;
-  return adInterfacePtr_->getFunctionValue(tapedTimeState, getParameters(time, targetTrajectories))(0);
+  return adInterfacePtr_->getFunctionValue(tapedTimeState, getParameters(time, targetTrajectories), adWorkspace_)(0);
 }
 
 /******************************************************************************************************/
@@ -81,12 +81,12 @@ ScalarFunctionQuadraticApproximation StateCostCppAd::getQuadraticApproximation(s
   vector_t tapedTimeState(1 + stateDim);
   tapedTimeState << time, state;
 
-  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params)(0);
+  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params, adWorkspace_)(0);
 
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeState, params);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeState, params, adWorkspace_);
   cost.dfdx = J.rightCols(stateDim).transpose();
 
-  const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeState, params);
+  const matrix_t& H = adInterfacePtr_->getHessian(0, tapedTimeState, params, adWorkspace_);
   cost.dfdxx = H.bottomRightCorner(stateDim, stateDim);
 
   return cost;
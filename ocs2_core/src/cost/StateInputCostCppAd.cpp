@@ -66,7 +66,7 @@ scalar_t StateInputCostCppAd::getValue(scalar_t time, const vector_t& state, con
                                        const TargetTrajectories& targetTrajectories, const PreComputation&) const {
   vector_t tapedTimeStateInput(1 + state.rows() + input.rows());
   tapedTimeStateInput << time, state, input;
-  return adInterfacePtr_->getFunctionValue(tapedTimeStateInput, getParameters(time, targetTrajectories))(0);
+  return adInterfacePtr_->getFunctionValue(tapedTimeStateInput, getParameters(time, targetTrajectories), adWorkspace_)(0);
 }
 
 /******************************************************************************************************/
@@ -84,13 +84,13 @@ ScalarFunctionQuadraticApproximation StateInputCostCppAd::getQuadraticApproximat
   vector_t tapedTimeStateInput(1 + stateDim + inputDim);
   tapedTimeStateInput << time, state, input;
 
-  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params)(0);
+  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params, adWorkspace_)(0);
 
-  const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params);
+  const matrix_t& J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params, adWorkspace_);
   cost.dfdx = J.middleCols(1, stateDim).transpose();
   cost.dfdu = J.rightCols(inputDim).transpose();
 
-  const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeStateInput, params);
+  const matrix_t& H = adInterfacePtr_->getHessian(0, tapedTimeStateInput, params, adWorkspace_);
   cost.dfdxx = H.block(1, 1, stateDim, stateDim);
   cost.dfdux = H.block(1 + stateDim, 1, inputDim, stateDim);
   cost.dfduu = H.bottomRightCorner(inputDim, inputDim);
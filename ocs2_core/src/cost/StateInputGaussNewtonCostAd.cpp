@@ -66,7 +66,7 @@ scalar_t StateInputCostGaussNewtonAd::getValue(scalar_t time, const vector_t& st
   vector_t timeStateInput(1 + state.rows() + input.rows());
   timeStateInput << time, state, input;
   const auto parameters = getParameters(time, targetTrajectories);
-  const auto costVector = adInterfacePtr_->getFunctionValue(timeStateInput, parameters);
+  const auto& costVector = adInterfacePtr_->getFunctionValue(timeStateInput, parameters, adWorkspace_);
   return 0.5 * costVector.squaredNorm();
 }
 
@@ -82,7 +82,7 @@ ScalarFunctionQuadraticApproximation StateInputCostGaussNewtonAd::getQuadraticAp
   vector_t timeStateInput(1 + stateDim + inputDim);
   timeStateInput << time, state, input;
   const auto parameters = getParameters(time, targetTrajectories);
-  const auto gnApproximation = adInterfacePtr_->getGaussNewtonApproximation(timeStateInput, parameters);
+  const auto& gnApproximation = adInterfacePtr_->getGaussNewtonApproximation(timeStateInput, parameters, adWorkspace_);
 
   ScalarFunctionQuadraticApproximation L;
   L.f = gnApproximation.f;
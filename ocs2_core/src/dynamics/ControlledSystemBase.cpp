@@ -50,8 +50,8 @@ ControlledSystemBase::ControlledSystemBase(const ControlledSystemBase& other) :
 /******************************************************************************************************/
 vector_t ControlledSystemBase::computeFlowMap(scalar_t t, const vector_t& x) {
   assert(controllerPtr_ != nullptr);
-  const vector_t u = controllerPtr_->computeInput(t, x);
-  return computeFlowMap(t, x, u);
+  controllerPtr_->computeInput(t, x, input_);
+  return computeFlowMap(t, x, input_);
 }
 
 /******************************************************************************************************/
@@ -45,10 +45,7 @@ SystemDynamicsBaseAD::SystemDynamicsBaseAD(const SystemDynamicsBaseAD& rhs)
       jumpMapADInterfacePtr_(new CppAdInterface(*rhs.jumpMapADInterfacePtr_)),
       guardSurfacesADInterfacePtr_(new CppAdInterface(*rhs.guardSurfacesADInterfacePtr_)),
       tapedTimeStateInput_(rhs.tapedTimeStateInput_.size()),
-      tapedTimeState_(rhs.tapedTimeState_.size()),
-      flowJacobian_(rhs.flowJacobian_.rows(), rhs.flowJacobian_.cols()),
-      jumpJacobian_(rhs.jumpJacobian_.rows(), rhs.jumpJacobian_.cols()),
-      guardJacobian_(rhs.guardJacobian_.rows(), rhs.guardJacobian_.cols()) {}
+      tapedTimeState_(rhs.tapedTimeState_.size()) {}
 
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -82,14 +79,12 @@ void SystemDynamicsBaseAD::initialize(size_t stateDim, size_t inputDim, const st
   guardSurfacesADInterfacePtr_.reset(
       new CppAdInterface(guardSurfaces, 1 + stateDim, getNumGuardSurfacesParameters(), modelName + "_guard_surfaces", modelFolder));
 
+  const std::vector<CppAdInterface*> adInterfaces{flowMapADInterfacePtr_.get(), jumpMapADInterfacePtr_.get(),
+                                                  guardSurfacesADInterfacePtr_.get()};
   if (recompileLibraries) {
-    flowMapADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    jumpMapADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    guardSurfacesADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::createModels(adInterfaces, CppAdInterface::ApproximationOrder::First, verbose);
   } else {
-    flowMapADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    jumpMapADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    guardSurfacesADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::loadModelsIfAvailable(adInterfaces, CppAdInterface::ApproximationOrder::First, verbose);
   }
 }
 
@@ -99,7 +94,7 @@ void SystemDynamicsBaseAD::initialize(size_t stateDim, size_t inputDim, const st
 vector_t SystemDynamicsBaseAD::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) {
   tapedTimeStateInput_ << t, x, u;
   const vector_t parameters = getFlowMapParameters(t);
-  return flowMapADInterfacePtr_->getFunctionValue(tapedTimeStateInput_, parameters);
+  return flowMapADInterfacePtr_->getFunctionValue(tapedTimeStateInput_, parameters, flowMapWorkspace_);
 }
 
 /*******************q**********************************************************************************/
@@ -108,7 +103,7 @@ vector_t SystemDynamicsBaseAD::computeFlowMap(scalar_t t, const vector_t& x, con
 vector_t SystemDynamicsBaseAD::computeJumpMap(scalar_t t, const vector_t& x, const PreComputation&) {
   tapedTimeState_ << t, x;
   const vector_t parameters = getJumpMapParameters(t);
-  return jumpMapADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters);
+  return jumpMapADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters, jumpMapWorkspace_);
 }
 
 /******************************************************************************************************/
@@ -117,23 +112,31 @@ vector_t SystemDynamicsBaseAD::computeJumpMap(scalar_t t, const vector_t& x, con
 vector_t SystemDynamicsBaseAD::computeGuardSurfaces(scalar_t t, const vector_t& x) {
   tapedTimeState_ << t, x;
   const vector_t parameters = getGuardSurfacesParameters(t);
-  return guardSurfacesADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters);
+  return guardSurfacesADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters, guardSurfacesWorkspace_);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 VectorFunctionLinearApproximation SystemDynamicsBaseAD::linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
-                                                                            const PreComputation&) {
+                                                                            const PreComputation& preComp) {
+  VectorFunctionLinearApproximation approximation;
+  linearApproximationInPlace(t, x, u, preComp, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SystemDynamicsBaseAD::linearApproximationInPlace(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&,
+                                                      VectorFunctionLinearApproximation& approximation) {
   tapedTimeStateInput_ << t, x, u;
   const vector_t parameters = getFlowMapParameters(t);
-  flowJacobian_ = flowMapADInterfacePtr_->getJacobian(tapedTimeStateInput_, parameters);
+  const matrix_t& flowJacobian = flowMapADInterfacePtr_->getJacobian(tapedTimeStateInput_, parameters, flowMapWorkspace_);
 
-  VectorFunctionLinearApproximation approximation;
-  approximation.dfdx = flowJacobian_.middleCols(1, x.rows());
-  approximation.dfdu = flowJacobian_.rightCols(u.rows());
-  approximation.f = flowMapADInterfacePtr_->getFunctionValue(tapedTimeStateInput_, parameters);
-  return approximation;
+  approximation.dfdx = flowJacobian.middleCols(1, x.rows());
+  approximation.dfdu = flowJacobian.rightCols(u.rows());
+  approximation.f = flowMapADInterfacePtr_->getFunctionValue(tapedTimeStateInput_, parameters, flowMapWorkspace_);
 }
 
 /******************************************************************************************************/
@@ -142,12 +145,12 @@ VectorFunctionLinearApproximation SystemDynamicsBaseAD::linearApproximation(scal
 VectorFunctionLinearApproximation SystemDynamicsBaseAD::jumpMapLinearApproximation(scalar_t t, const vector_t& x, const PreComputation&) {
   tapedTimeState_ << t, x;
   const vector_t parameters = getJumpMapParameters(t);
-  jumpJacobian_ = jumpMapADInterfacePtr_->getJacobian(tapedTimeState_, parameters);
+  const matrix_t& jumpJacobian = jumpMapADInterfacePtr_->getJacobian(tapedTimeState_, parameters, jumpMapWorkspace_);
 
   VectorFunctionLinearApproximation approximation;
-  approximation.dfdx = jumpJacobian_.rightCols(x.rows());
-  approximation.dfdu.setZero(jumpJacobian_.rows(), 0);
-  approximation.f = jumpMapADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters);
+  approximation.dfdx = jumpJacobian.rightCols(x.rows());
+  approximation.dfdu.setZero(jumpJacobian.rows(), 0);
+  approximation.f = jumpMapADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters, jumpMapWorkspace_);
   return approximation;
 }
 
@@ -157,12 +160,12 @@ VectorFunctionLinearApproximation SystemDynamicsBaseAD::jumpMapLinearApproximati
 VectorFunctionLinearApproximation SystemDynamicsBaseAD::guardSurfacesLinearApproximation(scalar_t t, const vector_t& x, const vector_t& u) {
   tapedTimeState_ << t, x;
   const vector_t parameters = getGuardSurfacesParameters(t);
-  guardJacobian_ = guardSurfacesADInterfacePtr_->getJacobian(tapedTimeState_, parameters);
+  const matrix_t& guardJacobian = guardSurfacesADInterfacePtr_->getJacobian(tapedTimeState_, parameters, guardSurfacesWorkspace_);
 
   VectorFunctionLinearApproximation approximation;
-  approximation.dfdx = guardJacobian_.rightCols(x.rows());
-  approximation.dfdu = matrix_t::Zero(guardJacobian_.rows(), u.rows());  // not provided
-  approximation.f = guardSurfacesADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters);
+  approximation.dfdx = guardJacobian.rightCols(x.rows());
+  approximation.dfdu = matrix_t::Zero(guardJacobian.rows(), u.rows());  // not provided
+  approximation.f = guardSurfacesADInterfacePtr_->getFunctionValue(tapedTimeState_, parameters, guardSurfacesWorkspace_);
   return approximation;
 }
 
@@ -170,21 +173,21 @@ VectorFunctionLinearApproximation SystemDynamicsBaseAD::guardSurfacesLinearAppro
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t SystemDynamicsBaseAD::flowMapDerivativeTime(scalar_t t, const vector_t& x, const vector_t& u) {
-  return flowJacobian_.leftCols(1);
+  return flowMapWorkspace_.jacobian.leftCols(1);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t SystemDynamicsBaseAD::jumpMapDerivativeTime(scalar_t t, const vector_t& x, const vector_t& u) {
-  return jumpJacobian_.leftCols(1);
+  return jumpMapWorkspace_.jacobian.leftCols(1);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t SystemDynamicsBaseAD::guardSurfacesDerivativeTime(scalar_t t, const vector_t& x, const vector_t& u) {
-  return guardJacobian_.leftCols(1);
+  return guardSurfacesWorkspace_.jacobian.leftCols(1);
 }
 
 /******************************************************************************************************/
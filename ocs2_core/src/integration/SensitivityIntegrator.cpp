@@ -35,6 +35,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+namespace {
+// Function pointer types to pick between the overloads of the discretization functions
+using SensitivityDiscretizationFunction = VectorFunctionLinearApproximation (*)(SystemDynamicsBase&, scalar_t, const vector_t&,
+                                                                                const vector_t&, scalar_t);
+using SensitivityDiscretizationInPlaceFunction = void (*)(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t,
+                                                          SensitivityDiscretizationWorkspace&, VectorFunctionLinearApproximation&);
+}  // namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -57,11 +65,27 @@ DynamicsDiscretizer selectDynamicsDiscretization(SensitivityIntegratorType integ
 DynamicsSensitivityDiscretizer selectDynamicsSensitivityDiscretization(SensitivityIntegratorType integratorType) {
   switch (integratorType) {
     case SensitivityIntegratorType::EULER:
-      return eulerSensitivityDiscretization;
+      return SensitivityDiscretizationFunction(eulerSensitivityDiscretization);
+    case SensitivityIntegratorType::RK2:
+      return SensitivityDiscretizationFunction(rk2SensitivityDiscretization);
+    case SensitivityIntegratorType::RK4:
+      return SensitivityDiscretizationFunction(rk4SensitivityDiscretization);
+    default:
+      throw std::runtime_error("Integrator of type " + sensitivity_integrator::toString(integratorType) + " not supported.");
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+DynamicsSensitivityDiscretizerInPlace selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType integratorType) {
+  switch (integratorType) {
+    case SensitivityIntegratorType::EULER:
+      return SensitivityDiscretizationInPlaceFunction(eulerSensitivityDiscretization);
     case SensitivityIntegratorType::RK2:
-      return rk2SensitivityDiscretization;
+      return SensitivityDiscretizationInPlaceFunction(rk2SensitivityDiscretization);
     case SensitivityIntegratorType::RK4:
-      return rk4SensitivityDiscretization;
+      return SensitivityDiscretizationInPlaceFunction(rk4SensitivityDiscretization);
     default:
       throw std::runtime_error("Integrator of type " + sensitivity_integrator::toString(integratorType) + " not supported.");
   }
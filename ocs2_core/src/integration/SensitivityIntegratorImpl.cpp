@@ -45,16 +45,26 @@ vector_t eulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vecto
 /******************************************************************************************************/
 VectorFunctionLinearApproximation eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
                                                                  const vector_t& u, scalar_t dt) {
+  SensitivityDiscretizationWorkspace workspace;
+  VectorFunctionLinearApproximation approximation;
+  eulerSensitivityDiscretization(system, t, x, u, dt, workspace, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                    SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation) {
   // x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
   // A_{k} = Id + dt * dfdx
   // B_{k} = dt * dfdu
   // b_{k} = x_{n} + dt * f(x_{n},u_{n})
-  auto continuousApproximation = system.linearApproximation(t, x, u);
-  continuousApproximation.dfdx *= dt;
-  continuousApproximation.dfdx.diagonal().array() += 1.0;  // plus Identity()
-  continuousApproximation.dfdu *= dt;
-  continuousApproximation.f = x + dt * continuousApproximation.f;
-  return continuousApproximation;
+  system.linearApproximationInPlace(t, x, u, workspace.k1);
+  approximation.dfdx = dt * workspace.k1.dfdx;
+  approximation.dfdx.diagonal().array() += 1.0;  // plus Identity()
+  approximation.dfdu = dt * workspace.k1.dfdu;
+  approximation.f = x + dt * workspace.k1.f;
 }
 
 /******************************************************************************************************/
@@ -78,11 +88,27 @@ vector_t rk2Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 /******************************************************************************************************/
 VectorFunctionLinearApproximation rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt) {
+  SensitivityDiscretizationWorkspace workspace;
+  VectorFunctionLinearApproximation approximation;
+  rk2SensitivityDiscretization(system, t, x, u, dt, workspace, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation) {
   const scalar_t dt_halve = dt / 2.0;
+  auto& k1 = workspace.k1;
+  auto& k2 = workspace.k2;
+  auto& tmpV = workspace.state;
+  auto& tmp = workspace.sensitivity;
 
   // System evaluations
-  VectorFunctionLinearApproximation k1 = system.linearApproximation(t, x, u);
-  VectorFunctionLinearApproximation k2 = system.linearApproximation(t + dt, x + dt * k1.f, u);
+  system.linearApproximationInPlace(t, x, u, k1);
+  tmpV = x + dt * k1.f;
+  system.linearApproximationInPlace(t + dt, tmpV, u, k2);
 
   // Input sensitivity \dot{Su} = dfdx(t) Su + dfdu(t), with Su(0) = Zero()
   // Re-use memory from k.dfdu as dkduk
@@ -92,15 +118,14 @@ VectorFunctionLinearApproximation rk2SensitivityDiscretization(SystemDynamicsBas
   // State sensitivity \dot{Sx} = dfdx(t) Sx, with Sx(0) = Identity()
   // Re-use memory from k.dfdx as dkdxk
   // dk1dxk = k1.dfdx;
-  k2.dfdx += dt * k2.dfdx * k1.dfdx;  // need one temporary to avoid alias
+  tmp.noalias() = dt * k2.dfdx * k1.dfdx;  // need one temporary to avoid alias
+  k2.dfdx += tmp;
 
   // Assemble discrete approximation
-  // Re-use k1 to collect the result
-  k1.dfdx = dt_halve * k1.dfdx + dt_halve * k2.dfdx;
-  k1.dfdx.diagonal().array() += 1.0;  // plus Identity()
-  k1.dfdu = dt_halve * k1.dfdu + dt_halve * k2.dfdu;
-  k1.f = x + dt_halve * k1.f + dt_halve * k2.f;
-  return k1;
+  approximation.dfdx = dt_halve * k1.dfdx + dt_halve * k2.dfdx;
+  approximation.dfdx.diagonal().array() += 1.0;  // plus Identity()
+  approximation.dfdu = dt_halve * k1.dfdu + dt_halve * k2.dfdu;
+  approximation.f = x + dt_halve * k1.f + dt_halve * k2.f;
 }
 
 /******************************************************************************************************/
@@ -129,18 +154,35 @@ vector_t rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 /******************************************************************************************************/
 VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt) {
+  SensitivityDiscretizationWorkspace workspace;
+  VectorFunctionLinearApproximation approximation;
+  rk4SensitivityDiscretization(system, t, x, u, dt, workspace, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  SensitivityDiscretizationWorkspace& workspace, VectorFunctionLinearApproximation& approximation) {
   const scalar_t dt_halve = dt / 2.0;
   const scalar_t dt_sixth = dt / 6.0;
   const scalar_t dt_third = dt / 3.0;
+  auto& k1 = workspace.k1;
+  auto& k2 = workspace.k2;
+  auto& k3 = workspace.k3;
+  auto& k4 = workspace.k4;
+  auto& tmpV = workspace.state;
+  auto& tmp = workspace.sensitivity;
 
   // System evaluations
-  VectorFunctionLinearApproximation k1 = system.linearApproximation(t, x, u);
-  vector_t tmpV = x + dt_halve * k1.f;
-  VectorFunctionLinearApproximation k2 = system.linearApproximation(t + dt_halve, tmpV, u);
+  system.linearApproximationInPlace(t, x, u, k1);
+  tmpV = x + dt_halve * k1.f;
+  system.linearApproximationInPlace(t + dt_halve, tmpV, u, k2);
   tmpV = x + dt_halve * k2.f;
-  VectorFunctionLinearApproximation k3 = system.linearApproximation(t + dt_halve, tmpV, u);
+  system.linearApproximationInPlace(t + dt_halve, tmpV, u, k3);
   tmpV = x + dt * k3.f;
-  VectorFunctionLinearApproximation k4 = system.linearApproximation(t + dt, tmpV, u);
+  system.linearApproximationInPlace(t + dt, tmpV, u, k4);
 
   // Input sensitivity \dot{Su} = dfdx(t) Su + dfdu(t), with Su(0) = Zero()
   // Re-use memory from k.dfdu as dkduk
@@ -152,7 +194,7 @@ VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBas
   // State sensitivity \dot{Sx} = dfdx(t) Sx, with Sx(0) = Identity()
   // Re-use memory from k.dfdx as dkdxk
   // dk1dxk = k1.dfdx;
-  matrix_t tmp = dt_halve * k2.dfdx * k1.dfdx;  // need one temporary to avoid alias
+  tmp.noalias() = dt_halve * k2.dfdx * k1.dfdx;  // need one temporary to avoid alias
   k2.dfdx += tmp;
   tmp.noalias() = dt_halve * k3.dfdx * k2.dfdx;
   k3.dfdx += tmp;
@@ -160,12 +202,10 @@ VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBas
   k4.dfdx += tmp;
 
   // Assemble discrete approximation
-  // Re-use k1 to collect the result
-  k1.dfdx = dt_sixth * k1.dfdx + dt_third * k2.dfdx + dt_third * k3.dfdx + dt_sixth * k4.dfdx;
-  k1.dfdx.diagonal().array() += 1.0;  // plus Identity()
-  k1.dfdu = dt_sixth * k1.dfdu + dt_third * k2.dfdu + dt_third * k3.dfdu + dt_sixth * k4.dfdu;
-  k1.f = x + dt_sixth * k1.f + dt_third * k2.f + dt_third * k3.f + dt_sixth * k4.f;
-  return k1;
+  approximation.dfdx = dt_sixth * k1.dfdx + dt_third * k2.dfdx + dt_third * k3.dfdx + dt_sixth * k4.dfdx;
+  approximation.dfdx.diagonal().array() += 1.0;  // plus Identity()
+  approximation.dfdu = dt_sixth * k1.dfdu + dt_third * k2.dfdu + dt_third * k3.dfdu + dt_sixth * k4.dfdu;
+  approximation.f = x + dt_sixth * k1.f + dt_third * k2.f + dt_third * k3.f + dt_sixth * k4.f;
 }
 
 }  // namespace ocs2
\ No newline at end of file
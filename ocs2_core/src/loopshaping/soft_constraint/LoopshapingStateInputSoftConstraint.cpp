@@ -45,4 +45,14 @@ scalar_t LoopshapingStateInputSoftConstraint::getValue(scalar_t t, const vector_
   return StateInputCostCollection::getValue(t, x_system, u_system, targetTrajectories, preCompLS.getSystemPreComputation());
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LoopshapingStateInputSoftConstraint::accumulateQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u,
+                                                                           const TargetTrajectories& targetTrajectories,
+                                                                           const PreComputation& preComp,
+                                                                           ScalarFunctionQuadraticApproximation& approximation) const {
+  approximation += getQuadraticApproximation(t, x, u, targetTrajectories, preComp);
+}
+
 }  // namespace ocs2
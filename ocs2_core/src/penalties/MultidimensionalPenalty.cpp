@@ -138,7 +138,30 @@ scalar_t MultidimensionalPenalty::getValue(scalar_t t, const vector_t& h, const
 ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApproximation(scalar_t t,
                                                                                         const VectorFunctionLinearApproximation& h,
                                                                                         const vector_t* l) const {
-  const auto stateDim = h.dfdx.cols();
+  // to make sure that dfdux in the state-only case has a right size
+  auto penaltyApproximation = ScalarFunctionQuadraticApproximation::Zero(h.dfdx.cols(), h.dfdu.cols());
+  accumulateQuadraticApproximation(t, h, penaltyApproximation, l);
+  return penaltyApproximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApproximation(scalar_t t,
+                                                                                        const VectorFunctionQuadraticApproximation& h,
+                                                                                        const vector_t* l) const {
+  // to make sure that dfdux in the state-only case has a right size
+  auto penaltyApproximation = ScalarFunctionQuadraticApproximation::Zero(h.dfdx.cols(), h.dfdu.cols());
+  accumulateQuadraticApproximation(t, h, penaltyApproximation, l);
+  return penaltyApproximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MultidimensionalPenalty::accumulateQuadraticApproximation(scalar_t t, const VectorFunctionLinearApproximation& h,
+                                                               ScalarFunctionQuadraticApproximation& approximation,
+                                                               const vector_t* l) const {
   const auto inputDim = h.dfdu.cols();
 
   scalar_t penaltyValue = 0.0;
@@ -146,28 +169,22 @@ ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApprox
   std::tie(penaltyValue, penaltyDerivative, penaltySecondDerivative) = getPenaltyValue1stDev2ndDev(t, h.f, l);
   const matrix_t penaltySecondDev_dhdx = penaltySecondDerivative.asDiagonal() * h.dfdx;
 
-  // to make sure that dfdux in the state-only case has a right size
-  ScalarFunctionQuadraticApproximation penaltyApproximation(stateDim, inputDim);
-
-  penaltyApproximation.f = penaltyValue;
-  penaltyApproximation.dfdx.noalias() = h.dfdx.transpose() * penaltyDerivative;
-  penaltyApproximation.dfdxx.noalias() = h.dfdx.transpose() * penaltySecondDev_dhdx;
+  approximation.f += penaltyValue;
+  approximation.dfdx.noalias() += h.dfdx.transpose() * penaltyDerivative;
+  approximation.dfdxx.noalias() += h.dfdx.transpose() * penaltySecondDev_dhdx;
   if (inputDim > 0) {
-    penaltyApproximation.dfdu.noalias() = h.dfdu.transpose() * penaltyDerivative;
-    penaltyApproximation.dfdux.noalias() = h.dfdu.transpose() * penaltySecondDev_dhdx;
-    penaltyApproximation.dfduu.noalias() = h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
+    approximation.dfdu.noalias() += h.dfdu.transpose() * penaltyDerivative;
+    approximation.dfdux.noalias() += h.dfdu.transpose() * penaltySecondDev_dhdx;
+    approximation.dfduu.noalias() += h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
   }
-
-  return penaltyApproximation;
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApproximation(scalar_t t,
-                                                                                        const VectorFunctionQuadraticApproximation& h,
-                                                                                        const vector_t* l) const {
-  const auto stateDim = h.dfdx.cols();
+void MultidimensionalPenalty::accumulateQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h,
+                                                               ScalarFunctionQuadraticApproximation& approximation,
+                                                               const vector_t* l) const {
   const auto inputDim = h.dfdu.cols();
   const auto numConstraints = h.f.rows();
 
@@ -176,27 +193,22 @@ ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApprox
   std::tie(penaltyValue, penaltyDerivative, penaltySecondDerivative) = getPenaltyValue1stDev2ndDev(t, h.f, l);
   const matrix_t penaltySecondDev_dhdx = penaltySecondDerivative.asDiagonal() * h.dfdx;
 
-  // to make sure that dfdux in the state-only case has a right size
-  ScalarFunctionQuadraticApproximation penaltyApproximation(stateDim, inputDim);
-
-  penaltyApproximation.f = penaltyValue;
-  penaltyApproximation.dfdx.noalias() = h.dfdx.transpose() * penaltyDerivative;
-  penaltyApproximation.dfdxx.noalias() = h.dfdx.transpose() * penaltySecondDev_dhdx;
+  approximation.f += penaltyValue;
+  approximation.dfdx.noalias() += h.dfdx.transpose() * penaltyDerivative;
+  approximation.dfdxx.noalias() += h.dfdx.transpose() * penaltySecondDev_dhdx;
   for (size_t i = 0; i < numConstraints; i++) {
-    penaltyApproximation.dfdxx.noalias() += penaltyDerivative(i) * h.dfdxx[i];
+    approximation.dfdxx.noalias() += penaltyDerivative(i) * h.dfdxx[i];
   }
 
   if (inputDim > 0) {
-    penaltyApproximation.dfdu.noalias() = h.dfdu.transpose() * penaltyDerivative;
-    penaltyApproximation.dfdux.noalias() = h.dfdu.transpose() * penaltySecondDev_dhdx;
-    penaltyApproximation.dfduu.noalias() = h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
+    approximation.dfdu.noalias() += h.dfdu.transpose() * penaltyDerivative;
+    approximation.dfdux.noalias() += h.dfdu.transpose() * penaltySecondDev_dhdx;
+    approximation.dfduu.noalias() += h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
     for (size_t i = 0; i < numConstraints; i++) {
-      penaltyApproximation.dfduu.noalias() += penaltyDerivative(i) * h.dfduu[i];
-      penaltyApproximation.dfdux.noalias() += penaltyDerivative(i) * h.dfdux[i];
+      approximation.dfduu.noalias() += penaltyDerivative(i) * h.dfduu[i];
+      approximation.dfdux.noalias() += penaltyDerivative(i) * h.dfdux[i];
     }
   }
-
-  return penaltyApproximation;
 }
 
 /******************************************************************************************************/
@@ -89,4 +89,13 @@ ScalarFunctionQuadraticApproximation StateInputSoftConstraint::getQuadraticAppro
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputSoftConstraint::accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                                const TargetTrajectories&, const PreComputation& preComp,
+                                                                ScalarFunctionQuadraticApproximation& approximation) const {
+  constraintPtr_->accumulatePenaltyQuadraticApproximation(time, state, input, preComp, penalty_, approximation);
+}
+
 }  // namespace ocs2
@@ -32,10 +32,28 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+namespace {
+// The pool and the worker index of the current thread. Used to push the tasks submitted by a worker to its own deque.
+thread_local const ThreadPool* currentThreadPool = nullptr;
+thread_local int currentWorkerIndex = -1;
+
+/** The block of chunks [next, end) owned by a participant of ThreadPool::parallelFor. Padded to avoid false sharing. */
+struct ChunkRange {
+  std::atomic_int next;
+  int end;
+  char padding[64 - sizeof(std::atomic_int) - sizeof(int)];
+};
+}  // unnamed namespace
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
 ThreadPool::ThreadPool(size_t nThreads, int priority) {
+  workerQueues_.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; i++) {
+    workerQueues_.emplace_back(new WorkerQueue);
+  }
+
   workerThreads_.reserve(nThreads);
   for (size_t i = 0; i < nThreads; i++) {
     workerThreads_.emplace_back(&ThreadPool::worker, this, i);
@@ -48,10 +66,10 @@ ThreadPool::ThreadPool(size_t nThreads, int priority) {
 /**************************************************************************************************/
 ThreadPool::~ThreadPool() {
   {  // set exit flag, wake up threads and join
-    std::lock_guard<std::mutex> lock(taskQueueLock_);
+    std::lock_guard<std::mutex> lock(idleLock_);
     stop_ = true;
   }
-  taskQueueCondition_.notify_all();
+  idleCondition_.notify_all();
   for (auto& thread : workerThreads_) {
     if (thread.joinable()) {
       thread.join();
@@ -63,39 +81,77 @@ ThreadPool::~ThreadPool() {
 /**************************************************************************************************/
 /**************************************************************************************************/
 void ThreadPool::worker(int workerIndex) {
-  while (true) {
-    std::unique_ptr<ThreadPool::TaskBase> taskPtr;
-    {
-      std::unique_lock<std::mutex> lock(taskQueueLock_);
-      taskQueueCondition_.wait(lock, [this] { return !taskQueue_.empty() || stop_; });
-
-      // exit condition
-      if (stop_) {
-        break;
-      }
+  currentThreadPool = this;
+  currentWorkerIndex = workerIndex;
 
-      // pop the first task
-      if (!taskQueue_.empty()) {
-        taskPtr = std::move(taskQueue_.front());
-        taskQueue_.pop();
-      }
-    }
+  while (!stop_) {
+    auto taskPtr = popTask(workerIndex);
 
     if (taskPtr) {
       taskPtr->operator()(workerIndex);
+    } else {
+      // all deques are empty, wait for new tasks
+      std::unique_lock<std::mutex> lock(idleLock_);
+      ++numIdleWorkers_;
+      idleCondition_.wait(lock, [this] { return numPendingTasks_ > 0 || stop_; });
+      --numIdleWorkers_;
+    }
+  }
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+std::unique_ptr<ThreadPool::TaskBase> ThreadPool::popTask(int workerIndex) {
+  std::unique_ptr<TaskBase> taskPtr;
+
+  // own deque: take the most recently pushed task
+  {
+    WorkerQueue& queue = *workerQueues_[workerIndex];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.tasks.empty()) {
+      taskPtr = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+  }
+
+  // steal the oldest task of another worker
+  const size_t numQueues = workerQueues_.size();
+  for (size_t i = 1; !taskPtr && i < numQueues; i++) {
+    WorkerQueue& queue = *workerQueues_[(workerIndex + i) % numQueues];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.tasks.empty()) {
+      taskPtr = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
     }
   }
+
+  if (taskPtr) {
+    --numPendingTasks_;
+  }
+  return taskPtr;
 }
 
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
 void ThreadPool::runTask(std::unique_ptr<TaskBase> taskPtr) {
+  // a worker pushes to its own deque, other threads distribute the tasks round-robin
+  const size_t queueIndex = (currentThreadPool == this) ? currentWorkerIndex : nextQueueIndex_++ % workerQueues_.size();
+
+  // count the task before it becomes visible, such that numPendingTasks_ never underflows
+  ++numPendingTasks_;
   {
-    std::lock_guard<std::mutex> lock(taskQueueLock_);
-    taskQueue_.push(std::move(taskPtr));
+    WorkerQueue& queue = *workerQueues_[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.tasks.push_back(std::move(taskPtr));
+  }
+
+  // only touch the idle lock if a worker might be waiting on it
+  if (numIdleWorkers_ > 0) {
+    { std::lock_guard<std::mutex> lock(idleLock_); }
+    idleCondition_.notify_one();
   }
-  taskQueueCondition_.notify_one();
 }
 
 /**************************************************************************************************/
@@ -122,4 +178,65 @@ void ThreadPool::runParallel(std::function<void(int)> taskFunction, int N) {
   }
 }
 
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::parallelForImpl(int begin, int end, int grainSize, const std::function<void(int, int, int)>& chunkFunction) {
+  if (end <= begin) {
+    return;
+  }
+
+  grainSize = std::max(grainSize, 1);
+  const int numChunks = (end - begin + grainSize - 1) / grainSize;
+  const int numParticipants = std::min(static_cast<int>(numThreads()) + 1, numChunks);
+
+  // distribute the chunks in contiguous blocks over the participants
+  std::vector<ChunkRange> chunkRanges(numParticipants);
+  for (int p = 0; p < numParticipants; p++) {
+    chunkRanges[p].next = p * numChunks / numParticipants;
+    chunkRanges[p].end = (p + 1) * numChunks / numParticipants;
+  }
+
+  // process the own block first, then steal from the others
+  auto processChunks = [&](int homeIndex, int workerIndex) {
+    for (int j = 0; j < numParticipants; j++) {
+      ChunkRange& range = chunkRanges[(homeIndex + j) % numParticipants];
+      int chunk;
+      while ((chunk = range.next.fetch_add(1, std::memory_order_relaxed)) < range.end) {
+        const int chunkBegin = begin + chunk * grainSize;
+        chunkFunction(workerIndex, chunkBegin, std::min(chunkBegin + grainSize, end));
+      }
+    }
+  };
+
+  // Launch helpers, helper p starts on block p
+  std::vector<std::future<void>> futures;
+  futures.reserve(numParticipants - 1);
+  for (int p = 0; p < numParticipants - 1; p++) {
+    futures.emplace_back(run([&processChunks, p](int workerIndex) { processChunks(p, workerIndex); }));
+  }
+
+  // Execute the last block in this thread. Helpers must finish before rethrowing since they refer to this stack frame.
+  std::exception_ptr exceptionPtr;
+  try {
+    processChunks(numParticipants - 1, static_cast<int>(numThreads()));
+  } catch (...) {
+    exceptionPtr = std::current_exception();
+  }
+
+  for (auto&& fut : futures) {
+    try {
+      fut.get();
+    } catch (...) {
+      if (!exceptionPtr) {
+        exceptionPtr = std::current_exception();
+      }
+    }
+  }
+
+  if (exceptionPtr) {
+    std::rethrow_exception(exceptionPtr);
+  }
+}
+
 }  // namespace ocs2
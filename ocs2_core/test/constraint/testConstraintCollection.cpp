@@ -149,6 +149,28 @@ TEST(TestConstraintCollection, getLinearApproximation) {
   EXPECT_EQ(linearApproximation.dfdu.row(3).sum(), 2);
 }
 
+TEST(TestConstraintCollection, fillLinearApproximation) {
+  ocs2::StateInputConstraintCollection denseCollection;
+  ocs2::StateInputConstraintCollection mixedCollection;
+
+  // evaluation point
+  const double t = 0.0;
+  const ocs2::vector_t x = ocs2::vector_t::Random(3);
+  const ocs2::vector_t u = ocs2::vector_t::Random(2);
+
+  // same constraints, where the second one of the mixed collection only fills its nonzero entries
+  denseCollection.add("Constraint1", std::unique_ptr<TestDummyConstraint>(new TestDummyConstraint()));
+  denseCollection.add("Constraint2", std::unique_ptr<TestDummyConstraint>(new TestDummyConstraint()));
+  mixedCollection.add("Constraint1", std::unique_ptr<TestDummyConstraint>(new TestDummyConstraint()));
+  mixedCollection.add("Constraint2", std::unique_ptr<TestSparseDummyConstraint>(new TestSparseDummyConstraint()));
+
+  const auto denseApproximation = denseCollection.getLinearApproximation(t, x, u, ocs2::PreComputation());
+  const auto mixedApproximation = mixedCollection.getLinearApproximation(t, x, u, ocs2::PreComputation());
+  EXPECT_TRUE(denseApproximation.f.isApprox(mixedApproximation.f));
+  EXPECT_TRUE(denseApproximation.dfdx.isApprox(mixedApproximation.dfdx));
+  EXPECT_TRUE(denseApproximation.dfdu.isApprox(mixedApproximation.dfdu));
+}
+
 TEST(TestConstraintCollection, getQuadraticApproximation) {
   using collection_t = ocs2::StateInputConstraintCollection;
   collection_t constraintCollection;
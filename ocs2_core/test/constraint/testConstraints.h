@@ -105,6 +105,35 @@ class TestDummyConstraint final : public ocs2::StateInputConstraint {
   bool active_ = true;
 };
 
+/** Dummy state-input constraint with 2 entries which only fills its nonzero entries into a stacked approximation */
+class TestSparseDummyConstraint final : public ocs2::StateInputConstraint {
+ public:
+  using LinearApproximation_t = ocs2::VectorFunctionLinearApproximation;
+
+  TestSparseDummyConstraint() : ocs2::StateInputConstraint(ocs2::ConstraintOrder::Linear) {}
+  ~TestSparseDummyConstraint() override = default;
+  TestSparseDummyConstraint* clone() const override { return new TestSparseDummyConstraint(*this); }
+
+  size_t getNumConstraints(ocs2::scalar_t time) const override { return 2; }
+
+  ocs2::vector_t getValue(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input,
+                          const ocs2::PreComputation&) const override {
+    return TestDummyConstraint().getValue(time, state, input, ocs2::PreComputation());
+  }
+
+  LinearApproximation_t getLinearApproximation(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input,
+                                               const ocs2::PreComputation&) const override {
+    return TestDummyConstraint().getLinearApproximation(time, state, input, ocs2::PreComputation());
+  }
+
+  void fillLinearApproximation(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input, const ocs2::PreComputation&,
+                               size_t rowOffset, LinearApproximation_t& stackedApproximation) const override {
+    stackedApproximation.f.segment(rowOffset, 2) = getValue(time, state, input, ocs2::PreComputation());
+    stackedApproximation.dfdx.row(rowOffset + 1).setOnes();
+    stackedApproximation.dfdu.row(rowOffset + 1).setOnes();
+  }
+};
+
 /** Dummy state-only constraint with 2 entries */
 class TestDummyStateConstraint final : public ocs2::StateConstraint {
  public:
@@ -24,3 +24,19 @@ TEST(testLinearController, testSerialization) {
     EXPECT_TRUE(controller.biasArray_[k].isApprox(controllerOut.biasArray_[k], 1e-6));
   }
 }
+
+TEST(testLinearController, testComputeInput) {
+  scalar_array_t time = {0.0, 0.5, 0.5, 1.0};
+  vector_array_t bias = {vector_t::Random(2), vector_t::Random(2), vector_t::Random(2), vector_t::Random(2)};
+  matrix_array_t gain = {matrix_t::Random(2, 3), matrix_t::Random(2, 3), matrix_t::Random(2, 3), matrix_t::Random(2, 3)};
+  LinearController controller(time, bias, gain);
+
+  const vector_t x = vector_t::Random(3);
+  vector_t u;
+  for (scalar_t t = -0.1; t < 1.1; t += 0.05) {
+    const vector_t uExpected = LinearInterpolation::interpolate(t, time, bias) + LinearInterpolation::interpolate(t, time, gain) * x;
+    controller.computeInput(t, x, u);
+    EXPECT_TRUE(u.isApprox(uExpected)) << "time: " << t;
+    EXPECT_TRUE(controller.computeInput(t, x).isApprox(uExpected)) << "time: " << t;
+  }
+}
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/filesystem.hpp>
+
 #include "commonFixture.h"
 
 using namespace ocs2;
@@ -60,3 +62,116 @@ TEST_F(CppAdInterfaceParameterizedFixture, loadIfAvailable) {
   ASSERT_TRUE(gnApproximation.dfdx.isApprox(testJacobian(x, p).transpose() * testFun(x, p)));
   ASSERT_TRUE(gnApproximation.dfdxx.isApprox(testJacobian(x, p).transpose() * testJacobian(x, p)));
 }
+
+TEST_F(CppAdInterfaceParameterizedFixture, workspaceEvaluation) {
+  ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, "testModelWorkspace");
+  adInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+  ocs2::CppAdInterface adInterfaceCopy(adInterface);
+
+  // The workspace is reused across evaluation points and interfaces.
+  ocs2::CppAdInterface::Workspace workspace;
+  for (int i = 0; i < 3; i++) {
+    for (const auto* interface : {&adInterface, &adInterfaceCopy}) {
+      const vector_t x = vector_t::Random(variableDim_);
+      const vector_t p = vector_t::Random(parameterDim_);
+
+      ASSERT_TRUE(interface->getFunctionValue(x, p, workspace).isApprox(testFun(x, p)));
+      ASSERT_TRUE(interface->getJacobian(x, p, workspace).isApprox(testJacobian(x, p)));
+      ASSERT_TRUE(interface->getHessian(0, x, p, workspace).isApprox(testHessian(0, x, p)));
+      ASSERT_TRUE(interface->getHessian(1, x, p, workspace).isApprox(testHessian(1, x, p)));
+
+      const auto& gnApproximation = interface->getGaussNewtonApproximation(x, p, workspace);
+      ASSERT_DOUBLE_EQ(gnApproximation.f, 0.5 * testFun(x, p).squaredNorm());
+      ASSERT_TRUE(gnApproximation.dfdx.isApprox(testJacobian(x, p).transpose() * testFun(x, p)));
+      ASSERT_TRUE(gnApproximation.dfdxx.isApprox(testJacobian(x, p).transpose() * testJacobian(x, p)));
+    }
+  }
+}
+
+TEST_F(CppAdInterfaceParameterizedFixture, libraryCache) {
+  const std::string modelName = "testModelLibraryCache";
+  const std::string libraryFileName =
+      "/tmp/ocs2/" + modelName + "/cppad_generated/" + modelName + "_lib" + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+  boost::filesystem::remove_all("/tmp/ocs2/" + modelName);
+
+  // A recompilation is detected by the modification time of the library
+  auto markLibrary = [&]() { boost::filesystem::last_write_time(libraryFileName, 0); };
+  auto isLibraryMarked = [&]() { return boost::filesystem::last_write_time(libraryFileName) == 0; };
+
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+
+  {
+    ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, modelName);
+    adInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+    ASSERT_TRUE(adInterface.getFunctionValue(x, p).isApprox(testFun(x, p)));
+  }
+  markLibrary();
+
+  // Unchanged function: the library is reused
+  {
+    ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, modelName);
+    adInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+    EXPECT_TRUE(isLibraryMarked());
+    ASSERT_TRUE(adInterface.getJacobian(x, p).isApprox(testJacobian(x, p)));
+  }
+
+  // Changed function with the same model name: the library is recompiled
+  auto scaledFunImpl = [](const ad_vector_t& x, const ad_vector_t& p, ad_vector_t& y) {
+    funImpl(x, p, y);
+    y *= ad_scalar_t(2.0);
+  };
+  {
+    ocs2::CppAdInterface adInterface(scaledFunImpl, variableDim_, parameterDim_, modelName);
+    adInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+    EXPECT_FALSE(isLibraryMarked());
+    ASSERT_TRUE(adInterface.getFunctionValue(x, p).isApprox(2.0 * testFun(x, p)));
+  }
+  markLibrary();
+
+  // Changed compile flags: the library is recompiled
+  {
+    ocs2::CppAdInterface adInterface(scaledFunImpl, variableDim_, parameterDim_, modelName, "/tmp/ocs2", {"-O2"});
+    adInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+    EXPECT_FALSE(isLibraryMarked());
+    ASSERT_TRUE(adInterface.getFunctionValue(x, p).isApprox(2.0 * testFun(x, p)));
+  }
+}
+
+TEST_F(CppAdInterfaceParameterizedFixture, concurrentCompilation) {
+  std::vector<std::unique_ptr<ocs2::CppAdInterface>> adInterfaces;
+  for (int i = 0; i < 3; i++) {
+    adInterfaces.emplace_back(new ocs2::CppAdInterface(funImpl, variableDim_, parameterDim_, "testModelConcurrent" + std::to_string(i)));
+  }
+  std::vector<ocs2::CppAdInterface*> adInterfacePtrs;
+  for (const auto& adInterface : adInterfaces) {
+    adInterfacePtrs.push_back(adInterface.get());
+  }
+  ocs2::CppAdInterface::createModels(adInterfacePtrs, ocs2::CppAdInterface::ApproximationOrder::Second, true);
+
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+  for (const auto& adInterface : adInterfaces) {
+    ASSERT_TRUE(adInterface->getFunctionValue(x, p).isApprox(testFun(x, p)));
+    ASSERT_TRUE(adInterface->getJacobian(x, p).isApprox(testJacobian(x, p)));
+    ASSERT_TRUE(adInterface->getHessian(0, x, p).isApprox(testHessian(0, x, p)));
+  }
+}
+
+TEST_F(CppAdInterfaceParameterizedFixture, copiesShareLibrary) {
+  const std::string modelName = "testModelSharedLibrary";
+  ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, modelName);
+  adInterface.createModels(ocs2::CppAdInterface::ApproximationOrder::Second, true);
+
+  // Copies do not load the library from disk
+  boost::filesystem::remove_all("/tmp/ocs2/" + modelName);
+  std::unique_ptr<ocs2::CppAdInterface> adInterfaceCopy(new ocs2::CppAdInterface(adInterface));
+  const ocs2::CppAdInterface adInterfaceCopyOfCopy(*adInterfaceCopy);
+  adInterfaceCopy.reset();
+
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+  ASSERT_TRUE(adInterfaceCopyOfCopy.getFunctionValue(x, p).isApprox(testFun(x, p)));
+  ASSERT_TRUE(adInterfaceCopyOfCopy.getJacobian(x, p).isApprox(testJacobian(x, p)));
+  ASSERT_TRUE(adInterfaceCopyOfCopy.getHessian(1, x, p).isApprox(testHessian(1, x, p)));
+}
@@ -209,4 +209,52 @@ TEST(test_sensitivity_integrator, vsBoostRK4) {
 
   // Check
   ASSERT_TRUE(rk4ForwardDynamics.isApprox(boostRk4ForwardDynamics));
-}
\ No newline at end of file
+}
+
+TEST(test_sensitivity_integrator, inPlaceSensitivity) {
+  // The system of getSystem()
+  ocs2::matrix_t A(2, 2);
+  A << -2, -1,  // clang-format off
+      1,  0;  // clang-format on
+  ocs2::matrix_t B(2, 1);
+  B << 1, 0;
+
+  auto system = getSystem();
+  ocs2::scalar_t t = 0.5;
+  ocs2::scalar_t dt = 0.1;
+
+  // For a linear time-invariant system, the explicit Runge-Kutta methods of order p <= 4 reproduce the Taylor expansion of the exact
+  // discretization up to order p: A_{k} = sum_{j=0}^{p} (dt*A)^j / j!, B_{k} = sum_{j=1}^{p} dt^j * A^(j-1) / j! * B.
+  auto taylorDiscretization = [&](int order, const ocs2::vector_t& x, const ocs2::vector_t& u) {
+    ocs2::VectorFunctionLinearApproximation discreteApproximation;
+    ocs2::matrix_t term = ocs2::matrix_t::Identity(2, 2);  // (dt*A)^(j-1) / (j-1)!
+    discreteApproximation.dfdx = term;
+    discreteApproximation.dfdu.setZero(2, 1);
+    for (int j = 1; j <= order; ++j) {
+      discreteApproximation.dfdu += (dt / j) * term * B;
+      term = (dt / j) * term * A;
+      discreteApproximation.dfdx += term;
+    }
+    discreteApproximation.f = discreteApproximation.dfdx * x + discreteApproximation.dfdu * u;
+    return discreteApproximation;
+  };
+
+  const std::vector<std::pair<ocs2::SensitivityIntegratorType, int>> integratorOrders{
+      {ocs2::SensitivityIntegratorType::EULER, 1}, {ocs2::SensitivityIntegratorType::RK2, 2}, {ocs2::SensitivityIntegratorType::RK4, 4}};
+  for (const auto& integratorOrder : integratorOrders) {
+    auto sensitivityDiscretizationInPlace = ocs2::selectDynamicsSensitivityDiscretizationInPlace(integratorOrder.first);
+
+    // The workspace and the result are reused over several evaluations
+    ocs2::SensitivityDiscretizationWorkspace workspace;
+    ocs2::VectorFunctionLinearApproximation linearizedDynamics;
+    for (int i = 0; i < 3; ++i) {
+      const ocs2::vector_t x = ocs2::vector_t::Random(2);
+      const ocs2::vector_t u = ocs2::vector_t::Random(1);
+      const auto linearizedDynamics_check = taylorDiscretization(integratorOrder.second, x, u);
+      sensitivityDiscretizationInPlace(*system, t, x, u, dt, workspace, linearizedDynamics);
+      ASSERT_TRUE(linearizedDynamics.f.isApprox(linearizedDynamics_check.f));
+      ASSERT_TRUE(linearizedDynamics.dfdx.isApprox(linearizedDynamics_check.dfdx));
+      ASSERT_TRUE(linearizedDynamics.dfdu.isApprox(linearizedDynamics_check.dfdu));
+    }
+  }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include <ocs2_core/misc/LinearInterpolation.h>
@@ -78,6 +79,44 @@ TEST(testLinearInterpolation, testEventTimeInterpolation) {
   }
 }
 
+TEST(testLinearInterpolation, testTimeSegmentCursor) {
+  constexpr auto eps = ocs2::numeric_traits::weakEpsilon<ocs2::scalar_t>();
+  const std::vector<double> time{0.0, 0.1, 0.2, 0.2, 0.3, 0.3 + eps, 0.4, 0.5};
+
+  std::vector<double> queryTimes;
+  for (int i = -10; i <= 60; i++) {
+    queryTimes.push_back(0.01 * i);
+  }
+  queryTimes.insert(queryTimes.end(), time.begin(), time.end());
+  std::sort(queryTimes.begin(), queryTimes.end());
+
+  auto expectSameAsTimeSegment = [&](ocs2::LinearInterpolation::TimeSegmentCursor& cursor, double t) {
+    const auto expected = ocs2::LinearInterpolation::timeSegment(t, time);
+    const auto indexAlpha = cursor.timeSegment(t, time);
+    ASSERT_EQ(indexAlpha.first, expected.first) << "time: " << t;
+    ASSERT_EQ(indexAlpha.second, expected.second) << "time: " << t;
+  };
+
+  ocs2::LinearInterpolation::TimeSegmentCursor cursor;
+  // forward, backward, and jumping enquiries
+  for (auto it = queryTimes.begin(); it != queryTimes.end(); ++it) {
+    expectSameAsTimeSegment(cursor, *it);
+  }
+  for (auto it = queryTimes.rbegin(); it != queryTimes.rend(); ++it) {
+    expectSameAsTimeSegment(cursor, *it);
+  }
+  for (size_t i = 0; i < queryTimes.size(); i++) {
+    expectSameAsTimeSegment(cursor, queryTimes[(i * 37) % queryTimes.size()]);
+  }
+
+  // changing time array
+  const std::vector<double> singleTime{1.0};
+  const auto indexAlpha = cursor.timeSegment(0.5, singleTime);
+  ASSERT_EQ(indexAlpha.first, 0);
+  ASSERT_EQ(indexAlpha.second, 1.0);
+  expectSameAsTimeSegment(cursor, 0.45);
+}
+
 TEST(testLinearInterpolation, testSizeOneTime) {
   using Data_T = Eigen::Matrix<double, 2, 1>;
 
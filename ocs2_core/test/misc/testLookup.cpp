@@ -104,6 +104,22 @@ TEST(testLookup, findIntervalInTimeArray) {
   ASSERT_EQ(findIntervalInTimeArray(timeArrayEmpty, 1.0), 0);
 }
 
+TEST(testLookup, findIntervalInTimeArrayWithHint) {
+  const std::vector<std::vector<double>> timeArrays{
+      {}, {1.0}, {-1.0, 2.0, 3.0}, {-1.0, 2.0, 2.0, 2.0, 3.0}, {0.0, 0.1, 0.2, 0.2, 0.3, 0.4, 0.5, 0.5, 0.6}};
+  const std::vector<double> queryTimes{-2.0, -1.0, -0.5, 0.0, 0.05, 0.1, 0.15, 0.2, 0.25, 0.5, 0.55, 0.6, 1.0, 1.9, 2.0, 2.1, 3.0, 4.0};
+
+  // the hint must not change the result, whether it is right, a neighbour, far off or out of range
+  for (const auto& timeArray : timeArrays) {
+    for (const auto time : queryTimes) {
+      const int expected = findIntervalInTimeArray(timeArray, time);
+      for (int hint = -3; hint < static_cast<int>(timeArray.size()) + 3; hint++) {
+        ASSERT_EQ(findIntervalInTimeArray(timeArray, time, hint), expected) << "time: " << time << " hint: " << hint;
+      }
+    }
+  }
+}
+
 TEST(testLookup, findActiveIntervalInTimeArray) {
   // Normal case
   std::vector<double> timeArray{-1.0, 2.0, 3.0};
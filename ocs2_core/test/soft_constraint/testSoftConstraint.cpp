@@ -163,6 +163,36 @@ TEST(testSoftConstraint, softStateInputConstraint) {
   EXPECT_NO_THROW(stateInputQuadraticConstraintPtr->getQuadraticApproximation(0.0, state, input, targetTrajectories, preComp));
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+TEST(testSoftConstraint, accumulateQuadraticApproximation) {
+  constexpr size_t numConstraints = 10;
+  const ocs2::vector_t state = ocs2::vector_t::Random(2);
+  const ocs2::vector_t input = ocs2::vector_t::Random(1);
+  const ocs2::TargetTrajectories targetTrajectories;
+  const ocs2::PreComputation preComp;
+
+  for (const auto constraintOrder : {ocs2::ConstraintOrder::Linear, ocs2::ConstraintOrder::Quadratic}) {
+    auto softConstraintPtr =
+        softConstraintFactory<TestStateInputConstraint, ocs2::StateInputSoftConstraint>(numConstraints, constraintOrder, false);
+
+    auto expected = ocs2::ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+    expected.dfdxx.setIdentity();
+    expected.dfdu.setOnes();
+    auto accumulated = expected;
+    expected += softConstraintPtr->getQuadraticApproximation(0.0, state, input, targetTrajectories, preComp);
+    softConstraintPtr->accumulateQuadraticApproximation(0.0, state, input, targetTrajectories, preComp, accumulated);
+
+    EXPECT_DOUBLE_EQ(accumulated.f, expected.f);
+    EXPECT_TRUE(accumulated.dfdx.isApprox(expected.dfdx));
+    EXPECT_TRUE(accumulated.dfdu.isApprox(expected.dfdu));
+    EXPECT_TRUE(accumulated.dfdxx.isApprox(expected.dfdxx));
+    EXPECT_TRUE(accumulated.dfdux.isZero());
+    EXPECT_TRUE(accumulated.dfduu.isApprox(expected.dfduu));
+  }
+}
+
 class ActivityTestStateConstraint : public ocs2::StateConstraint {
  public:
   ActivityTestStateConstraint() : StateConstraint(ocs2::ConstraintOrder::Quadratic) {}
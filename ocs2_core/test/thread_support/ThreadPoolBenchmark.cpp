@@ -0,0 +1,68 @@
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+using namespace ocs2;
+
+namespace {
+/** Some work of the size of a small LQ approximation */
+scalar_t dummyNodeWork(const matrix_t& A, vector_t& x) {
+  x = A * x;
+  x.normalize();
+  return x.sum();
+}
+}  // unnamed namespace
+
+/**
+ * Compares the chunked parallelFor against runParallel with a shared atomic index, which is how the solvers used to distribute the time
+ * nodes over the workers.
+ */
+int main() {
+  constexpr int numNodes = 200;
+  constexpr int numRepetitions = 50;
+  constexpr int dim = 24;
+
+  const matrix_t A = matrix_t::Random(dim, dim);
+  vector_array_t x(numNodes, vector_t::Ones(dim));
+  scalar_array_t result(numNodes, 0.0);
+
+  std::cerr << "\n#threads | runParallel [ms] | parallelFor [ms]\n";
+  for (size_t nThreads : {1, 2, 4, 8, 16, 32}) {
+    ThreadPool pool(nThreads - 1);
+    benchmark::RepeatedTimer runParallelTimer;
+    benchmark::RepeatedTimer parallelForTimer;
+
+    for (int rep = 0; rep < numRepetitions; rep++) {
+      runParallelTimer.startTimer();
+      std::atomic_int nextIndex{0};
+      pool.runParallel(
+          [&](int) {
+            int i;
+            while ((i = nextIndex++) < numNodes) {
+              result[i] = dummyNodeWork(A, x[i]);
+            }
+          },
+          nThreads);
+      runParallelTimer.endTimer();
+
+      parallelForTimer.startTimer();
+      pool.parallelFor(0, numNodes, 1, [&](int, int i) { result[i] = dummyNodeWork(A, x[i]); });
+      parallelForTimer.endTimer();
+    }
+
+    std::cerr << nThreads << "\t | " << runParallelTimer.getAverageInMilliseconds() << "\t | "
+              << parallelForTimer.getAverageInMilliseconds() << "\n";
+  }
+
+  for (const auto& r : result) {
+    if (!std::isfinite(r)) {
+      std::cerr << "Non-finite result in the benchmark work.\n";
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -121,3 +121,80 @@ TEST(testThreadPool, testMoveOnlyTask) {
 
   EXPECT_EQ(result.get(), 3.14);
 }
+
+TEST(testThreadPool, testParallelFor) {
+  ThreadPool pool(3);
+
+  for (int grainSize : {1, 3, 7, 100}) {
+    std::vector<int> visits(101, 0);
+    pool.parallelFor(0, visits.size(), grainSize, [&](int, int i) { visits[i]++; });
+
+    for (const auto& v : visits) {
+      EXPECT_EQ(v, 1);
+    }
+  }
+}
+
+TEST(testThreadPool, testParallelForNoThreads) {
+  ThreadPool pool(0);
+  std::vector<int> visits(42, 0);
+
+  pool.parallelFor(0, visits.size(), 1, [&](int workerIndex, int i) {
+    EXPECT_EQ(workerIndex, 0);
+    visits[i]++;
+  });
+
+  for (const auto& v : visits) {
+    EXPECT_EQ(v, 1);
+  }
+}
+
+TEST(testThreadPool, testParallelForEmptyRange) {
+  ThreadPool pool(2);
+  std::atomic_int counter{0};
+
+  pool.parallelFor(5, 5, 1, [&](int, int) { counter++; });
+  pool.parallelFor(5, 2, 1, [&](int, int) { counter++; });
+
+  EXPECT_EQ(counter, 0);
+}
+
+TEST(testThreadPool, testParallelForExclusiveWorkerIndex) {
+  ThreadPool pool(3);
+  std::vector<std::atomic_int> inUse(pool.numThreads() + 1);
+  for (auto& flag : inUse) {
+    flag = 0;
+  }
+  std::atomic_bool isExclusive{true};
+
+  pool.parallelFor(0, 200, 1, [&](int workerIndex, int) {
+    ASSERT_LE(workerIndex, pool.numThreads());
+    if (inUse[workerIndex]++ != 0) {
+      isExclusive = false;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    inUse[workerIndex]--;
+  });
+
+  EXPECT_TRUE(isExclusive);
+}
+
+TEST(testThreadPool, testParallelForPropagateException) {
+  ThreadPool pool(2);
+
+  auto loopBody = [](int, int i) {
+    if (i == 17) {
+      throw std::runtime_error("exception");
+    }
+  };
+  EXPECT_THROW(pool.parallelFor(0, 42, 1, loopBody), std::runtime_error);
+}
+
+TEST(testThreadPool, testNestedRun) {
+  ThreadPool pool(2);
+
+  // a task submitted from a worker thread ends up in its own deque
+  auto fut = pool.run([&](int) { return pool.run([](int) { return 42; }).get(); });
+
+  EXPECT_EQ(fut.get(), 42);
+}
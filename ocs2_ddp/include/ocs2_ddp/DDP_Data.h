@@ -46,6 +46,9 @@ namespace ocs2 {
  *
  * There is one exception that breaks the consistency. When using an external controller to initialize the controller, it is obvious that
  * the rest of member variables are not the result of the controller. But they will be cleared and populated when runInit is called.
+ *
+ * The model data trajectories are only valid after the LQ approximation of the primal solution. A new rollout keeps their elements,
+ * since the LQ approximation overwrites them in place. This way their memory is reused across iterations and MPC calls.
  */
 struct PrimalDataContainer {
   PrimalSolution primalSolution;
@@ -106,6 +106,18 @@ struct Settings {
 
   /** If true, terms of the Riccati equation will be precomputed before interpolation in the flow-map */
   bool preComputeRiccatiTerms_ = true;
+  /**
+   * If true, ILQR computes the exact value function at the boundaries of the time partitions with a parallel-in-time scan. Otherwise,
+   * the value function of the previous iteration is used and the first iteration is solved sequentially. It is not used by SLQ and it
+   * requires the line-search strategy and a zero risk sensitivity coefficient. Only the DIAGONAL_SHIFT Hessian correction is solved in
+   * parallel, the other corrections are solved sequentially.
+   */
+  bool useParallelRiccatiScan_ = false;
+  /**
+   * If true, the Riccati equations are evaluated with fixed-size Eigen kernels when the state and input dimensions are listed in
+   * fixed_size::RiccatiDimensions. Otherwise, the dynamic-size kernels are always used.
+   */
+  bool useFixedSizeRiccatiKernels_ = true;
 
   /** Use either the optimized control policy (true) or the optimized state-input trajectory (false). */
   bool useFeedbackPolicy_ = false;
@@ -106,12 +106,13 @@ class GaussNewtonDDP : public SolverBase {
 
  protected:
   /**
-   * Helper to run task multiple times in parallel (blocking)
+   * Helper to run a loop body for all indices in [0, N) in parallel (blocking). The workerIndex argument of the loop body is in
+   * [0, nThreads - 1] and is never used concurrently by two threads, so it can be used to index the thread stocks.
    *
-   * @param [in] taskFunction: task function
-   * @param [in] N: number of times to run taskFunction, if N = 1 it is run in the main thread
+   * @param [in] N: number of indices
+   * @param [in] loopBody: loop body with signature void(int workerIndex, int index)
    */
-  void runParallel(std::function<void(void)> taskFunction, size_t N);
+  void parallelFor(size_t N, std::function<void(int, int)> loopBody);
 
   /**
    * Takes the following steps: (1) Computes the Hessian of the Hamiltonian (i.e., Hm) (2) Based on Hm, it calculates
@@ -180,6 +181,22 @@ class GaussNewtonDDP : public SolverBase {
   virtual void riccatiEquationsWorker(size_t workerIndex, const std::pair<int, int>& partitionInterval,
                                       const ScalarFunctionQuadraticApproximation& finalValueFunction) = 0;
 
+  /**
+   * Computes the exact value function at the end of each partition of the Riccati equations. The partitions may be moved by the
+   * implementation, e.g. to keep events inside a partition. The default implementation returns false, in which case the value function
+   * of the previous iteration is used.
+   *
+   * @param [in, out] partitionIntervals: The partition intervals, defined as [start, end).
+   * @param [in] finalValueFunction The final Sm(dfdxx), Sv(dfdx), s(f), for Riccati equation.
+   * @param [out] partitionFinalValueFunctions: The value function at the end of each partition.
+   * @return Whether the exact value functions are computed.
+   */
+  virtual bool computePartitionFinalValueFunctions(std::vector<std::pair<int, int>>& partitionIntervals,
+                                                   const ScalarFunctionQuadraticApproximation& finalValueFunction,
+                                                   std::vector<ScalarFunctionQuadraticApproximation>& partitionFinalValueFunctions) {
+    return false;
+  }
+
  private:
   /**
    * Get the State Input Equality Constraint Lagrangian Impl object
@@ -360,6 +377,12 @@ class GaussNewtonDDP : public SolverBase {
    */
   void runIteration(scalar_t lqModelExpectedCost);
 
+  /**
+   * Predicts the duration of an iteration followed by the final search from the benchmarking timers.
+   * @return The predicted duration in milliseconds.
+   */
+  scalar_t predictIterationDuration() const;
+
   /**
    * Checks convergence of the main loop of DDP.
    *
@@ -390,10 +413,6 @@ class GaussNewtonDDP : public SolverBase {
   // controller that is calculated directly from dual solution. It is unoptimized because it haven't gone through searching.
   LinearController unoptimizedController_;
 
-  // multi-threading helper variables
-  std::atomic_size_t nextTaskId_{0};
-  std::atomic_size_t nextTimeIndex_{0};
-
   scalar_t initTime_ = 0.0;
   scalar_t finalTime_ = 0.0;
   vector_t initState_;
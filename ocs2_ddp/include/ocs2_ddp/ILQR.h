@@ -64,6 +64,16 @@ class ILQR : public GaussNewtonDDP {
   void riccatiEquationsWorker(size_t workerIndex, const std::pair<int, int>& partitionInterval,
                               const ScalarFunctionQuadraticApproximation& finalValueFunction) override;
 
+  /**
+   * If ddp::Settings::useParallelRiccatiScan_ is set, computes the exact value function at the end of each partition by an associative
+   * scan over the partitions, see riccati_scan::Element. Partition ends which are post-event indices are moved forward, such that the
+   * event is handled inside a partition. The Hessian corrections other than DIAGONAL_SHIFT depend on the value function of the next time
+   * step, therefore the horizon is solved as a single partition for them.
+   */
+  bool computePartitionFinalValueFunctions(std::vector<std::pair<int, int>>& partitionIntervals,
+                                           const ScalarFunctionQuadraticApproximation& finalValueFunction,
+                                           std::vector<ScalarFunctionQuadraticApproximation>& partitionFinalValueFunctions) override;
+
   void calculateControllerWorker(size_t timeIndex, const PrimalDataContainer& primalData, const DualDataContainer& dualData,
                                  LinearController& dstController) override;
 
@@ -80,10 +90,11 @@ class ILQR : public GaussNewtonDDP {
    * @param [in] input: input u_k.
    * @param [in] timeStep: Time step between the x_{k} and x_{k+1}.
    * @param [in] continuousTimeModelData: continuous time model data.
-   * @param [out] modelData: Discretized mode data.
+   * @param [in] workspace: memory for the sensitivity discretization.
+   * @param [out] modelData: Discretized mode data. Its memory is reused if the dimensions do not change.
    */
   void discreteLQWorker(SystemDynamicsBase& system, scalar_t time, const vector_t& state, const vector_t& input, scalar_t timeStep,
-                        const ModelData& continuousTimeModelData, ModelData& modelData);
+                        const ModelData& continuousTimeModelData, SensitivityDiscretizationWorkspace& workspace, ModelData& modelData);
 
   /****************
    *** Variables **
@@ -91,7 +102,10 @@ class ILQR : public GaussNewtonDDP {
   matrix_array_t projectedKmTrajectoryStock_;  // projected feedback
   vector_array_t projectedLvTrajectoryStock_;  // projected feedforward
 
-  DynamicsSensitivityDiscretizer sensitivityDiscretizer_;
+  DynamicsSensitivityDiscretizerInPlace sensitivityDiscretizer_;
+  // per-worker memory of the LQ approximation, kept across iterations
+  std::vector<ModelData> continuousTimeModelDataStock_;
+  std::vector<SensitivityDiscretizationWorkspace> sensitivityDiscretizationWorkspaceStock_;
   std::vector<std::unique_ptr<DiscreteTimeRiccatiEquations>> riccatiEquationsPtrStock_;
 };
 
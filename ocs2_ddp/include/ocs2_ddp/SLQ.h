@@ -40,7 +40,7 @@ namespace ocs2 {
 /**
  * This class is an interface class for the single-thread and multi-thread SLQ.
  */
-class SLQ final : public GaussNewtonDDP {
+class SLQ : public GaussNewtonDDP {
  public:
   /**
    * Constructor
@@ -124,6 +124,12 @@ class ContinuousTimeRiccatiEquations final : public OdeBase {
    */
   void setRiskSensitiveCoefficient(scalar_t riskSensitiveCoeff);
 
+  /**
+   * Sets whether the fixed-size kernels of fixed_size::RiccatiDimensions are used. Otherwise, the dynamic-size kernels are used for all
+   * dimensions. The default is true.
+   */
+  void setUseFixedSizeKernels(bool useFixedSizeKernels);
+
   /**
    * Transcribe symmetric matrix Sm, vector Sv and scalar s into a single vector.
    *
@@ -230,6 +236,7 @@ class ContinuousTimeRiccatiEquations final : public OdeBase {
   bool reducedFormRiccati_;
   bool isRiskSensitive_;
   scalar_t riskSensitiveCoeff_ = 0.0;
+  bool useFixedSizeKernels_ = true;
 
   // array pointers
   const scalar_array_t* timeStampPtr_ = nullptr;
@@ -237,6 +244,7 @@ class ContinuousTimeRiccatiEquations final : public OdeBase {
   const std::vector<ModelData>* modelDataEventTimesPtr_ = nullptr;
   const std::vector<riccati_modification::Data>* riccatiModificationPtr_ = nullptr;
   scalar_array_t eventTimes_;
+  LinearInterpolation::TimeSegmentCursor timeSegmentCursor_;
 
   ContinuousTimeRiccatiData continuousTimeRiccatiData_;
 };
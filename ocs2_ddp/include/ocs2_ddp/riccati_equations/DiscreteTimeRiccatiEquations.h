@@ -89,6 +89,12 @@ class DiscreteTimeRiccatiEquations {
    */
   void setRiskSensitiveCoefficient(scalar_t riskSensitiveCoeff);
 
+  /**
+   * Sets whether the fixed-size kernels of fixed_size::RiccatiDimensions are used. Otherwise, the dynamic-size kernels are used for all
+   * dimensions. The default is true.
+   */
+  void setUseFixedSizeKernels(bool useFixedSizeKernels);
+
   /**
    * Computes one step Riccati difference equations.
    *
@@ -150,6 +156,7 @@ class DiscreteTimeRiccatiEquations {
   bool reducedFormRiccati_;
   bool isRiskSensitive_;
   scalar_t riskSensitiveCoeff_ = 0.0;
+  bool useFixedSizeKernels_ = true;
 
   DiscreteTimeRiccatiData discreteTimeRiccatiData_;
 };
@@ -0,0 +1,88 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <Eigen/Core>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+namespace fixed_size {
+
+/** Compile-time state and input dimensions of a fixed-size kernel. */
+template <int StateDim, int InputDim>
+struct Dimensions {
+  static constexpr int state = StateDim;
+  static constexpr int input = InputDim;
+};
+
+/** Compile-time list of Dimensions. */
+template <class... Dims>
+struct DimensionsList {};
+
+/**
+ * The (state, projected input) dimensions for which the Riccati equations are evaluated with fixed-size Eigen kernels.
+ * These cover the small systems of the examples (double integrator, cartpole, ballbot, and quadrotor). Each entry adds
+ * one instantiation per kernel, therefore the list should be kept short.
+ */
+using RiccatiDimensions = DimensionsList<Dimensions<2, 1>, Dimensions<4, 1>, Dimensions<10, 3>, Dimensions<12, 4>>;
+
+/** Map of a matrix with compile-time dimensions. Eigen::Dynamic results in an ordinary map of a dynamic-size matrix. */
+template <int Rows, int Cols>
+using matrix_map_t = Eigen::Map<Eigen::Matrix<scalar_t, Rows, Cols>>;
+
+/** Constant map of a matrix with compile-time dimensions. */
+template <int Rows, int Cols>
+using const_matrix_map_t = Eigen::Map<const Eigen::Matrix<scalar_t, Rows, Cols>>;
+
+/**
+ * Calls kernel.runFixedSize<StateDim, InputDim>() for the first entry of the list which matches the given dimensions.
+ * If no entry matches, kernel.runDynamicSize() is called.
+ *
+ * @param [in] stateDim: The state dimension.
+ * @param [in] inputDim: The input dimension.
+ * @param [in] kernel: The kernel to be called.
+ */
+template <class Kernel>
+void dispatch(int stateDim, int inputDim, Kernel& kernel, DimensionsList<>) {
+  kernel.runDynamicSize();
+}
+
+template <class Kernel, class Dims, class... Rest>
+void dispatch(int stateDim, int inputDim, Kernel& kernel, DimensionsList<Dims, Rest...>) {
+  if (stateDim == Dims::state && inputDim == Dims::input) {
+    kernel.template runFixedSize<Dims::state, Dims::input>();
+  } else {
+    dispatch(stateDim, inputDim, kernel, DimensionsList<Rest...>());
+  }
+}
+
+}  // namespace fixed_size
+}  // namespace ocs2
@@ -0,0 +1,114 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/model_data/ModelData.h>
+
+#include "ocs2_ddp/riccati_equations/RiccatiModification.h"
+
+namespace ocs2 {
+namespace riccati_scan {
+
+/**
+ * An element of the parallel-in-time (associative scan) solution of the discrete-time Riccati equations. An element describes the
+ * backward map of the value function over a segment of the horizon, V(x_end) -> V(x_start), where the LQ problem of every node in the
+ * segment is reduced to
+ *
+ *   x_{k+1} = A x_k + b + w,  with w in the range of C and the quadratic cost 0.5 w^T pinv(C) w,
+ *   stage cost = 0.5 x_k^T J x_k - eta^T x_k + gamma.
+ *
+ * Applying an element to the value function V(x) = 0.5 x^T Sm x + Sv^T x + s results in
+ *
+ *   Sm' = J + A^T (I + Sm C)^{-1} Sm A
+ *   Sv' = -eta + A^T (I + Sm C)^{-1} (Sv + Sm b)
+ *   s'  = s + gamma + 0.5 b^T (I + Sm C)^{-1} Sm b + b^T (I + Sm C)^{-1} Sv - 0.5 Sv^T C (I + Sm C)^{-1} Sv
+ *
+ * These maps are closed under composition and the composition is associative. Therefore, the value functions of a horizon with N nodes
+ * can be computed with a parallel scan of depth O(log(N)) instead of N sequential Riccati steps.
+ *
+ * See: S. Sarkka and A. F. Garcia-Fernandez, "Temporal Parallelization of Dynamic Programming and Linear Quadratic Control", 2023.
+ */
+struct Element {
+  matrix_t A;
+  vector_t b;
+  matrix_t C;
+  vector_t eta;
+  matrix_t J;
+  scalar_t gamma = 0.0;
+};
+
+/**
+ * Creates the element of the final node, which maps any value function to the given final value function.
+ *
+ * @param [in] valueFunction: The final Sm(dfdxx), Sv(dfdx), s(f).
+ * @return The element.
+ */
+Element createFinalElement(const ScalarFunctionQuadraticApproximation& valueFunction);
+
+/**
+ * Creates the element of an intermediate node from its projected LQ approximation. This is the same problem which is solved by one step
+ * of DiscreteTimeRiccatiEquations, where the projected input cost Hessian is only required to be positive definite.
+ *
+ * @note The feedback and feedforward modifications of the Riccati equations, deltaGm and deltaGv, are assumed to be zero.
+ *
+ * @param [in] projectedModelData: The projected model data.
+ * @param [in] riccatiModification: The Riccati modification.
+ * @return The element.
+ */
+Element createIntermediateElement(const ModelData& projectedModelData, const riccati_modification::Data& riccatiModification);
+
+/**
+ * Creates the element of a pre-event node, namely the Riccati transversality conditions of the jump map.
+ *
+ * @param [in] jumpModelData: The LQ approximation of the jump map and the event cost.
+ * @return The element.
+ */
+Element createEventElement(const ModelData& jumpModelData);
+
+/**
+ * Composes the elements of two consecutive segments of the horizon.
+ *
+ * @param [in] earlier: The element of the earlier segment.
+ * @param [in] later: The element of the directly following segment.
+ * @return The element of the joint segment.
+ */
+Element combine(const Element& earlier, const Element& later);
+
+/**
+ * Gets the value function at the start of the segment of an element which ends with the final node, see createFinalElement().
+ *
+ * @param [in] element: The element of a segment which ends with the final node.
+ * @return The value function Sm(dfdxx), Sv(dfdx), s(f).
+ */
+ScalarFunctionQuadraticApproximation getValueFunction(const Element& element);
+
+}  // namespace riccati_scan
+}  // namespace ocs2
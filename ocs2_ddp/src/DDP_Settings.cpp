@@ -92,6 +92,8 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.constraintPenaltyIncreaseRate_, fieldName + ".constraintPenaltyIncreaseRate", verbose);
 
   loadData::loadPtreeValue(pt, settings.preComputeRiccatiTerms_, fieldName + ".preComputeRiccatiTerms", verbose);
+  loadData::loadPtreeValue(pt, settings.useParallelRiccatiScan_, fieldName + ".useParallelRiccatiScan", verbose);
+  loadData::loadPtreeValue(pt, settings.useFixedSizeRiccatiKernels_, fieldName + ".useFixedSizeRiccatiKernels", verbose);
 
   loadData::loadPtreeValue(pt, settings.useFeedbackPolicy_, fieldName + ".useFeedbackPolicy", verbose);
 
@@ -70,6 +70,11 @@ GaussNewtonDDP::GaussNewtonDDP(ddp::Settings ddpSettings, const RolloutBase& rol
         "[GaussNewtonDDP] DDP does not support final equality constraints (a.k.a. finalEqualityConstraintPtr), instead use the Lagrangian "
         "method!");
   }
+  if (!optimalControlProblem.inequalityConstraintPtr->empty()) {
+    throw std::runtime_error(
+        "[GaussNewtonDDP] DDP does not support intermediate inequality constraints (a.k.a. inequalityConstraintPtr), instead use the "
+        "Lagrangian method!");
+  }
 
   // Dynamics, Constraints, derivatives, and cost
   dynamicsForwardRolloutPtrStock_.reserve(ddpSettings_.nThreads_);
@@ -403,8 +408,9 @@ std::vector<std::pair<int, int>> GaussNewtonDDP::getPartitionIntervalsFromTimeTr
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void GaussNewtonDDP::runParallel(std::function<void(void)> taskFunction, size_t N) {
-  threadPool_.runParallel([&](int) { taskFunction(); }, N);
+void GaussNewtonDDP::parallelFor(size_t N, std::function<void(int, int)> loopBody) {
+  constexpr int grainSize = 1;
+  threadPool_.parallelFor(0, static_cast<int>(N), grainSize, loopBody);
 }
 
 /******************************************************************************************************/
@@ -412,8 +418,8 @@ void GaussNewtonDDP::runParallel(std::function<void(void)> taskFunction, size_t
 /******************************************************************************************************/
 void GaussNewtonDDP::rolloutInitialTrajectory(PrimalDataContainer& primalData, ControllerBase* controller, size_t workerIndex /*= 0*/) {
   assert(primalData.primalSolution.controllerPtr_.get() != controller);
-  // clear output
-  primalData.clear();
+  // clear output. The model data is kept, since it is overwritten in place by approximateOptimalControlProblem().
+  primalData.primalSolution.clear();
   // for non-StateTriggeredRollout initialize modeSchedule
   primalData.primalSolution.modeSchedule_ = this->getReferenceManager().getModeSchedule();
 
@@ -523,9 +529,8 @@ scalar_t GaussNewtonDDP::calculateRolloutMerit(const PerformanceIndex& performan
 /******************************************************************************************************/
 /******************************************************************************************************/
 scalar_t GaussNewtonDDP::solveSequentialRiccatiEquationsImpl(const ScalarFunctionQuadraticApproximation& finalValueFunction) {
-  // pre-allocate memory for dual solution
+  // pre-allocate memory for dual solution. The existing elements are kept since the Riccati solvers resize and write them in place.
   const size_t outputN = nominalPrimalData_.primalSolution.timeTrajectory_.size();
-  dualData_.valueFunctionTrajectory.clear();
   dualData_.valueFunctionTrajectory.resize(outputN);
 
   // the last index of the partition is excluded, namely [first, last), so the value function approximation of the end point of the end
@@ -534,17 +539,23 @@ scalar_t GaussNewtonDDP::solveSequentialRiccatiEquationsImpl(const ScalarFunctio
   // [first1,last1), [first2(last1), last2).
   dualData_.valueFunctionTrajectory.back() = finalValueFunction;
 
-  // solve it sequentially for the first iteration
-  if (totalNumIterations_ == 0) {
+  // do equal-time partitions based on available thread resource
+  std::vector<std::pair<int, int>> partitionIntervals =
+      getPartitionIntervalsFromTimeTrajectory(nominalPrimalData_.primalSolution.timeTrajectory_, ddpSettings_.nThreads_);
+
+  // hold the final value function of each partition
+  std::vector<ScalarFunctionQuadraticApproximation> finalValueFunctionOfEachPartition;
+
+  if (computePartitionFinalValueFunctions(partitionIntervals, finalValueFunction, finalValueFunctionOfEachPartition)) {
+    // solve it in parallel with the exact value functions at the end of partitions
+    parallelFor(partitionIntervals.size(), [&](int workerIndex, int partitionIndex) {
+      riccatiEquationsWorker(workerIndex, partitionIntervals[partitionIndex], finalValueFunctionOfEachPartition[partitionIndex]);
+    });
+  } else if (totalNumIterations_ == 0) {  // solve it sequentially for the first iteration
     const std::pair<int, int> partitionInterval{0, outputN - 1};
     riccatiEquationsWorker(0, partitionInterval, finalValueFunction);
   } else {  // solve it in parallel
-    // do equal-time partitions based on available thread resource
-    std::vector<std::pair<int, int>> partitionIntervals =
-        getPartitionIntervalsFromTimeTrajectory(nominalPrimalData_.primalSolution.timeTrajectory_, ddpSettings_.nThreads_);
-
-    // hold the final value function of each partition
-    std::vector<ScalarFunctionQuadraticApproximation> finalValueFunctionOfEachPartition(partitionIntervals.size());
+    finalValueFunctionOfEachPartition.resize(partitionIntervals.size());
     finalValueFunctionOfEachPartition.back() = finalValueFunction;
     for (size_t i = 0; i < partitionIntervals.size() - 1; i++) {
       const int startIndexOfNextPartition = partitionIntervals[i + 1].first;
@@ -553,12 +564,9 @@ scalar_t GaussNewtonDDP::solveSequentialRiccatiEquationsImpl(const ScalarFunctio
           getValueFunctionFromCache(nominalPrimalData_.primalSolution.timeTrajectory_[startIndexOfNextPartition], xFinalUpdated);
     }  // end of loop
 
-    nextTaskId_ = 0;
-    auto task = [this, &partitionIntervals, &finalValueFunctionOfEachPartition]() {
-      const size_t taskId = nextTaskId_++;  // assign task ID (atomic)
-      riccatiEquationsWorker(taskId, partitionIntervals[taskId], finalValueFunctionOfEachPartition[taskId]);
-    };
-    runParallel(task, partitionIntervals.size());
+    parallelFor(partitionIntervals.size(), [&](int workerIndex, int partitionIndex) {
+      riccatiEquationsWorker(workerIndex, partitionIntervals[partitionIndex], finalValueFunctionOfEachPartition[partitionIndex]);
+    });
   }
 
   // testing the numerical stability of the Riccati equations
@@ -608,21 +616,15 @@ scalar_t GaussNewtonDDP::solveSequentialRiccatiEquationsImpl(const ScalarFunctio
 void GaussNewtonDDP::calculateController() {
   const size_t N = nominalPrimalData_.primalSolution.timeTrajectory_.size();
 
-  unoptimizedController_.clear();
+  // the controller is not cleared such that the memory of the gains is reused
   unoptimizedController_.timeStamp_ = nominalPrimalData_.primalSolution.timeTrajectory_;
   unoptimizedController_.gainArray_.resize(N);
   unoptimizedController_.biasArray_.resize(N);
   unoptimizedController_.deltaBiasArray_.resize(N);
 
-  nextTimeIndex_ = 0;
-  auto task = [this, N] {
-    int timeIndex;
-    // get next time index (atomic)
-    while ((timeIndex = nextTimeIndex_++) < N) {
-      calculateControllerWorker(timeIndex, nominalPrimalData_, dualData_, unoptimizedController_);
-    }
-  };
-  runParallel(task, ddpSettings_.nThreads_);
+  parallelFor(N, [this](int, int timeIndex) {
+    calculateControllerWorker(timeIndex, nominalPrimalData_, dualData_, unoptimizedController_);
+  });
 
   // Since the controller for the last timestamp is invalid, if the last time is not the event time, use the control policy of the second to
   // last time for the last time
@@ -682,48 +684,38 @@ void GaussNewtonDDP::approximateOptimalControlProblem() {
    * also call shiftHessian on the event time's cost 2nd order derivative.
    */
   const size_t NE = nominalPrimalData_.primalSolution.postEventIndices_.size();
-  nominalPrimalData_.modelDataEventTimes.clear();
   nominalPrimalData_.modelDataEventTimes.resize(NE);
   if (NE > 0) {
-    nextTimeIndex_ = 0;
-    nextTaskId_ = 0;
-    auto task = [this, NE]() {
-      const size_t taskId = nextTaskId_++;  // assign task ID (atomic)
-
-      // timeIndex is atomic
-      int timeIndex;
-      while ((timeIndex = nextTimeIndex_++) < NE) {
-        ModelData& modelData = nominalPrimalData_.modelDataEventTimes[timeIndex];
-        const size_t preEventIndex = nominalPrimalData_.primalSolution.postEventIndices_[timeIndex] - 1;
-        const auto& time = nominalPrimalData_.primalSolution.timeTrajectory_[preEventIndex];
-        const auto& state = nominalPrimalData_.primalSolution.stateTrajectory_[preEventIndex];
-
-        // approximate LQ for the pre-event node
-        ocs2::approximatePreJumpLQ(optimalControlProblemStock_[taskId], time, state, modelData);
-
-        // checking the numerical properties
-        if (ddpSettings_.checkNumericalStability_) {
-          const auto errSize = checkSize(modelData, state.rows(), 0);
-          if (!errSize.empty()) {
-            throw std::runtime_error("[GaussNewtonDDP::approximateOptimalControlProblem] Mismatch in dimensions at intermediate time: " +
-                                     std::to_string(time) + "\n" + errSize);
-          }
-          const std::string errProperties =
-              checkDynamicsProperties(modelData) + checkCostProperties(modelData) + checkConstraintProperties(modelData);
-          if (!errProperties.empty()) {
-            throw std::runtime_error("[GaussNewtonDDP::approximateOptimalControlProblem] Ill-posed problem at event time: " +
-                                     std::to_string(time) + "\n" + errProperties);
-          }
+    parallelFor(NE, [this](int workerIndex, int timeIndex) {
+      ModelData& modelData = nominalPrimalData_.modelDataEventTimes[timeIndex];
+      const size_t preEventIndex = nominalPrimalData_.primalSolution.postEventIndices_[timeIndex] - 1;
+      const auto& time = nominalPrimalData_.primalSolution.timeTrajectory_[preEventIndex];
+      const auto& state = nominalPrimalData_.primalSolution.stateTrajectory_[preEventIndex];
+
+      // approximate LQ for the pre-event node
+      ocs2::approximatePreJumpLQ(optimalControlProblemStock_[workerIndex], time, state, modelData);
+
+      // checking the numerical properties
+      if (ddpSettings_.checkNumericalStability_) {
+        const auto errSize = checkSize(modelData, state.rows(), 0);
+        if (!errSize.empty()) {
+          throw std::runtime_error("[GaussNewtonDDP::approximateOptimalControlProblem] Mismatch in dimensions at intermediate time: " +
+                                   std::to_string(time) + "\n" + errSize);
         }
-
-        // shift Hessian
-        if (ddpSettings_.strategy_ == search_strategy::Type::LINE_SEARCH) {
-          hessian_correction::shiftHessian(ddpSettings_.lineSearch_.hessianCorrectionStrategy, modelData.cost.dfdxx,
-                                           ddpSettings_.lineSearch_.hessianCorrectionMultiple);
+        const std::string errProperties =
+            checkDynamicsProperties(modelData) + checkCostProperties(modelData) + checkConstraintProperties(modelData);
+        if (!errProperties.empty()) {
+          throw std::runtime_error("[GaussNewtonDDP::approximateOptimalControlProblem] Ill-posed problem at event time: " +
+                                   std::to_string(time) + "\n" + errProperties);
         }
       }
-    };
-    runParallel(task, ddpSettings_.nThreads_);
+
+      // shift Hessian
+      if (ddpSettings_.strategy_ == search_strategy::Type::LINE_SEARCH) {
+        hessian_correction::shiftHessian(ddpSettings_.lineSearch_.hessianCorrectionStrategy, modelData.cost.dfdxx,
+                                         ddpSettings_.lineSearch_.hessianCorrectionMultiple);
+      }
+    });
   }
 
   /*
@@ -1053,6 +1045,22 @@ void GaussNewtonDDP::runIteration(scalar_t lqModelExpectedCost) {
   Eigen::setNbThreads(0);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+scalar_t GaussNewtonDDP::predictIterationDuration() const {
+  // The slower of the average and the latest duration is used, such that a growing problem is anticipated.
+  auto predictDuration = [](const benchmark::RepeatedTimer& timer) {
+    return (timer.getNumTimedIntervals() > 0) ? std::max(timer.getAverageInMilliseconds(), timer.getLastIntervalInMilliseconds()) : 0.0;
+  };
+  // Before the first search, the initial rollout is the best available estimate of a search
+  const scalar_t searchDuration = (searchStrategyTimer_.getNumTimedIntervals() > 0) ? predictDuration(searchStrategyTimer_)
+                                                                                    : predictDuration(initializationTimer_);
+  // An iteration is followed by the final search
+  return 2.0 * searchDuration + predictDuration(linearQuadraticApproximationTimer_) + predictDuration(backwardPassTimer_) +
+         predictDuration(computeControllerTimer_);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -1116,10 +1124,17 @@ void GaussNewtonDDP::runImpl(scalar_t initTime, const vector_t& initState, scala
 
   // convergence variables of the main loop
   bool isConverged = false;
+  bool isTimeBudgetReached = false;
   std::string convergenceInfo;
 
   // DDP main loop
   while (!isConverged && (totalNumIterations_ - initIteration) < ddpSettings_.maxNumIterations_) {
+    // stop early if the iteration and the final search are predicted to exceed the time budget
+    if (!isWithinTimeBudget(predictIterationDuration())) {
+      isTimeBudgetReached = true;
+      break;
+    }
+
     // display the iteration's input update norm (before caching the old nominals)
     if (ddpSettings_.displayInfo_) {
       std::cerr << "\n###################";
@@ -1182,6 +1197,9 @@ void GaussNewtonDDP::runImpl(scalar_t initTime, const vector_t& initState, scala
     } else if (totalNumIterations_ - initIteration == ddpSettings_.maxNumIterations_) {
       std::cerr << "The algorithm has terminated as: \n";
       std::cerr << "    * The maximum number of iterations (i.e., " << ddpSettings_.maxNumIterations_ << ") has reached." << std::endl;
+    } else if (isTimeBudgetReached) {
+      std::cerr << "The algorithm has terminated as: \n";
+      std::cerr << "    * The time budget (i.e., " << getTimeBudget() << " [s]) does not allow another iteration." << std::endl;
     } else {
       std::cerr << "The algorithm has terminated for an unknown reason!" << std::endl;
     }
@@ -28,6 +28,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
 #include "ocs2_ddp/ILQR.h"
+#include <ocs2_ddp/riccati_equations/RiccatiScan.h>
 #include <ocs2_ddp/riccati_equations/RiccatiTransversalityConditions.h>
 
 namespace ocs2 {
@@ -47,19 +48,31 @@ ILQR::ILQR(ddp::Settings ddpSettings, const RolloutBase& rollout, const OptimalC
   sensitivityDiscretizer_ = [&]() {
     switch (settings().backwardPassIntegratorType_) {
       case IntegratorType::EULER:
-        return selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::EULER);
+        return selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType::EULER);
       case IntegratorType::RK4:
-        return selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+        return selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType::RK4);
       case IntegratorType::ODE45:
-        return selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+        return selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType::RK4);
       case IntegratorType::ODE45_OCS2:
-        return selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+        return selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType::RK4);
       default:
         throw std::runtime_error("[ILQR] Integrator of type " + integrator_type::toString(settings().backwardPassIntegratorType_) +
                                  " is not supported for sensitivity discretization! Modify ddp::Settings::backwardPassIntegratorType_.");
     }
   }();
 
+  if (settings().useParallelRiccatiScan_) {
+    if (settings().strategy_ != search_strategy::Type::LINE_SEARCH) {
+      throw std::runtime_error("[ILQR] The parallel Riccati scan is only supported by the line-search strategy!");
+    }
+    if (!numerics::almost_eq(settings().riskSensitiveCoeff_, 0.0)) {
+      throw std::runtime_error("[ILQR] The parallel Riccati scan is not supported by the risk sensitive ILQR!");
+    }
+  }
+
+  continuousTimeModelDataStock_.resize(settings().nThreads_);
+  sensitivityDiscretizationWorkspaceStock_.resize(settings().nThreads_);
+
   // Riccati solver
   riccatiEquationsPtrStock_.clear();
   riccatiEquationsPtrStock_.reserve(settings().nThreads_);
@@ -68,6 +81,7 @@ ILQR::ILQR(ddp::Settings ddpSettings, const RolloutBase& rollout, const OptimalC
     const bool preComputeRiccatiTerms = settings().preComputeRiccatiTerms_ && (settings().strategy_ == search_strategy::Type::LINE_SEARCH);
     riccatiEquationsPtrStock_.emplace_back(new DiscreteTimeRiccatiEquations(preComputeRiccatiTerms, isRiskSensitive));
     riccatiEquationsPtrStock_.back()->setRiskSensitiveCoefficient(settings().riskSensitiveCoeff_);
+    riccatiEquationsPtrStock_.back()->setUseFixedSizeKernels(settings().useFixedSizeRiccatiKernels_);
   }  // end of i loop
 
   Eigen::initParallel();
@@ -84,64 +98,56 @@ void ILQR::approximateIntermediateLQ(PrimalDataContainer& primalData) {
   const auto& postEventIndices = primalData.primalSolution.postEventIndices_;
   auto& modelDataTrajectory = primalData.modelDataTrajectory;
 
-  modelDataTrajectory.clear();
+  // the existing elements are overwritten in place
   modelDataTrajectory.resize(timeTrajectory.size());
 
-  nextTimeIndex_ = 0;
-  nextTaskId_ = 0;
-  auto task = [&]() {
-    size_t taskId = nextTaskId_++;  // assign task ID (atomic)
-
-    ModelData continuousTimeModelData;
-
-    // get next time index is atomic
-    size_t timeIndex;
-    while ((timeIndex = nextTimeIndex_++) < timeTrajectory.size()) {
-      // approximate continuous LQ for the given time index
-      ocs2::approximateIntermediateLQ(optimalControlProblemStock_[taskId], timeTrajectory[timeIndex], stateTrajectory[timeIndex],
-                                      inputTrajectory[timeIndex], continuousTimeModelData);
-
-      // checking the numerical properties
-      if (settings().checkNumericalStability_) {
-        const auto errSize = checkSize(continuousTimeModelData, stateTrajectory[timeIndex].rows(), inputTrajectory[timeIndex].rows());
-        if (!errSize.empty()) {
-          throw std::runtime_error("[ILQR::approximateIntermediateLQ] Mismatch in dimensions at intermediate time: " +
-                                   std::to_string(timeTrajectory[timeIndex]) + "\n" + errSize);
-        }
-        const auto errProperties = checkDynamicsProperties(continuousTimeModelData) + checkCostProperties(continuousTimeModelData) +
-                                   checkConstraintProperties(continuousTimeModelData);
-        if (!errProperties.empty()) {
-          throw std::runtime_error("[ILQR::approximateIntermediateLQ] Ill-posed problem at intermediate time: " +
-                                   std::to_string(timeTrajectory[timeIndex]) + "\n" + errProperties);
-        }
-      }
+  parallelFor(timeTrajectory.size(), [&](int workerIndex, int timeIndex) {
+    ModelData& continuousTimeModelData = continuousTimeModelDataStock_[workerIndex];
 
-      // discretize LQ problem
-      const scalar_t timeStep = (timeIndex + 1 < timeTrajectory.size()) ? (timeTrajectory[timeIndex + 1] - timeTrajectory[timeIndex]) : 0.0;
-      if (!numerics::almost_eq(timeStep, 0.0)) {
-        discreteLQWorker(*optimalControlProblemStock_[taskId].dynamicsPtr, timeTrajectory[timeIndex], stateTrajectory[timeIndex],
-                         inputTrajectory[timeIndex], timeStep, continuousTimeModelData, modelDataTrajectory[timeIndex]);
-      } else {
-        modelDataTrajectory[timeIndex] = continuousTimeModelData;
+    // approximate continuous LQ for the given time index
+    ocs2::approximateIntermediateLQ(optimalControlProblemStock_[workerIndex], timeTrajectory[timeIndex], stateTrajectory[timeIndex],
+                                    inputTrajectory[timeIndex], continuousTimeModelData);
+
+    // checking the numerical properties
+    if (settings().checkNumericalStability_) {
+      const auto errSize = checkSize(continuousTimeModelData, stateTrajectory[timeIndex].rows(), inputTrajectory[timeIndex].rows());
+      if (!errSize.empty()) {
+        throw std::runtime_error("[ILQR::approximateIntermediateLQ] Mismatch in dimensions at intermediate time: " +
+                                 std::to_string(timeTrajectory[timeIndex]) + "\n" + errSize);
+      }
+      const auto errProperties = checkDynamicsProperties(continuousTimeModelData) + checkCostProperties(continuousTimeModelData) +
+                                 checkConstraintProperties(continuousTimeModelData);
+      if (!errProperties.empty()) {
+        throw std::runtime_error("[ILQR::approximateIntermediateLQ] Ill-posed problem at intermediate time: " +
+                                 std::to_string(timeTrajectory[timeIndex]) + "\n" + errProperties);
       }
     }
-  };
 
-  runParallel(task, settings().nThreads_);
+    // discretize LQ problem
+    const scalar_t timeStep = (timeIndex + 1 < timeTrajectory.size()) ? (timeTrajectory[timeIndex + 1] - timeTrajectory[timeIndex]) : 0.0;
+    if (!numerics::almost_eq(timeStep, 0.0)) {
+      discreteLQWorker(*optimalControlProblemStock_[workerIndex].dynamicsPtr, timeTrajectory[timeIndex], stateTrajectory[timeIndex],
+                       inputTrajectory[timeIndex], timeStep, continuousTimeModelData, sensitivityDiscretizationWorkspaceStock_[workerIndex],
+                       modelDataTrajectory[timeIndex]);
+    } else {
+      modelDataTrajectory[timeIndex] = continuousTimeModelData;
+    }
+  });
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void ILQR::discreteLQWorker(SystemDynamicsBase& system, scalar_t time, const vector_t& state, const vector_t& input, scalar_t timeStep,
-                            const ModelData& continuousTimeModelData, ModelData& modelData) {
+                            const ModelData& continuousTimeModelData, SensitivityDiscretizationWorkspace& workspace,
+                            ModelData& modelData) {
   modelData.time = continuousTimeModelData.time;
   modelData.stateDim = continuousTimeModelData.stateDim;
   modelData.inputDim = continuousTimeModelData.inputDim;
 
   // linearize system dynamics
   modelData.dynamicsBias.setZero(modelData.stateDim);
-  modelData.dynamics = sensitivityDiscretizer_(system, time, state, input, timeStep);
+  sensitivityDiscretizer_(system, time, state, input, timeStep, workspace, modelData.dynamics);
   modelData.dynamics.f.setZero(modelData.stateDim);
 
   // quadratic approximation to the cost function
@@ -296,4 +302,103 @@ void ILQR::riccatiEquationsWorker(size_t workerIndex, const std::pair<int, int>&
     --curIndex;
   }  // while
 }
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool ILQR::computePartitionFinalValueFunctions(std::vector<std::pair<int, int>>& partitionIntervals,
+                                               const ScalarFunctionQuadraticApproximation& finalValueFunction,
+                                               std::vector<ScalarFunctionQuadraticApproximation>& partitionFinalValueFunctions) {
+  if (!settings().useParallelRiccatiScan_) {
+    return false;
+  }
+
+  // Only the diagonal shift modifies the Riccati equation independently of the value function of the next time step. The other Hessian
+  // corrections are solved exactly as a single partition.
+  if (settings().lineSearch_.hessianCorrectionStrategy != hessian_correction::Strategy::DIAGONAL_SHIFT) {
+    partitionIntervals.assign(1, {partitionIntervals.front().first, partitionIntervals.back().second});
+    partitionFinalValueFunctions.assign(1, finalValueFunction);
+    return true;
+  }
+
+  const auto& postEventIndices = nominalPrimalData_.primalSolution.postEventIndices_;
+  const auto isPostEventIndex = [&](int index) { return std::binary_search(postEventIndices.begin(), postEventIndices.end(), index); };
+
+  // move the partition ends off the post-event indices, since riccatiEquationsWorker only handles the events inside a partition
+  const int finalIndex = partitionIntervals.back().second;
+  std::vector<std::pair<int, int>> eventSafeIntervals;
+  eventSafeIntervals.reserve(partitionIntervals.size());
+  int startIndex = partitionIntervals.front().first;
+  for (const auto& interval : partitionIntervals) {
+    int endIndex = std::max(interval.second, startIndex);
+    while (endIndex < finalIndex && isPostEventIndex(endIndex)) {
+      ++endIndex;
+    }
+    if (endIndex > startIndex) {
+      eventSafeIntervals.emplace_back(startIndex, endIndex);
+      startIndex = endIndex;
+    }
+  }
+  partitionIntervals.swap(eventSafeIntervals);
+  const size_t numPartitions = partitionIntervals.size();
+  if (numPartitions == 1) {
+    partitionFinalValueFunctions.assign(1, finalValueFunction);
+    return true;
+  }
+
+  // reduce the nodes of each partition to a single element
+  std::vector<riccati_scan::Element> partitionElements(numPartitions);
+  parallelFor(numPartitions, [&](int workerIndex, int partitionIndex) {
+    const auto& interval = partitionIntervals[partitionIndex];
+    const auto stateDim = nominalPrimalData_.modelDataTrajectory[interval.second].stateDim;
+    const matrix_t SmDummy = matrix_t::Zero(stateDim, stateDim);
+
+    ModelData projectedModelData;
+    riccati_modification::Data riccatiModification;
+    auto getElement = [&](int timeIndex) {
+      if (isPostEventIndex(timeIndex + 1) && timeIndex + 1 < interval.second) {
+        const int eventIndex = std::distance(postEventIndices.begin(),
+                                             std::lower_bound(postEventIndices.begin(), postEventIndices.end(), timeIndex + 1));
+        return riccati_scan::createEventElement(nominalPrimalData_.modelDataEventTimes[eventIndex]);
+      } else {
+        // the value function is invariant to the metric of the projection and the diagonal shift of the Hessian correction does not
+        // depend on it, therefore Sm is not required
+        computeProjectionAndRiccatiModification(nominalPrimalData_.modelDataTrajectory[timeIndex], SmDummy, projectedModelData,
+                                                riccatiModification);
+        return riccati_scan::createIntermediateElement(projectedModelData, riccatiModification);
+      }
+    };
+
+    auto& partitionElement = partitionElements[partitionIndex];
+    partitionElement = getElement(interval.second - 1);
+    for (int timeIndex = interval.second - 2; timeIndex >= interval.first; timeIndex--) {
+      partitionElement = riccati_scan::combine(getElement(timeIndex), partitionElement);
+    }
+  });
+  partitionElements.back() = riccati_scan::combine(partitionElements.back(), riccati_scan::createFinalElement(finalValueFunction));
+
+  // suffix scan over the partitions in log2(numPartitions) rounds
+  std::vector<riccati_scan::Element> scannedElements(numPartitions);
+  for (size_t stride = 1; stride < numPartitions; stride *= 2) {
+    parallelFor(numPartitions, [&](int, int partitionIndex) {
+      const size_t laterIndex = partitionIndex + stride;
+      if (laterIndex < numPartitions) {
+        scannedElements[partitionIndex] = riccati_scan::combine(partitionElements[partitionIndex], partitionElements[laterIndex]);
+      } else {
+        scannedElements[partitionIndex] = partitionElements[partitionIndex];
+      }
+    });
+    partitionElements.swap(scannedElements);
+  }
+
+  // the end of each partition is the start of the next one
+  partitionFinalValueFunctions.resize(numPartitions);
+  for (size_t i = 0; i + 1 < numPartitions; i++) {
+    partitionFinalValueFunctions[i] = riccati_scan::getValueFunction(partitionElements[i + 1]);
+  }
+  partitionFinalValueFunctions.back() = finalValueFunction;
+
+  return true;
+}
+
 }  // namespace ocs2
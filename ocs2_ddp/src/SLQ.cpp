@@ -66,6 +66,7 @@ SLQ::SLQ(ddp::Settings ddpSettings, const RolloutBase& rollout, const OptimalCon
     bool isRiskSensitive = !numerics::almost_eq(settings().riskSensitiveCoeff_, 0.0);
     riccatiEquationsPtrStock_.emplace_back(new ContinuousTimeRiccatiEquations(preComputeRiccatiTerms, isRiskSensitive));
     riccatiEquationsPtrStock_.back()->setRiskSensitiveCoefficient(settings().riskSensitiveCoeff_);
+    riccatiEquationsPtrStock_.back()->setUseFixedSizeKernels(settings().useFixedSizeRiccatiKernels_);
     riccatiIntegratorPtrStock_.emplace_back(newIntegrator(integratorType));
   }  // end of i loop
 
@@ -83,41 +84,30 @@ void SLQ::approximateIntermediateLQ(PrimalDataContainer& primalData) {
   const auto& postEventIndices = primalData.primalSolution.postEventIndices_;
   auto& modelDataTrajectory = primalData.modelDataTrajectory;
 
-  modelDataTrajectory.clear();
+  // the existing elements are overwritten in place
   modelDataTrajectory.resize(timeTrajectory.size());
 
-  nextTimeIndex_ = 0;
-  nextTaskId_ = 0;
-  auto task = [&]() {
-    const size_t taskId = nextTaskId_++;  // assign task ID (atomic)
-
-    // get next time index is atomic
-    size_t timeIndex;
-    while ((timeIndex = nextTimeIndex_++) < timeTrajectory.size()) {
-      // approximate LQ for the given time index
-      ocs2::approximateIntermediateLQ(optimalControlProblemStock_[taskId], timeTrajectory[timeIndex], stateTrajectory[timeIndex],
-                                      inputTrajectory[timeIndex], modelDataTrajectory[timeIndex]);
-
-      // checking the numerical properties
-      if (settings().checkNumericalStability_) {
-        const auto errSize =
-            checkSize(modelDataTrajectory[timeIndex], stateTrajectory[timeIndex].rows(), inputTrajectory[timeIndex].rows());
-        if (!errSize.empty()) {
-          throw std::runtime_error("[SLQ::approximateIntermediateLQ] Mismatch in dimensions at intermediate time: " +
-                                   std::to_string(timeTrajectory[timeIndex]) + "\n" + errSize);
-        }
-        const std::string errProperties = checkDynamicsProperties(modelDataTrajectory[timeIndex]) +
-                                          checkCostProperties(modelDataTrajectory[timeIndex]) +
-                                          checkConstraintProperties(modelDataTrajectory[timeIndex]);
-        if (!errProperties.empty()) {
-          throw std::runtime_error("[SLQ::approximateIntermediateLQ] Ill-posed problem at intermediate time: " +
-                                   std::to_string(timeTrajectory[timeIndex]) + "\n" + errProperties);
-        }
+  parallelFor(timeTrajectory.size(), [&](int workerIndex, int timeIndex) {
+    // approximate LQ for the given time index
+    ocs2::approximateIntermediateLQ(optimalControlProblemStock_[workerIndex], timeTrajectory[timeIndex], stateTrajectory[timeIndex],
+                                    inputTrajectory[timeIndex], modelDataTrajectory[timeIndex]);
+
+    // checking the numerical properties
+    if (settings().checkNumericalStability_) {
+      const auto errSize = checkSize(modelDataTrajectory[timeIndex], stateTrajectory[timeIndex].rows(), inputTrajectory[timeIndex].rows());
+      if (!errSize.empty()) {
+        throw std::runtime_error("[SLQ::approximateIntermediateLQ] Mismatch in dimensions at intermediate time: " +
+                                 std::to_string(timeTrajectory[timeIndex]) + "\n" + errSize);
       }
-    }  // end of while loop
-  };
-
-  runParallel(task, settings().nThreads_);
+      const std::string errProperties = checkDynamicsProperties(modelDataTrajectory[timeIndex]) +
+                                        checkCostProperties(modelDataTrajectory[timeIndex]) +
+                                        checkConstraintProperties(modelDataTrajectory[timeIndex]);
+      if (!errProperties.empty()) {
+        throw std::runtime_error("[SLQ::approximateIntermediateLQ] Ill-posed problem at intermediate time: " +
+                                 std::to_string(timeTrajectory[timeIndex]) + "\n" + errProperties);
+      }
+    }
+  });
 }
 
 /******************************************************************************************************/
@@ -179,21 +169,13 @@ scalar_t SLQ::solveSequentialRiccatiEquations(const ScalarFunctionQuadraticAppro
   dualData_.projectedModelDataTrajectory.resize(N);
 
   if (N > 0) {
-    // perform the computeRiccatiModificationTerms for partition i
-    nextTimeIndex_ = 0;
-    nextTaskId_ = 0;
-    auto task = [this, N]() {
-      int timeIndex;
-      const matrix_t SmDummy = matrix_t::Zero(0, 0);
-
-      // get next time index is atomic
-      while ((timeIndex = nextTimeIndex_++) < N) {
-        computeProjectionAndRiccatiModification(nominalPrimalData_.modelDataTrajectory[timeIndex], SmDummy,
-                                                dualData_.projectedModelDataTrajectory[timeIndex],
-                                                dualData_.riccatiModificationTrajectory[timeIndex]);
-      }
-    };
-    runParallel(task, settings().nThreads_);
+    // perform the computeRiccatiModificationTerms for all time indices
+    const matrix_t SmDummy = matrix_t::Zero(0, 0);
+    parallelFor(N, [&](int, int timeIndex) {
+      computeProjectionAndRiccatiModification(nominalPrimalData_.modelDataTrajectory[timeIndex], SmDummy,
+                                              dualData_.projectedModelDataTrajectory[timeIndex],
+                                              dualData_.riccatiModificationTrajectory[timeIndex]);
+    });
   }
 
   return solveSequentialRiccatiEquationsImpl(finalValueFunction);
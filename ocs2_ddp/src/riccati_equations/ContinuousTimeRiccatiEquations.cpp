@@ -31,11 +31,223 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/model_data/ModelDataLinearInterpolation.h>
 
 #include <ocs2_ddp/riccati_equations/ContinuousTimeRiccatiEquations.h>
+#include <ocs2_ddp/riccati_equations/FixedSizeDispatch.h>
 #include <ocs2_ddp/riccati_equations/RiccatiModificationInterpolation.h>
 #include <ocs2_ddp/riccati_equations/RiccatiTransversalityConditions.h>
 
 namespace ocs2 {
 
+namespace {
+
+/**
+ * Interpolates into a preallocated output. Follows the same rules as LinearInterpolation::interpolate.
+ */
+template <class Data, class AccessFun, class Output>
+void interpolate(LinearInterpolation::index_alpha_t indexAlpha, const std::vector<Data>& dataArray, AccessFun accessFun, Output& output) {
+  assert(dataArray.size() > 0);
+  if (dataArray.size() > 1) {
+    const auto& lhs = accessFun(dataArray, indexAlpha.first);
+    const auto& rhs = accessFun(dataArray, indexAlpha.first + 1);
+    if (lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols()) {
+      output = indexAlpha.second * lhs + (scalar_t(1.0) - indexAlpha.second) * rhs;
+    } else {
+      output = (indexAlpha.second > 0.5) ? lhs : rhs;
+    }
+  } else {
+    output = accessFun(dataArray, 0);
+  }
+}
+
+/**
+ * Stack-allocated counterpart of ContinuousTimeRiccatiData which is used by the fixed-size kernels.
+ */
+template <int NX, int NU>
+struct FixedSizeContinuousTimeRiccatiData {
+  Eigen::Matrix<scalar_t, NX, 1> projectedHv_;
+  Eigen::Matrix<scalar_t, NX, NX> projectedAm_;
+  Eigen::Matrix<scalar_t, NX, NU> projectedBm_;
+  Eigen::Matrix<scalar_t, NU, NU> projectedRm_;
+
+  Eigen::Matrix<scalar_t, NX, NX> deltaQm_;
+
+  Eigen::Matrix<scalar_t, NU, NX> projectedGm_;
+  Eigen::Matrix<scalar_t, NU, 1> projectedGv_;
+
+  Eigen::Matrix<scalar_t, NU, NX> projectedKm_;
+  Eigen::Matrix<scalar_t, NU, 1> projectedLv_;
+
+  Eigen::Matrix<scalar_t, NX, NX> SmTrans_projectedAm_;
+  Eigen::Matrix<scalar_t, NX, NX> projectedKm_T_projectedGm_;
+  Eigen::Matrix<scalar_t, NU, NX> projectedRm_projectedKm_;
+  Eigen::Matrix<scalar_t, NU, 1> projectedRm_projectedLv_;
+};
+
+/**
+ * Computes the Riccati equations for SLQ problem. The state and input dimensions, NX and NU, are either fixed at compile
+ * time or Eigen::Dynamic. In the latter case, Cache is ContinuousTimeRiccatiData.
+ */
+template <int NX, int NU, class Cache>
+void computeFlowMapSLQImpl(bool reducedFormRiccati, LinearInterpolation::index_alpha_t indexAlpha,
+                           const std::vector<ModelData>& projectedModelData,
+                           const std::vector<riccati_modification::Data>& riccatiModification, const matrix_t& Sm, const vector_t& Sv,
+                           Cache& creCache, matrix_t& dSm, vector_t& dSv, scalar_t& ds) {
+  /* note: according to some discussions on stackoverflow, it does not buy
+   * computation time if multiplications with symmetric matrices are executed
+   * using selfadjointView(). Doing the full multiplication seems to be faster
+   * because of vectorization
+   */
+  const auto nx = Sm.rows();
+
+  const fixed_size::const_matrix_map_t<NX, NX> SmMap(Sm.data(), nx, nx);
+  const fixed_size::const_matrix_map_t<NX, 1> SvMap(Sv.data(), nx, 1);
+
+  // the outputs are mapped after resizing in which case their memory is not reallocated
+  dSm.resize(nx, nx);
+  dSv.resize(nx);
+  fixed_size::matrix_map_t<NX, NX> dSmMap(dSm.data(), nx, nx);
+  fixed_size::matrix_map_t<NX, 1> dSvMap(dSv.data(), nx, 1);
+
+  // Hv
+  interpolate(indexAlpha, projectedModelData, model_data::dynamicsBias, creCache.projectedHv_);
+  // Am
+  interpolate(indexAlpha, projectedModelData, model_data::dynamics_dfdx, creCache.projectedAm_);
+  // Bm
+  interpolate(indexAlpha, projectedModelData, model_data::dynamics_dfdu, creCache.projectedBm_);
+  // q
+  ds = LinearInterpolation::interpolate(indexAlpha, projectedModelData, model_data::cost_f);
+  // Qv
+  interpolate(indexAlpha, projectedModelData, model_data::cost_dfdx, dSvMap);
+  // Qm
+  interpolate(indexAlpha, projectedModelData, model_data::cost_dfdxx, dSmMap);
+  // Rv
+  interpolate(indexAlpha, projectedModelData, model_data::cost_dfdu, creCache.projectedGv_);
+  // Pm
+  interpolate(indexAlpha, projectedModelData, model_data::cost_dfdux, creCache.projectedGm_);
+  // delatQm
+  interpolate(indexAlpha, riccatiModification, riccati_modification::deltaQm, creCache.deltaQm_);
+  // delatGm
+  interpolate(indexAlpha, riccatiModification, riccati_modification::deltaGm, creCache.projectedKm_);
+  // delatGv
+  interpolate(indexAlpha, riccatiModification, riccati_modification::deltaGv, creCache.projectedLv_);
+
+  // projectedGm = projectedPm + projectedBm^T * Sm [COMPLEXITY: nx^2 * np]
+  creCache.projectedGm_.noalias() += creCache.projectedBm_.transpose() * SmMap;
+
+  // projectedGv = projectedRv + projectedBm^T * Sv [COMPLEXITY: nx * np]
+  creCache.projectedGv_.noalias() += creCache.projectedBm_.transpose() * SvMap;
+
+  // projected feedback
+  creCache.projectedKm_ = -(creCache.projectedGm_ + creCache.projectedKm_);
+  // projected feedforward
+  creCache.projectedLv_ = -(creCache.projectedGv_ + creCache.projectedLv_);
+
+  // precomputation
+  // [COMPLEXITY: nx^3 + nx^2 * np]
+  creCache.SmTrans_projectedAm_.noalias() = SmMap.transpose() * creCache.projectedAm_;
+  creCache.projectedKm_T_projectedGm_.noalias() = creCache.projectedKm_.transpose() * creCache.projectedGm_;
+  if (!reducedFormRiccati) {
+    // Rm
+    interpolate(indexAlpha, projectedModelData, model_data::cost_dfduu, creCache.projectedRm_);
+    // [COMPLEXITY: nx * np^2]
+    creCache.projectedRm_projectedKm_.noalias() = creCache.projectedRm_ * creCache.projectedKm_;
+    // [COMPLEXITY: np^2]
+    creCache.projectedRm_projectedLv_.noalias() = creCache.projectedRm_ * creCache.projectedLv_;
+  }
+
+  /*
+   * Sm
+   *
+   * reducedFormRiccati:
+   *   [TOTAL COMPLEXITY: (nx^3) + 2(nx^2 * np)]
+   * other
+   *   [TOTAL COMPLEXITY: (nx^3) + 3(nx^2 * np) + (nx * np^2)]
+   */
+  // += deltaQm + Sm^T * Am + Am^T * Sm
+  dSmMap += creCache.deltaQm_ + creCache.SmTrans_projectedAm_ + creCache.SmTrans_projectedAm_.transpose();
+  if (reducedFormRiccati) {
+    // += Km^T * Gm-
+    dSmMap += creCache.projectedKm_T_projectedGm_;
+  } else {
+    // += Km^T * Gm + Gm^T * Km
+    dSmMap += creCache.projectedKm_T_projectedGm_ + creCache.projectedKm_T_projectedGm_.transpose();
+    // += Km^T * Hm * Km
+    dSmMap.noalias() += creCache.projectedKm_.transpose() * creCache.projectedRm_projectedKm_;
+  }
+
+  /*
+   * Sv
+   *
+   * reducedFormRiccati:
+   *   [TOTAL COMPLEXITY: 2*(nx^2) + (nx * np)]
+   * other
+   *   [TOTAL COMPLEXITY: 2*(nx^2) + 3(nx * np)]
+   */
+  // += Sm * Hv
+  dSvMap.noalias() += SmMap.transpose() * creCache.projectedHv_;
+  // += Am^T * Sv
+  dSvMap.noalias() += creCache.projectedAm_.transpose() * SvMap;
+  if (reducedFormRiccati) {
+    // += Gm^T * Lv
+    dSvMap.noalias() += creCache.projectedGm_.transpose() * creCache.projectedLv_;
+  } else {
+    // += Gm^T * Lv
+    dSvMap.noalias() += creCache.projectedGm_.transpose() * creCache.projectedLv_;
+    // += Km^T * Gv
+    dSvMap.noalias() += creCache.projectedKm_.transpose() * creCache.projectedGv_;
+    // Km^T * Hm * Lv
+    dSvMap.noalias() += creCache.projectedRm_projectedKm_.transpose() * creCache.projectedLv_;
+  }
+
+  /*
+   * ds
+   * reducedFormRiccati:
+   *   [TOTAL COMPLEXITY: nx + np]
+   * other
+   *   [TOTAL COMPLEXITY: nx + 2np + np^2]
+   */
+  // += Hv^T * Sv
+  ds += creCache.projectedHv_.dot(SvMap);
+  if (reducedFormRiccati) {
+    // += 0.5 Lv^T Gv
+    ds += 0.5 * creCache.projectedLv_.dot(creCache.projectedGv_);
+  } else {
+    // += Lv^T Gv
+    ds += creCache.projectedLv_.dot(creCache.projectedGv_);
+    // += 0.5 Lv^T Hm Lv
+    ds += 0.5 * creCache.projectedLv_.dot(creCache.projectedRm_projectedLv_);
+  }
+}
+
+/**
+ * Dispatches computeFlowMapSLQImpl to the fixed-size or the dynamic-size implementation.
+ */
+struct ComputeFlowMapSLQKernel {
+  template <int NX, int NU>
+  void runFixedSize() {
+    FixedSizeContinuousTimeRiccatiData<NX, NU> fixedSizeCache;
+    computeFlowMapSLQImpl<NX, NU>(reducedFormRiccati, indexAlpha, projectedModelData, riccatiModification, Sm, Sv, fixedSizeCache, dSm,
+                                  dSv, ds);
+  }
+
+  void runDynamicSize() {
+    computeFlowMapSLQImpl<Eigen::Dynamic, Eigen::Dynamic>(reducedFormRiccati, indexAlpha, projectedModelData, riccatiModification, Sm, Sv,
+                                                          creCache, dSm, dSv, ds);
+  }
+
+  bool reducedFormRiccati;
+  LinearInterpolation::index_alpha_t indexAlpha;
+  const std::vector<ModelData>& projectedModelData;
+  const std::vector<riccati_modification::Data>& riccatiModification;
+  const matrix_t& Sm;
+  const vector_t& Sv;
+  ContinuousTimeRiccatiData& creCache;
+  matrix_t& dSm;
+  vector_t& dSv;
+  scalar_t& ds;
+};
+
+}  // namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -49,6 +261,13 @@ void ContinuousTimeRiccatiEquations::setRiskSensitiveCoefficient(scalar_t riskSe
   riskSensitiveCoeff_ = riskSensitiveCoeff;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContinuousTimeRiccatiEquations::setUseFixedSizeKernels(bool useFixedSizeKernels) {
+  useFixedSizeKernels_ = useFixedSizeKernels;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -121,6 +340,7 @@ void ContinuousTimeRiccatiEquations::setData(const scalar_array_t* timeStampPtr,
   projectedModelDataPtr_ = projectedModelDataPtr;
   modelDataEventTimesPtr_ = modelDataEventTimesPtr;
   riccatiModificationPtr_ = riccatiModificationPtr;
+  timeSegmentCursor_.reset();
 
   eventTimes_.clear();
   eventTimes_.reserve(eventsPastTheEndIndecesPtr->size());
@@ -152,7 +372,7 @@ vector_t ContinuousTimeRiccatiEquations::computeJumpMap(scalar_t z, const vector
 vector_t ContinuousTimeRiccatiEquations::computeFlowMap(scalar_t z, const vector_t& allSs) {
   // index
   const scalar_t t = -z;  // denormalized time
-  const auto indexAlpha = LinearInterpolation::timeSegment(t, *timeStampPtr_);
+  const auto indexAlpha = timeSegmentCursor_.timeSegment(t, *timeStampPtr_);
 
   convert2Matrix(allSs, continuousTimeRiccatiData_.Sm_, continuousTimeRiccatiData_.Sv_, continuousTimeRiccatiData_.s_);
   if (isRiskSensitive_) {
@@ -174,120 +394,19 @@ vector_t ContinuousTimeRiccatiEquations::computeFlowMap(scalar_t z, const vector
 void ContinuousTimeRiccatiEquations::computeFlowMapSLQ(std::pair<int, scalar_t> indexAlpha, const matrix_t& Sm, const vector_t& Sv,
                                                        const scalar_t& s, ContinuousTimeRiccatiData& creCache, matrix_t& dSm, vector_t& dSv,
                                                        scalar_t& ds) const {
-  /* note: according to some discussions on stackoverflow, it does not buy
-   * computation time if multiplications with symmetric matrices are executed
-   * using selfadjointView(). Doing the full multiplication seems to be faster
-   * because of vectorization
-   */
-
-  // Hv
-  creCache.projectedHv_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::dynamicsBias);
-  // Am
-  creCache.projectedAm_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::dynamics_dfdx);
-  // Bm
-  creCache.projectedBm_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::dynamics_dfdu);
-  // q
-  ds = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_f);
-  // Qv
-  dSv = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_dfdx);
-  // Qm
-  dSm = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_dfdxx);
-  // Rv
-  creCache.projectedGv_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_dfdu);
-  // Pm
-  creCache.projectedGm_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_dfdux);
-  // delatQm
-  creCache.deltaQm_ = LinearInterpolation::interpolate(indexAlpha, *riccatiModificationPtr_, riccati_modification::deltaQm);
-  // delatGm
-  creCache.projectedKm_ = LinearInterpolation::interpolate(indexAlpha, *riccatiModificationPtr_, riccati_modification::deltaGm);
-  // delatGv
-  creCache.projectedLv_ = LinearInterpolation::interpolate(indexAlpha, *riccatiModificationPtr_, riccati_modification::deltaGv);
-
-  // projectedGm = projectedPm + projectedBm^T * Sm [COMPLEXITY: nx^2 * np]
-  creCache.projectedGm_.noalias() += creCache.projectedBm_.transpose() * Sm;
-
-  // projectedGv = projectedRv + projectedBm^T * Sv [COMPLEXITY: nx * np]
-  creCache.projectedGv_.noalias() += creCache.projectedBm_.transpose() * Sv;
-
-  // projected feedback
-  creCache.projectedKm_ = -(creCache.projectedGm_ + creCache.projectedKm_);
-  // projected feedforward
-  creCache.projectedLv_ = -(creCache.projectedGv_ + creCache.projectedLv_);
-
-  // precomputation
-  // [COMPLEXITY: nx^3 + nx^2 * np]
-  creCache.SmTrans_projectedAm_.noalias() = Sm.transpose() * creCache.projectedAm_;
-  creCache.projectedKm_T_projectedGm_.noalias() = creCache.projectedKm_.transpose() * creCache.projectedGm_;
-  if (!reducedFormRiccati_) {
-    // Rm
-    creCache.projectedRm_ = LinearInterpolation::interpolate(indexAlpha, *projectedModelDataPtr_, model_data::cost_dfduu);
-    // [COMPLEXITY: nx * np^2]
-    creCache.projectedRm_projectedKm_.noalias() = creCache.projectedRm_ * creCache.projectedKm_;
-    // [COMPLEXITY: np^2]
-    creCache.projectedRm_projectedLv_.noalias() = creCache.projectedRm_ * creCache.projectedLv_;
+  ComputeFlowMapSLQKernel kernel{reducedFormRiccati_, indexAlpha, *projectedModelDataPtr_, *riccatiModificationPtr_, Sm, Sv, creCache,
+                                 dSm,                 dSv,        ds};
+
+  // the fixed-size kernels require the same input dimension at both ends of the interpolation interval
+  const auto& projectedModelData = *projectedModelDataPtr_;
+  auto inputDim = projectedModelData[indexAlpha.first].dynamics.dfdu.cols();
+  if (projectedModelData.size() > 1 && projectedModelData[indexAlpha.first + 1].dynamics.dfdu.cols() != inputDim) {
+    inputDim = Eigen::Dynamic;
   }
-
-  /*
-   * Sm
-   *
-   * reducedFormRiccati:
-   *   [TOTAL COMPLEXITY: (nx^3) + 2(nx^2 * np)]
-   * other
-   *   [TOTAL COMPLEXITY: (nx^3) + 3(nx^2 * np) + (nx * np^2)]
-   */
-  // += deltaQm + Sm^T * Am + Am^T * Sm
-  dSm += creCache.deltaQm_ + creCache.SmTrans_projectedAm_ + creCache.SmTrans_projectedAm_.transpose();
-  if (reducedFormRiccati_) {
-    // += Km^T * Gm-
-    dSm += creCache.projectedKm_T_projectedGm_;
-  } else {
-    // += Km^T * Gm + Gm^T * Km
-    dSm += creCache.projectedKm_T_projectedGm_ + creCache.projectedKm_T_projectedGm_.transpose();
-    // += Km^T * Hm * Km
-    dSm.noalias() += creCache.projectedKm_.transpose() * creCache.projectedRm_projectedKm_;
-  }
-
-  /*
-   * Sv
-   *
-   * reducedFormRiccati:
-   *   [TOTAL COMPLEXITY: 2*(nx^2) + (nx * np)]
-   * other
-   *   [TOTAL COMPLEXITY: 2*(nx^2) + 3(nx * np)]
-   */
-  // += Sm * Hv
-  dSv.noalias() += Sm.transpose() * creCache.projectedHv_;
-  // += Am^T * Sv
-  dSv.noalias() += creCache.projectedAm_.transpose() * Sv;
-  if (reducedFormRiccati_) {
-    // += Gm^T * Lv
-    dSv.noalias() += creCache.projectedGm_.transpose() * creCache.projectedLv_;
+  if (useFixedSizeKernels_) {
+    fixed_size::dispatch(Sm.rows(), inputDim, kernel, fixed_size::RiccatiDimensions());
   } else {
-    // += Gm^T * Lv
-    dSv.noalias() += creCache.projectedGm_.transpose() * creCache.projectedLv_;
-    // += Km^T * Gv
-    dSv.noalias() += creCache.projectedKm_.transpose() * creCache.projectedGv_;
-    // Km^T * Hm * Lv
-    dSv.noalias() += creCache.projectedRm_projectedKm_.transpose() * creCache.projectedLv_;
-  }
-
-  /*
-   * ds
-   * reducedFormRiccati:
-   *   [TOTAL COMPLEXITY: nx + np]
-   * other
-   *   [TOTAL COMPLEXITY: nx + 2np + np^2]
-   */
-  // += Hv^T * Sv
-  ds += creCache.projectedHv_.dot(Sv);
-  if (reducedFormRiccati_) {
-    // += 0.5 Lv^T Gv
-    ds += 0.5 * creCache.projectedLv_.dot(creCache.projectedGv_);
-  } else {
-    // += Lv^T Gv
-    ds += creCache.projectedLv_.dot(creCache.projectedGv_);
-    // += 0.5 Lv^T Hm Lv
-    ds += 0.5 * creCache.projectedLv_.dot(creCache.projectedRm_projectedLv_);
+    kernel.runDynamicSize();
   }
 }
 
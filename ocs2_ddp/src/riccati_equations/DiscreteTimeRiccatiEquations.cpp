@@ -29,108 +29,131 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_ddp/riccati_equations/DiscreteTimeRiccatiEquations.h>
 
+#include <ocs2_ddp/riccati_equations/FixedSizeDispatch.h>
+
 namespace ocs2 {
 
-/******************************************************************************************************/
-/******************************************************************************************************/
-/******************************************************************************************************/
-DiscreteTimeRiccatiEquations::DiscreteTimeRiccatiEquations(bool reducedFormRiccati, bool isRiskSensitive)
-    : reducedFormRiccati_(reducedFormRiccati), isRiskSensitive_(isRiskSensitive) {}
+namespace {
 
-/******************************************************************************************************/
-/******************************************************************************************************/
-/******************************************************************************************************/
-void DiscreteTimeRiccatiEquations::setRiskSensitiveCoefficient(scalar_t riskSensitiveCoeff) {
-  riskSensitiveCoeff_ = riskSensitiveCoeff;
-}
+/**
+ * Stack-allocated counterpart of DiscreteTimeRiccatiData which is used by the fixed-size kernels.
+ */
+template <int NX, int NU>
+struct FixedSizeDiscreteTimeRiccatiData {
+  Eigen::Matrix<scalar_t, NX, 1> Sm_projectedHv_;
+  Eigen::Matrix<scalar_t, NX, NX> Sm_projectedAm_;
+  Eigen::Matrix<scalar_t, NX, NU> Sm_projectedBm_;
+  Eigen::Matrix<scalar_t, NX, 1> Sv_plus_Sm_projectedHv_;
 
-/******************************************************************************************************/
-/******************************************************************************************************/
-/******************************************************************************************************/
-void DiscreteTimeRiccatiEquations::computeMap(const ModelData& projectedModelData, const riccati_modification::Data& riccatiModification,
-                                              const matrix_t& SmNext, const vector_t& SvNext, const scalar_t& sNext, matrix_t& projectedKm,
-                                              vector_t& projectedLv, matrix_t& Sm, vector_t& Sv, scalar_t& s) {
-  if (isRiskSensitive_) {
-    computeMapILEG(projectedModelData, riccatiModification, SmNext, SvNext, sNext, discreteTimeRiccatiData_, projectedKm, projectedLv, Sm,
-                   Sv, s);
-  } else {
-    computeMapILQR(projectedModelData, riccatiModification, SmNext, SvNext, sNext, discreteTimeRiccatiData_, projectedKm, projectedLv, Sm,
-                   Sv, s);
-  }
-}
+  Eigen::Matrix<scalar_t, NU, NU> projectedHm_;
+  Eigen::Matrix<scalar_t, NU, NX> projectedGm_;
+  Eigen::Matrix<scalar_t, NU, 1> projectedGv_;
+
+  Eigen::Matrix<scalar_t, NX, NX> projectedKm_T_projectedGm_;
+  Eigen::Matrix<scalar_t, NU, NX> projectedHm_projectedKm_;
+  Eigen::Matrix<scalar_t, NU, 1> projectedHm_projectedLv_;
+};
+
+/**
+ * Computes one step Riccati difference equations for ILQR formulation. The state and input dimensions, NX and NU, are
+ * either fixed at compile time or Eigen::Dynamic. In the latter case, Cache is DiscreteTimeRiccatiData.
+ */
+template <int NX, int NU, class Cache>
+void computeMapILQRImpl(bool reducedFormRiccati, const ModelData& projectedModelData, const riccati_modification::Data& riccatiModification,
+                        const matrix_t& SmNext, const vector_t& SvNext, const scalar_t& sNext, Cache& dreCache, matrix_t& projectedKm,
+                        vector_t& projectedLv, matrix_t& Sm, vector_t& Sv, scalar_t& s) {
+  const auto nx = projectedModelData.dynamics.dfdu.rows();
+  const auto nu = projectedModelData.dynamics.dfdu.cols();
+
+  // inputs
+  const fixed_size::const_matrix_map_t<NX, NX> SmNextMap(SmNext.data(), nx, nx);
+  const fixed_size::const_matrix_map_t<NX, 1> SvNextMap(SvNext.data(), nx, 1);
+  const fixed_size::const_matrix_map_t<NX, 1> projectedHv(projectedModelData.dynamicsBias.data(), nx, 1);
+  const fixed_size::const_matrix_map_t<NX, NX> projectedAm(projectedModelData.dynamics.dfdx.data(), nx, nx);
+  const fixed_size::const_matrix_map_t<NX, NU> projectedBm(projectedModelData.dynamics.dfdu.data(), nx, nu);
+  const fixed_size::const_matrix_map_t<NX, NX> Qm(projectedModelData.cost.dfdxx.data(), nx, nx);
+  const fixed_size::const_matrix_map_t<NX, 1> Qv(projectedModelData.cost.dfdx.data(), nx, 1);
+  const fixed_size::const_matrix_map_t<NU, NU> projectedRm(projectedModelData.cost.dfduu.data(), nu, nu);
+  const fixed_size::const_matrix_map_t<NU, NX> projectedPm(projectedModelData.cost.dfdux.data(), nu, nx);
+  const fixed_size::const_matrix_map_t<NU, 1> projectedRv(projectedModelData.cost.dfdu.data(), nu, 1);
+  const fixed_size::const_matrix_map_t<NX, NX> deltaQm(riccatiModification.deltaQm_.data(), nx, nx);
+  const fixed_size::const_matrix_map_t<NU, NX> deltaGm(riccatiModification.deltaGm_.data(), nu, nx);
+  const fixed_size::const_matrix_map_t<NU, 1> deltaGv(riccatiModification.deltaGv_.data(), nu, 1);
+
+  // outputs
+  projectedKm.resize(nu, nx);
+  projectedLv.resize(nu);
+  Sm.resize(nx, nx);
+  Sv.resize(nx);
+  fixed_size::matrix_map_t<NU, NX> KmMap(projectedKm.data(), nu, nx);
+  fixed_size::matrix_map_t<NU, 1> LvMap(projectedLv.data(), nu, 1);
+  fixed_size::matrix_map_t<NX, NX> SmMap(Sm.data(), nx, nx);
+  fixed_size::matrix_map_t<NX, 1> SvMap(Sv.data(), nx, 1);
 
-/******************************************************************************************************/
-/******************************************************************************************************/
-/******************************************************************************************************/
-void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedModelData,
-                                                  const riccati_modification::Data& riccatiModification, const matrix_t& SmNext,
-                                                  const vector_t& SvNext, const scalar_t& sNext, DiscreteTimeRiccatiData& dreCache,
-                                                  matrix_t& projectedKm, vector_t& projectedLv, matrix_t& Sm, vector_t& Sv,
-                                                  scalar_t& s) const {
   // precomputation (1)
-  dreCache.Sm_projectedHv_.noalias() = SmNext * projectedModelData.dynamicsBias;
-  dreCache.Sm_projectedAm_.noalias() = SmNext * projectedModelData.dynamics.dfdx;
-  dreCache.Sm_projectedBm_.noalias() = SmNext * projectedModelData.dynamics.dfdu;
-  dreCache.Sv_plus_Sm_projectedHv_ = SvNext + dreCache.Sm_projectedHv_;
+  dreCache.Sm_projectedHv_.noalias() = SmNextMap * projectedHv;
+  dreCache.Sm_projectedAm_.noalias() = SmNextMap * projectedAm;
+  dreCache.Sm_projectedBm_.noalias() = SmNextMap * projectedBm;
+  dreCache.Sv_plus_Sm_projectedHv_ = SvNextMap + dreCache.Sm_projectedHv_;
 
   // projectedGm = projectedPm + projectedBm^T * Sm * projectedAm
-  dreCache.projectedGm_ = projectedModelData.cost.dfdux;
-  dreCache.projectedGm_.noalias() += projectedModelData.dynamics.dfdu.transpose() * dreCache.Sm_projectedAm_;
+  dreCache.projectedGm_ = projectedPm;
+  dreCache.projectedGm_.noalias() += projectedBm.transpose() * dreCache.Sm_projectedAm_;
 
   // projectedGv = projectedRv + projectedBm^T * (Sv + Sm * projectedHv)
-  dreCache.projectedGv_ = projectedModelData.cost.dfdu;
-  dreCache.projectedGv_.noalias() += projectedModelData.dynamics.dfdu.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
+  dreCache.projectedGv_ = projectedRv;
+  dreCache.projectedGv_.noalias() += projectedBm.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
 
   // projected feedback
-  projectedKm = -dreCache.projectedGm_ - riccatiModification.deltaGm_;
+  KmMap = -dreCache.projectedGm_ - deltaGm;
   // projected feedforward
-  projectedLv = -dreCache.projectedGv_ - riccatiModification.deltaGv_;
+  LvMap = -dreCache.projectedGv_ - deltaGv;
 
   // precomputation (2)
-  dreCache.projectedKm_T_projectedGm_.noalias() = projectedKm.transpose() * dreCache.projectedGm_;
-  if (!reducedFormRiccati_) {
+  dreCache.projectedKm_T_projectedGm_.noalias() = KmMap.transpose() * dreCache.projectedGm_;
+  if (!reducedFormRiccati) {
     // projectedHm
-    dreCache.projectedHm_ = projectedModelData.cost.dfduu;
-    dreCache.projectedHm_.noalias() += dreCache.Sm_projectedBm_.transpose() * projectedModelData.dynamics.dfdu;
+    dreCache.projectedHm_ = projectedRm;
+    dreCache.projectedHm_.noalias() += dreCache.Sm_projectedBm_.transpose() * projectedBm;
 
-    dreCache.projectedHm_projectedKm_.noalias() = dreCache.projectedHm_ * projectedKm;
-    dreCache.projectedHm_projectedLv_.noalias() = dreCache.projectedHm_ * projectedLv;
+    dreCache.projectedHm_projectedKm_.noalias() = dreCache.projectedHm_ * KmMap;
+    dreCache.projectedHm_projectedLv_.noalias() = dreCache.projectedHm_ * LvMap;
   }
 
   /*
    * Sm
    */
   // = Qm + deltaQm
-  Sm = projectedModelData.cost.dfdxx + riccatiModification.deltaQm_;
+  SmMap = Qm + deltaQm;
   // += Am^T * Sm * Am
-  Sm.noalias() += dreCache.Sm_projectedAm_.transpose() * projectedModelData.dynamics.dfdx;
-  if (reducedFormRiccati_) {
+  SmMap.noalias() += dreCache.Sm_projectedAm_.transpose() * projectedAm;
+  if (reducedFormRiccati) {
     // += Km^T * Gm + Gm^T * Km
-    Sm += dreCache.projectedKm_T_projectedGm_;
+    SmMap += dreCache.projectedKm_T_projectedGm_;
   } else {
     // += Km^T * Gm + Gm^T * Km
-    Sm += dreCache.projectedKm_T_projectedGm_ + dreCache.projectedKm_T_projectedGm_.transpose();
+    SmMap += dreCache.projectedKm_T_projectedGm_ + dreCache.projectedKm_T_projectedGm_.transpose();
     // += Km^T * Hm * Km
-    Sm.noalias() += projectedKm.transpose() * dreCache.projectedHm_projectedKm_;
+    SmMap.noalias() += KmMap.transpose() * dreCache.projectedHm_projectedKm_;
   }
 
   /*
    * Sv
    */
   // = Qv
-  Sv = projectedModelData.cost.dfdx;
+  SvMap = Qv;
   // += Am^T * (Sv + Sm * Hv)
-  Sv.noalias() += projectedModelData.dynamics.dfdx.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
-  if (reducedFormRiccati_) {
+  SvMap.noalias() += projectedAm.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
+  if (reducedFormRiccati) {
     // += Gm^T * Lv
-    Sv.noalias() += dreCache.projectedGm_.transpose() * projectedLv;
+    SvMap.noalias() += dreCache.projectedGm_.transpose() * LvMap;
   } else {
     // += Gm^T * Lv
-    Sv.noalias() += dreCache.projectedGm_.transpose() * projectedLv;
+    SvMap.noalias() += dreCache.projectedGm_.transpose() * LvMap;
     // += Km^T * Gv
-    Sv.noalias() += projectedKm.transpose() * dreCache.projectedGv_;
+    SvMap.noalias() += KmMap.transpose() * dreCache.projectedGv_;
     // Km^T * Hm * Lv
-    Sv.noalias() += dreCache.projectedHm_projectedKm_.transpose() * projectedLv;
+    SvMap.noalias() += dreCache.projectedHm_projectedKm_.transpose() * LvMap;
   }
 
   /*
@@ -139,17 +162,102 @@ void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedMode
   // = s + q
   s = sNext + projectedModelData.cost.f;
   // += Hv^T * (Sv + Sm * Hv)
-  s += projectedModelData.dynamicsBias.dot(dreCache.Sv_plus_Sm_projectedHv_);
+  s += projectedHv.dot(dreCache.Sv_plus_Sm_projectedHv_);
   // -= 0.5 Hv^T * Sm * Hv
-  s -= 0.5 * projectedModelData.dynamicsBias.dot(dreCache.Sm_projectedHv_);
-  if (reducedFormRiccati_) {
+  s -= 0.5 * projectedHv.dot(dreCache.Sm_projectedHv_);
+  if (reducedFormRiccati) {
     // += 0.5 Lv^T Gv
-    s += 0.5 * projectedLv.dot(dreCache.projectedGv_);
+    s += 0.5 * LvMap.dot(dreCache.projectedGv_);
   } else {
     // += Lv^T Gv
-    s += projectedLv.dot(dreCache.projectedGv_);
+    s += LvMap.dot(dreCache.projectedGv_);
     // += 0.5 Lv^T Hm Lv
-    s += 0.5 * projectedLv.dot(dreCache.projectedHm_projectedLv_);
+    s += 0.5 * LvMap.dot(dreCache.projectedHm_projectedLv_);
+  }
+}
+
+/**
+ * Dispatches computeMapILQRImpl to the fixed-size or the dynamic-size implementation.
+ */
+struct ComputeMapILQRKernel {
+  template <int NX, int NU>
+  void runFixedSize() {
+    FixedSizeDiscreteTimeRiccatiData<NX, NU> fixedSizeCache;
+    computeMapILQRImpl<NX, NU>(reducedFormRiccati, projectedModelData, riccatiModification, SmNext, SvNext, sNext, fixedSizeCache,
+                               projectedKm, projectedLv, Sm, Sv, s);
+  }
+
+  void runDynamicSize() {
+    computeMapILQRImpl<Eigen::Dynamic, Eigen::Dynamic>(reducedFormRiccati, projectedModelData, riccatiModification, SmNext, SvNext, sNext,
+                                                       dreCache, projectedKm, projectedLv, Sm, Sv, s);
+  }
+
+  bool reducedFormRiccati;
+  const ModelData& projectedModelData;
+  const riccati_modification::Data& riccatiModification;
+  const matrix_t& SmNext;
+  const vector_t& SvNext;
+  const scalar_t& sNext;
+  DiscreteTimeRiccatiData& dreCache;
+  matrix_t& projectedKm;
+  vector_t& projectedLv;
+  matrix_t& Sm;
+  vector_t& Sv;
+  scalar_t& s;
+};
+
+}  // namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+DiscreteTimeRiccatiEquations::DiscreteTimeRiccatiEquations(bool reducedFormRiccati, bool isRiskSensitive)
+    : reducedFormRiccati_(reducedFormRiccati), isRiskSensitive_(isRiskSensitive) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void DiscreteTimeRiccatiEquations::setRiskSensitiveCoefficient(scalar_t riskSensitiveCoeff) {
+  riskSensitiveCoeff_ = riskSensitiveCoeff;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void DiscreteTimeRiccatiEquations::setUseFixedSizeKernels(bool useFixedSizeKernels) {
+  useFixedSizeKernels_ = useFixedSizeKernels;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void DiscreteTimeRiccatiEquations::computeMap(const ModelData& projectedModelData, const riccati_modification::Data& riccatiModification,
+                                              const matrix_t& SmNext, const vector_t& SvNext, const scalar_t& sNext, matrix_t& projectedKm,
+                                              vector_t& projectedLv, matrix_t& Sm, vector_t& Sv, scalar_t& s) {
+  if (isRiskSensitive_) {
+    computeMapILEG(projectedModelData, riccatiModification, SmNext, SvNext, sNext, discreteTimeRiccatiData_, projectedKm, projectedLv, Sm,
+                   Sv, s);
+  } else {
+    computeMapILQR(projectedModelData, riccatiModification, SmNext, SvNext, sNext, discreteTimeRiccatiData_, projectedKm, projectedLv, Sm,
+                   Sv, s);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedModelData,
+                                                  const riccati_modification::Data& riccatiModification, const matrix_t& SmNext,
+                                                  const vector_t& SvNext, const scalar_t& sNext, DiscreteTimeRiccatiData& dreCache,
+                                                  matrix_t& projectedKm, vector_t& projectedLv, matrix_t& Sm, vector_t& Sv,
+                                                  scalar_t& s) const {
+  ComputeMapILQRKernel kernel{reducedFormRiccati_, projectedModelData, riccatiModification, SmNext, SvNext, sNext, dreCache,
+                              projectedKm,         projectedLv,        Sm,                  Sv,     s};
+  const auto& projectedBm = projectedModelData.dynamics.dfdu;
+  if (useFixedSizeKernels_) {
+    fixed_size::dispatch(projectedBm.rows(), projectedBm.cols(), kernel, fixed_size::RiccatiDimensions());
+  } else {
+    kernel.runDynamicSize();
   }
 }
 
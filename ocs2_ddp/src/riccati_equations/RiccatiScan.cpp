@@ -0,0 +1,151 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "ocs2_ddp/riccati_equations/RiccatiScan.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+
+namespace ocs2 {
+namespace riccati_scan {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Element createFinalElement(const ScalarFunctionQuadraticApproximation& valueFunction) {
+  const auto stateDim = valueFunction.dfdx.rows();
+
+  Element element;
+  element.A.setZero(stateDim, stateDim);
+  element.b.setZero(stateDim);
+  element.C.setZero(stateDim, stateDim);
+  element.eta = -valueFunction.dfdx;
+  element.J = valueFunction.dfdxx;
+  element.gamma = valueFunction.f;
+  return element;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Element createIntermediateElement(const ModelData& projectedModelData, const riccati_modification::Data& riccatiModification) {
+  const auto& Hv = projectedModelData.dynamicsBias;
+  const auto& Am = projectedModelData.dynamics.dfdx;
+  const auto& Bm = projectedModelData.dynamics.dfdu;
+  const auto& Qm = projectedModelData.cost.dfdxx;
+  const auto& Qv = projectedModelData.cost.dfdx;
+  const auto& Rm = projectedModelData.cost.dfduu;
+  const auto& Pm = projectedModelData.cost.dfdux;
+  const auto& Rv = projectedModelData.cost.dfdu;
+
+  // eliminate the input: u = -inv(Rm) * (Pm * x + Rv) + w
+  const Eigen::LLT<matrix_t> RmLLT(Rm);
+  const matrix_t RmInvPm = RmLLT.solve(Pm);
+  const vector_t RmInvRv = RmLLT.solve(Rv);
+  const matrix_t RmInvBmT = RmLLT.solve(Bm.transpose());
+
+  Element element;
+  element.A = Am;
+  element.A.noalias() -= Bm * RmInvPm;
+  element.b = Hv;
+  element.b.noalias() -= Bm * RmInvRv;
+  element.C.noalias() = Bm * RmInvBmT;
+  element.eta = -Qv;
+  element.eta.noalias() += Pm.transpose() * RmInvRv;
+  element.J = Qm + riccatiModification.deltaQm_;
+  element.J.noalias() -= Pm.transpose() * RmInvPm;
+  element.gamma = projectedModelData.cost.f - 0.5 * Rv.dot(RmInvRv);
+  return element;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Element createEventElement(const ModelData& jumpModelData) {
+  const auto stateDim = jumpModelData.dynamics.dfdx.rows();
+
+  Element element;
+  element.A = jumpModelData.dynamics.dfdx;
+  element.b = jumpModelData.dynamicsBias;
+  element.C.setZero(stateDim, stateDim);
+  element.eta = -jumpModelData.cost.dfdx;
+  element.J = jumpModelData.cost.dfdxx;
+  element.gamma = jumpModelData.cost.f;
+  return element;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Element combine(const Element& earlier, const Element& later) {
+  const auto& Ai = earlier.A;
+  const auto& bi = earlier.b;
+  const auto& Ci = earlier.C;
+  const auto& Aj = later.A;
+  const auto& Cj = later.C;
+  const auto& etaj = later.eta;
+  const auto& Jj = later.J;
+
+  // inv(I + Ci * Jj) and its transpose inv(I + Jj * Ci)
+  matrix_t I_plus_CiJj = Ci * Jj;
+  I_plus_CiJj.diagonal().array() += 1.0;
+  const matrix_t M = I_plus_CiJj.partialPivLu().inverse();
+
+  const matrix_t AjM = Aj * M;
+  const matrix_t AiT_MT = Ai.transpose() * M.transpose();
+  const vector_t MT_Jj_bi = M.transpose() * (Jj * bi);
+  const vector_t MT_etaj = M.transpose() * etaj;
+
+  Element element;
+  element.A.noalias() = AjM * Ai;
+  element.b = later.b;
+  element.b.noalias() += AjM * (bi + Ci * etaj);
+  element.C = Cj;
+  element.C.noalias() += AjM * Ci * Aj.transpose();
+  element.eta = earlier.eta;
+  element.eta.noalias() += AiT_MT * (etaj - Jj * bi);
+  element.J = earlier.J;
+  element.J.noalias() += AiT_MT * Jj * Ai;
+  element.gamma = earlier.gamma + later.gamma + 0.5 * bi.dot(MT_Jj_bi) - bi.dot(MT_etaj) - 0.5 * etaj.dot(Ci * MT_etaj);
+  return element;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ScalarFunctionQuadraticApproximation getValueFunction(const Element& element) {
+  ScalarFunctionQuadraticApproximation valueFunction;
+  valueFunction.f = element.gamma;
+  valueFunction.dfdx = -element.eta;
+  valueFunction.dfdxx = element.J;
+  return valueFunction;
+}
+
+}  // namespace riccati_scan
+}  // namespace ocs2
@@ -28,9 +28,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <thread>
 
 #include <ocs2_core/control/FeedforwardController.h>
 #include <ocs2_core/initialization/DefaultInitializer.h>
@@ -40,6 +42,26 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_ddp/ILQR.h>
 #include <ocs2_ddp/SLQ.h>
 
+/** Cost term without contribution that slows down every evaluation */
+class SlowZeroCost final : public ocs2::StateInputCost {
+ public:
+  SlowZeroCost* clone() const override { return new SlowZeroCost(*this); }
+
+  ocs2::scalar_t getValue(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input,
+                          const ocs2::TargetTrajectories& targetTrajectories, const ocs2::PreComputation& preComp) const override {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+    return 0.0;
+  }
+
+  ocs2::ScalarFunctionQuadraticApproximation getQuadraticApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                       const ocs2::vector_t& input,
+                                                                       const ocs2::TargetTrajectories& targetTrajectories,
+                                                                       const ocs2::PreComputation& preComp) const override {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+    return ocs2::ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+  }
+};
+
 class Exp0 : public testing::Test {
  protected:
   static constexpr size_t STATE_DIM = 2;
@@ -376,3 +398,72 @@ INSTANTIATE_TEST_CASE_P(Exp0ParamCase, Exp0Param,
                           name += std::get<1>(info.param) == 1 ? "SINGLE_THREAD" : "MULTI_THREAD";
                           return name;
                         });
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+TEST_F(Exp0, ddp_time_budget) {
+  // ddp settings
+  auto ddpSettings = getSettings(ocs2::ddp::Algorithm::SLQ, 2, ocs2::search_strategy::Type::LINE_SEARCH);
+  ddpSettings.minRelCost_ = 1e-6;
+
+  // dynamics and rollout
+  ocs2::EXP0_System systemDynamics(referenceManagerPtr);
+  ocs2::TimeTriggeredRollout rollout(systemDynamics, rolloutSettings());
+
+  // run without time budget
+  ocs2::SLQ ddpReference(ddpSettings, rollout, problem, *initializerPtr);
+  ddpReference.setReferenceManager(referenceManagerPtr);
+  ddpReference.run(startTime, initState, finalTime);
+  ASSERT_GT(ddpReference.getNumIterations(), 3);
+
+  // a budget which is far larger than the solve time does not cut any iteration
+  ocs2::SLQ ddpLargeBudget(ddpSettings, rollout, problem, *initializerPtr);
+  ddpLargeBudget.setReferenceManager(referenceManagerPtr);
+  ddpLargeBudget.setTimeBudget(1000.0);
+  ddpLargeBudget.run(startTime, initState, finalTime);
+  EXPECT_EQ(ddpLargeBudget.getNumIterations(), ddpReference.getNumIterations());
+  EXPECT_FALSE(ddpLargeBudget.isTimeBudgetMissed());
+  EXPECT_EQ(ddpLargeBudget.getNumTimeBudgetMisses(), 0);
+
+  // a budget which is shorter than the initialization stops before the first iteration, and still returns a full solution
+  ocs2::SLQ ddpSmallBudget(ddpSettings, rollout, problem, *initializerPtr);
+  ddpSmallBudget.setReferenceManager(referenceManagerPtr);
+  ddpSmallBudget.setTimeBudget(1e-9);
+  ddpSmallBudget.run(startTime, initState, finalTime);
+  EXPECT_EQ(ddpSmallBudget.getNumIterations(), 1);
+  EXPECT_TRUE(ddpSmallBudget.isTimeBudgetMissed());
+  EXPECT_EQ(ddpSmallBudget.getNumTimeBudgetMisses(), 1);
+  EXPECT_DOUBLE_EQ(ddpSmallBudget.primalSolution(finalTime).timeTrajectory_.back(), finalTime);
+
+  // the misses are counted over the runs
+  ddpSmallBudget.run(startTime, initState, finalTime);
+  EXPECT_EQ(ddpSmallBudget.getNumTimeBudgetMisses(), 2);
+  ddpSmallBudget.resetTimeBudgetMisses();
+  EXPECT_FALSE(ddpSmallBudget.isTimeBudgetMissed());
+  EXPECT_EQ(ddpSmallBudget.getNumTimeBudgetMisses(), 0);
+
+  // with a slowed down cost function, the solve time is dominated by the cost evaluations
+  problem.costPtr->add("slowZeroCost", std::unique_ptr<ocs2::StateInputCost>(new SlowZeroCost));
+  auto timedRun = [&](ocs2::SLQ& ddp) {
+    const auto runStartTime = std::chrono::steady_clock::now();
+    ddp.run(startTime, initState, finalTime);
+    return std::chrono::duration<ocs2::scalar_t>(std::chrono::steady_clock::now() - runStartTime).count();
+  };
+
+  ocs2::SLQ ddpSlowReference(ddpSettings, rollout, problem, *initializerPtr);
+  ddpSlowReference.setReferenceManager(referenceManagerPtr);
+  const auto slowReferenceDuration = timedRun(ddpSlowReference);
+  ASSERT_EQ(ddpSlowReference.getNumIterations(), ddpReference.getNumIterations());
+
+  // a budget of half the solve time cuts the iterations and bounds the latency
+  const ocs2::scalar_t timeBudget = 0.5 * slowReferenceDuration;
+  ocs2::SLQ ddpSlow(ddpSettings, rollout, problem, *initializerPtr);
+  ddpSlow.setReferenceManager(referenceManagerPtr);
+  ddpSlow.setTimeBudget(timeBudget);
+  const auto slowDuration = timedRun(ddpSlow);
+  EXPECT_LT(ddpSlow.getNumIterations(), ddpSlowReference.getNumIterations());
+  // generous bound, which leaves room for the jitter of the sleeps and of the scheduler
+  EXPECT_LT(slowDuration, 1.5 * timeBudget);
+  EXPECT_DOUBLE_EQ(ddpSlow.primalSolution(finalTime).timeTrajectory_.back(), finalTime);
+}
@@ -259,6 +259,83 @@ TEST_P(Exp1, ILQR) {
   performanceIndexTest(ddpSettings, performanceIndex);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+TEST_F(Exp1, ILQR_parallelRiccatiScan) {
+  // dynamics and rollout
+  ocs2::EXP1_System systemDynamics(referenceManagerPtr);
+  ocs2::TimeTriggeredRollout rollout(systemDynamics, rolloutSettings());
+
+  // the first iteration is solved sequentially without the scan, therefore both should have the same value function
+  auto sequentialSettings = getSettings(ocs2::ddp::Algorithm::ILQR, 1, ocs2::search_strategy::Type::LINE_SEARCH);
+  sequentialSettings.maxNumIterations_ = 1;
+  auto scanSettings = getSettings(ocs2::ddp::Algorithm::ILQR, 3, ocs2::search_strategy::Type::LINE_SEARCH);
+  scanSettings.maxNumIterations_ = 1;
+  scanSettings.useParallelRiccatiScan_ = true;
+
+  // the default multiple and a multiple that is large enough to change the Riccati modification of every node
+  const ocs2::scalar_t defaultMultiple = scanSettings.lineSearch_.hessianCorrectionMultiple;
+  for (const ocs2::scalar_t hessianCorrectionMultiple : {defaultMultiple, 0.5}) {
+    sequentialSettings.lineSearch_.hessianCorrectionMultiple = hessianCorrectionMultiple;
+    scanSettings.lineSearch_.hessianCorrectionMultiple = hessianCorrectionMultiple;
+
+    ocs2::ILQR sequentialDdp(sequentialSettings, rollout, problem, *initializerPtr);
+    sequentialDdp.setReferenceManager(referenceManagerPtr);
+    sequentialDdp.run(startTime, initState, finalTime);
+
+    ocs2::ILQR scanDdp(scanSettings, rollout, problem, *initializerPtr);
+    scanDdp.setReferenceManager(referenceManagerPtr);
+    scanDdp.run(startTime, initState, finalTime);
+
+    for (const ocs2::scalar_t time : {0.0, 0.5, 1.5, 2.5}) {
+      const auto sequentialValueFunction = sequentialDdp.getValueFunction(time, initState);
+      const auto scanValueFunction = scanDdp.getValueFunction(time, initState);
+      EXPECT_NEAR(scanValueFunction.f, sequentialValueFunction.f, 1e-6) << "multiple: " << hessianCorrectionMultiple << ", time: " << time;
+      EXPECT_TRUE(scanValueFunction.dfdx.isApprox(sequentialValueFunction.dfdx, 1e-6))
+          << "multiple: " << hessianCorrectionMultiple << ", time: " << time;
+      EXPECT_TRUE(scanValueFunction.dfdxx.isApprox(sequentialValueFunction.dfdxx, 1e-6))
+          << "multiple: " << hessianCorrectionMultiple << ", time: " << time;
+    }
+  }
+
+  // the other Hessian corrections depend on the value function of the next time step, the scan solves them as a single partition such
+  // that they stay exact after the first iteration
+  {
+    auto eigenvalueSequentialSettings = sequentialSettings;
+    auto eigenvalueScanSettings = scanSettings;
+    for (auto* settings : {&eigenvalueSequentialSettings, &eigenvalueScanSettings}) {
+      settings->maxNumIterations_ = 3;
+      settings->lineSearch_.hessianCorrectionStrategy = ocs2::hessian_correction::Strategy::EIGENVALUE_MODIFICATION;
+      settings->lineSearch_.hessianCorrectionMultiple = 0.5;
+    }
+
+    ocs2::ILQR sequentialDdp(eigenvalueSequentialSettings, rollout, problem, *initializerPtr);
+    sequentialDdp.setReferenceManager(referenceManagerPtr);
+    sequentialDdp.run(startTime, initState, finalTime);
+
+    ocs2::ILQR scanDdp(eigenvalueScanSettings, rollout, problem, *initializerPtr);
+    scanDdp.setReferenceManager(referenceManagerPtr);
+    scanDdp.run(startTime, initState, finalTime);
+
+    for (const ocs2::scalar_t time : {0.0, 0.5, 1.5, 2.5}) {
+      const auto sequentialValueFunction = sequentialDdp.getValueFunction(time, initState);
+      const auto scanValueFunction = scanDdp.getValueFunction(time, initState);
+      EXPECT_NEAR(scanValueFunction.f, sequentialValueFunction.f, 1e-6) << "time: " << time;
+      EXPECT_TRUE(scanValueFunction.dfdx.isApprox(sequentialValueFunction.dfdx, 1e-6)) << "time: " << time;
+      EXPECT_TRUE(scanValueFunction.dfdxx.isApprox(sequentialValueFunction.dfdxx, 1e-6)) << "time: " << time;
+    }
+  }
+
+  // run until convergence
+  scanSettings.maxNumIterations_ = 30;
+  scanSettings.lineSearch_.hessianCorrectionMultiple = defaultMultiple;
+  ocs2::ILQR ddp(scanSettings, rollout, problem, *initializerPtr);
+  ddp.setReferenceManager(referenceManagerPtr);
+  ddp.run(startTime, initState, finalTime);
+  performanceIndexTest(scanSettings, ddp.getPerformanceIndeces());
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
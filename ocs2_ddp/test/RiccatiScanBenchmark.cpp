@@ -0,0 +1,126 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include <ocs2_core/cost/QuadraticStateCost.h>
+#include <ocs2_core/cost/QuadraticStateInputCost.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_ddp/ILQR.h"
+
+using namespace ocs2;
+
+namespace {
+/** ILQR which times its backward pass */
+class BackwardPassTimedILQR final : public ILQR {
+ public:
+  using ILQR::ILQR;
+
+  const benchmark::RepeatedTimer& backwardPassTimer() const { return backwardPassTimer_; }
+
+ protected:
+  scalar_t solveSequentialRiccatiEquations(const ScalarFunctionQuadraticApproximation& finalValueFunction) override {
+    backwardPassTimer_.startTimer();
+    const auto avgTimeStep = ILQR::solveSequentialRiccatiEquations(finalValueFunction);
+    backwardPassTimer_.endTimer();
+    return avgTimeStep;
+  }
+
+ private:
+  benchmark::RepeatedTimer backwardPassTimer_;
+};
+}  // unnamed namespace
+
+/**
+ * Compares the backward pass of ILQR with and without the parallel Riccati scan for 100 to 2000 time nodes and 1 to 32 threads. The
+ * problem is a stable random linear system with a quadratic cost, such that the Riccati equations dominate the iteration.
+ * usage: riccati_scan_benchmark
+ */
+int main() {
+  constexpr int stateDim = 12;
+  constexpr int inputDim = 4;
+  constexpr int numIterations = 5;
+  constexpr scalar_t finalTime = 1.0;
+
+  // problem
+  const matrix_t A = 0.1 * matrix_t::Random(stateDim, stateDim) - matrix_t::Identity(stateDim, stateDim);
+  const matrix_t B = matrix_t::Random(stateDim, inputDim);
+  OptimalControlProblem problem;
+  problem.dynamicsPtr.reset(new LinearSystemDynamics(A, B));
+  problem.costPtr->add("cost", std::unique_ptr<StateInputCost>(new QuadraticStateInputCost(matrix_t::Identity(stateDim, stateDim),
+                                                                                            matrix_t::Identity(inputDim, inputDim))));
+  problem.finalCostPtr->add("finalCost", std::unique_ptr<StateCost>(new QuadraticStateCost(matrix_t::Identity(stateDim, stateDim))));
+
+  const vector_t initState = vector_t::Ones(stateDim);
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Zero(stateDim)}, {vector_t::Zero(inputDim)});
+  const DefaultInitializer initializer(inputDim);
+
+  std::cerr << "\nbackward pass per iteration [ms]\n";
+  std::cerr << "#nodes | #threads | sequential | scan\n";
+  for (const int numNodes : {100, 250, 500, 1000, 2000}) {
+    const scalar_t timeStep = finalTime / numNodes;
+
+    rollout::Settings rolloutSettings;
+    rolloutSettings.timeStep = timeStep;
+    rolloutSettings.integratorType = IntegratorType::RK4;
+    const TimeTriggeredRollout rollout(*problem.dynamicsPtr, rolloutSettings);
+
+    for (const size_t numThreads : {1, 2, 4, 8, 16, 32}) {
+      scalar_t averageTimes[2];
+      for (const bool useScan : {false, true}) {
+        ddp::Settings ddpSettings;
+        ddpSettings.algorithm_ = ddp::Algorithm::ILQR;
+        ddpSettings.nThreads_ = numThreads;
+        ddpSettings.maxNumIterations_ = numIterations;
+        ddpSettings.minRelCost_ = 0.0;
+        ddpSettings.timeStep_ = timeStep;
+        ddpSettings.backwardPassIntegratorType_ = IntegratorType::RK4;
+        ddpSettings.displayInfo_ = false;
+        ddpSettings.displayShortSummary_ = false;
+        ddpSettings.useParallelRiccatiScan_ = useScan;
+
+        BackwardPassTimedILQR ilqr(ddpSettings, rollout, problem, initializer);
+        ilqr.setReferenceManager(std::make_shared<ReferenceManager>(targetTrajectories));
+        ilqr.run(0.0, initState, finalTime);
+        averageTimes[useScan ? 1 : 0] = ilqr.backwardPassTimer().getAverageInMilliseconds();
+      }
+      std::cerr << std::setw(6) << numNodes << " | " << std::setw(8) << numThreads << " | " << std::setw(10) << averageTimes[0] << " | "
+                << averageTimes[1] << "\n";
+    }
+  }
+
+  return 0;
+}
@@ -34,6 +34,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/LinearAlgebra.h>
 #include <ocs2_core/misc/randomMatrices.h>
 #include <ocs2_ddp/riccati_equations/ContinuousTimeRiccatiEquations.h>
+#include <ocs2_ddp/riccati_equations/DiscreteTimeRiccatiEquations.h>
+#include <ocs2_ddp/riccati_equations/RiccatiScan.h>
+#include <ocs2_ddp/riccati_equations/RiccatiTransversalityConditions.h>
 
 class RiccatiInitializer {
  public:
@@ -155,3 +158,205 @@ TEST(RiccatiTest, testFlattenAndUnflatten) {
   ASSERT_TRUE(Sv.isApprox(Sv_out));
   ASSERT_TRUE(Sm.isApprox(Sm_out));
 }
+
+TEST(RiccatiTest, fixedAndDynamicSizeFlowMap) {
+  using riccati_t = ocs2::ContinuousTimeRiccatiEquations;
+
+  // (4, 1) and (12, 4) are evaluated with fixed-size kernels, (5, 2) with the dynamic-size kernel
+  const std::vector<std::pair<int, int>> dimensions{{4, 1}, {12, 4}, {5, 2}};
+  for (const auto& dims : dimensions) {
+    const int stateDim = dims.first;
+    const int inputDim = dims.second;
+    RiccatiInitializer ri(stateDim, inputDim);
+    riccati_t riccatiEquation(false);
+    ri.initialize(riccatiEquation);
+
+    const auto& data = ri.projectedModelDataTrajectory.front();
+    const auto& modification = ri.riccatiModificationTrajectory.front();
+    const ocs2::vector_t allSs = ocs2::vector_t::Random(ocs2::s_vector_dim(stateDim));
+    ocs2::matrix_t Sm;
+    ocs2::vector_t Sv;
+    ocs2::scalar_t s;
+    riccati_t::convert2Matrix(allSs, Sm, Sv, s);
+
+    const ocs2::matrix_t& Am = data.dynamics.dfdx;
+    const ocs2::matrix_t& Bm = data.dynamics.dfdu;
+    const ocs2::matrix_t& Rm = data.cost.dfduu;
+    const ocs2::matrix_t Gm = data.cost.dfdux + Bm.transpose() * Sm;
+    const ocs2::vector_t Gv = data.cost.dfdu + Bm.transpose() * Sv;
+    const ocs2::matrix_t Km = -(Gm + modification.deltaGm_);
+    const ocs2::vector_t Lv = -(Gv + modification.deltaGv_);
+    const ocs2::matrix_t dSm = data.cost.dfdxx + modification.deltaQm_ + Sm * Am + Am.transpose() * Sm + Km.transpose() * Gm +
+                               Gm.transpose() * Km + Km.transpose() * Rm * Km;
+    const ocs2::vector_t dSv = data.cost.dfdx + Sm * data.dynamicsBias + Am.transpose() * Sv + Gm.transpose() * Lv + Km.transpose() * Gv +
+                               Km.transpose() * Rm * Lv;
+    const ocs2::scalar_t ds = data.cost.f + data.dynamicsBias.dot(Sv) + Lv.dot(Gv) + 0.5 * Lv.dot(Rm * Lv);
+
+    const ocs2::vector_t dSdz = riccatiEquation.computeFlowMap(0.6, allSs);
+    const ocs2::vector_t dSdz_expected = riccati_t::convert2Vector(dSm, dSv, ds);
+    EXPECT_LE((dSdz - dSdz_expected).array().abs().maxCoeff(), 1e-9) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+  }
+}
+
+TEST(RiccatiTest, fixedAndDynamicSizeDiscreteMap) {
+  // (4, 1) and (12, 4) are evaluated with fixed-size kernels, (5, 2) with the dynamic-size kernel
+  const std::vector<std::pair<int, int>> dimensions{{4, 1}, {12, 4}, {5, 2}};
+  for (const auto& dims : dimensions) {
+    const int stateDim = dims.first;
+    const int inputDim = dims.second;
+    RiccatiInitializer ri(stateDim, inputDim);
+    ocs2::DiscreteTimeRiccatiEquations riccatiEquation(false);
+
+    const auto& data = ri.projectedModelDataTrajectory.front();
+    const auto& modification = ri.riccatiModificationTrajectory.front();
+    const ocs2::matrix_t SmNext = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(stateDim);
+    const ocs2::vector_t SvNext = ocs2::vector_t::Random(stateDim);
+    const ocs2::scalar_t sNext = ocs2::vector_t::Random(1)(0);
+
+    const ocs2::matrix_t& Am = data.dynamics.dfdx;
+    const ocs2::matrix_t& Bm = data.dynamics.dfdu;
+    const ocs2::vector_t& Hv = data.dynamicsBias;
+    const ocs2::vector_t Sv_plus_Sm_Hv = SvNext + SmNext * Hv;
+    const ocs2::matrix_t Hm = data.cost.dfduu + Bm.transpose() * SmNext * Bm;
+    const ocs2::matrix_t Gm = data.cost.dfdux + Bm.transpose() * SmNext * Am;
+    const ocs2::vector_t Gv = data.cost.dfdu + Bm.transpose() * Sv_plus_Sm_Hv;
+    const ocs2::matrix_t Km_expected = -Gm - modification.deltaGm_;
+    const ocs2::vector_t Lv_expected = -Gv - modification.deltaGv_;
+    const ocs2::matrix_t Sm_expected = data.cost.dfdxx + modification.deltaQm_ + Am.transpose() * SmNext * Am +
+                                       Km_expected.transpose() * Gm + Gm.transpose() * Km_expected +
+                                       Km_expected.transpose() * Hm * Km_expected;
+    const ocs2::vector_t Sv_expected = data.cost.dfdx + Am.transpose() * Sv_plus_Sm_Hv + Gm.transpose() * Lv_expected +
+                                       Km_expected.transpose() * Gv + Km_expected.transpose() * Hm * Lv_expected;
+    const ocs2::scalar_t s_expected = sNext + data.cost.f + Hv.dot(Sv_plus_Sm_Hv) - 0.5 * Hv.dot(SmNext * Hv) + Lv_expected.dot(Gv) +
+                                      0.5 * Lv_expected.dot(Hm * Lv_expected);
+
+    ocs2::matrix_t Km, Sm;
+    ocs2::vector_t Lv, Sv;
+    ocs2::scalar_t s;
+    riccatiEquation.computeMap(data, modification, SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+
+    EXPECT_TRUE(Km.isApprox(Km_expected)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Lv.isApprox(Lv_expected)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Sm.isApprox(Sm_expected)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Sv.isApprox(Sv_expected)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_NEAR(s, s_expected, 1e-9) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+  }
+}
+
+TEST(RiccatiTest, disabledFixedSizeKernels) {
+  // the fixed-size dimensions give the same result with the dynamic-size kernels
+  const std::vector<std::pair<int, int>> dimensions{{4, 1}, {12, 4}};
+  for (const auto& dims : dimensions) {
+    const int stateDim = dims.first;
+    const int inputDim = dims.second;
+    RiccatiInitializer ri(stateDim, inputDim);
+    ocs2::DiscreteTimeRiccatiEquations fixedSizeRiccatiEquation(false);
+    ocs2::DiscreteTimeRiccatiEquations dynamicSizeRiccatiEquation(false);
+    dynamicSizeRiccatiEquation.setUseFixedSizeKernels(false);
+
+    const auto& data = ri.projectedModelDataTrajectory.front();
+    const auto& modification = ri.riccatiModificationTrajectory.front();
+    const ocs2::matrix_t SmNext = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(stateDim);
+    const ocs2::vector_t SvNext = ocs2::vector_t::Random(stateDim);
+    const ocs2::scalar_t sNext = ocs2::vector_t::Random(1)(0);
+
+    ocs2::matrix_t Km, Sm, Km_dynamic, Sm_dynamic;
+    ocs2::vector_t Lv, Sv, Lv_dynamic, Sv_dynamic;
+    ocs2::scalar_t s, s_dynamic;
+    fixedSizeRiccatiEquation.computeMap(data, modification, SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+    dynamicSizeRiccatiEquation.computeMap(data, modification, SmNext, SvNext, sNext, Km_dynamic, Lv_dynamic, Sm_dynamic, Sv_dynamic,
+                                          s_dynamic);
+
+    EXPECT_TRUE(Km.isApprox(Km_dynamic)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Lv.isApprox(Lv_dynamic)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Sm.isApprox(Sm_dynamic)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_TRUE(Sv.isApprox(Sv_dynamic)) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+    EXPECT_NEAR(s, s_dynamic, 1e-9) << "stateDim: " << stateDim << ", inputDim: " << inputDim;
+  }
+}
+
+TEST(RiccatiTest, parallelScan) {
+  constexpr int stateDim = 6;
+  constexpr int inputDim = 3;
+  constexpr int numNodes = 20;
+  constexpr int eventNode = 11;
+
+  // random LQ problem, where the node eventNode is a pre-event node
+  std::vector<ocs2::ModelData> modelDataTrajectory(numNodes);
+  std::vector<ocs2::riccati_modification::Data> riccatiModificationTrajectory(numNodes);
+  for (int k = 0; k < numNodes; k++) {
+    RiccatiInitializer ri(stateDim, inputDim);
+    modelDataTrajectory[k] = ri.projectedModelDataTrajectory.front();
+    modelDataTrajectory[k].dynamics.dfdx *= 0.5;
+    modelDataTrajectory[k].cost.dfduu = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(inputDim);
+    riccatiModificationTrajectory[k] = ri.riccatiModificationTrajectory.front();
+  }
+
+  ocs2::ScalarFunctionQuadraticApproximation finalValueFunction;
+  finalValueFunction.dfdxx = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(stateDim);
+  finalValueFunction.dfdx = ocs2::vector_t::Random(stateDim);
+  finalValueFunction.f = ocs2::vector_t::Random(1)(0);
+
+  // sequential solution
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> valueFunctionTrajectory(numNodes + 1);
+  valueFunctionTrajectory[numNodes] = finalValueFunction;
+  for (int k = numNodes - 1; k >= 0; k--) {
+    const auto& next = valueFunctionTrajectory[k + 1];
+    auto& current = valueFunctionTrajectory[k];
+    const auto& data = modelDataTrajectory[k];
+    if (k == eventNode) {
+      std::tie(current.dfdxx, current.dfdx, current.f) = ocs2::riccatiTransversalityConditions(data, next.dfdxx, next.dfdx, next.f);
+      continue;
+    }
+    const ocs2::matrix_t& Am = data.dynamics.dfdx;
+    const ocs2::matrix_t& Bm = data.dynamics.dfdu;
+    const ocs2::vector_t& Hv = data.dynamicsBias;
+    const ocs2::vector_t Sv_plus_Sm_Hv = next.dfdx + next.dfdxx * Hv;
+    const ocs2::matrix_t Hm = data.cost.dfduu + Bm.transpose() * next.dfdxx * Bm;
+    const ocs2::matrix_t Gm = data.cost.dfdux + Bm.transpose() * next.dfdxx * Am;
+    const ocs2::vector_t Gv = data.cost.dfdu + Bm.transpose() * Sv_plus_Sm_Hv;
+    const ocs2::matrix_t HmInvGm = Hm.ldlt().solve(Gm);
+    const ocs2::vector_t HmInvGv = Hm.ldlt().solve(Gv);
+    const ocs2::matrix_t& deltaQm = riccatiModificationTrajectory[k].deltaQm_;
+    current.dfdxx = data.cost.dfdxx + deltaQm + Am.transpose() * next.dfdxx * Am - Gm.transpose() * HmInvGm;
+    current.dfdx = data.cost.dfdx + Am.transpose() * Sv_plus_Sm_Hv - Gm.transpose() * HmInvGv;
+    current.f = next.f + data.cost.f + Hv.dot(next.dfdx) + 0.5 * Hv.dot(next.dfdxx * Hv) - 0.5 * Gv.dot(HmInvGv);
+  }
+
+  // reduce the partitions [0, 7), [7, 13), [13, numNodes) and scan them
+  auto getElement = [&](int k) {
+    return (k == eventNode) ? ocs2::riccati_scan::createEventElement(modelDataTrajectory[k])
+                            : ocs2::riccati_scan::createIntermediateElement(modelDataTrajectory[k], riccatiModificationTrajectory[k]);
+  };
+  const std::vector<int> partitionStarts{0, 7, 13};
+  std::vector<ocs2::riccati_scan::Element> partitionElements;
+  for (size_t i = 0; i < partitionStarts.size(); i++) {
+    const int end = (i + 1 < partitionStarts.size()) ? partitionStarts[i + 1] : numNodes;
+    auto element = getElement(end - 1);
+    for (int k = end - 2; k >= partitionStarts[i]; k--) {
+      element = ocs2::riccati_scan::combine(getElement(k), element);
+    }
+    partitionElements.push_back(element);
+  }
+  auto suffixElement = ocs2::riccati_scan::createFinalElement(finalValueFunction);
+  for (int i = partitionStarts.size() - 1; i >= 0; i--) {
+    suffixElement = ocs2::riccati_scan::combine(partitionElements[i], suffixElement);
+    const auto valueFunction = ocs2::riccati_scan::getValueFunction(suffixElement);
+    const auto& expected = valueFunctionTrajectory[partitionStarts[i]];
+    EXPECT_TRUE(valueFunction.dfdxx.isApprox(expected.dfdxx, 1e-8)) << "partition: " << i;
+    EXPECT_TRUE(valueFunction.dfdx.isApprox(expected.dfdx, 1e-8)) << "partition: " << i;
+    EXPECT_NEAR(valueFunction.f, expected.f, 1e-8 * std::max(1.0, std::abs(expected.f))) << "partition: " << i;
+  }
+
+  // associativity
+  const auto leftFirst =
+      ocs2::riccati_scan::combine(ocs2::riccati_scan::combine(partitionElements[0], partitionElements[1]), partitionElements[2]);
+  const auto rightFirst =
+      ocs2::riccati_scan::combine(partitionElements[0], ocs2::riccati_scan::combine(partitionElements[1], partitionElements[2]));
+  EXPECT_TRUE(leftFirst.A.isApprox(rightFirst.A, 1e-8));
+  EXPECT_TRUE(leftFirst.b.isApprox(rightFirst.b, 1e-8));
+  EXPECT_TRUE(leftFirst.C.isApprox(rightFirst.C, 1e-8));
+  EXPECT_TRUE(leftFirst.eta.isApprox(rightFirst.eta, 1e-8));
+  EXPECT_TRUE(leftFirst.J.isApprox(rightFirst.J, 1e-8));
+  EXPECT_NEAR(leftFirst.gamma, rightFirst.gamma, 1e-8 * std::max(1.0, std::abs(rightFirst.gamma)));
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+
+#include <ocs2_core/cost/QuadraticStateCost.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_ddp/ILQR.h"
+#include "ocs2_ddp/SLQ.h"
+
+/*
+ * Counts the heap allocations of this process. glibc routes operator new and Eigen's aligned allocations through malloc.
+ */
+namespace {
+std::atomic<size_t> numAllocations{0};
+}  // unnamed namespace
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+extern "C" void* malloc(size_t size) {
+  ++numAllocations;
+  return __libc_malloc(size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  ++numAllocations;
+  return __libc_realloc(ptr, size);
+}
+
+using namespace ocs2;
+
+namespace {
+
+/** A diagonal quadratic regulator cost which is accumulated in place. */
+class DiagonalRegulatorCost final : public StateInputCost {
+ public:
+  DiagonalRegulatorCost(vector_t stateWeights, vector_t inputWeights) : q_(std::move(stateWeights)), r_(std::move(inputWeights)) {}
+  DiagonalRegulatorCost* clone() const override { return new DiagonalRegulatorCost(*this); }
+
+  scalar_t getValue(scalar_t, const vector_t& x, const vector_t& u, const TargetTrajectories&, const PreComputation&) const override {
+    return 0.5 * x.cwiseAbs2().dot(q_) + 0.5 * u.cwiseAbs2().dot(r_);
+  }
+
+  ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u,
+                                                                 const TargetTrajectories& targetTrajectories,
+                                                                 const PreComputation& preComp) const override {
+    auto approximation = ScalarFunctionQuadraticApproximation::Zero(x.rows(), u.rows());
+    accumulateQuadraticApproximation(t, x, u, targetTrajectories, preComp, approximation);
+    return approximation;
+  }
+
+  void accumulateQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories& targetTrajectories,
+                                        const PreComputation& preComp, ScalarFunctionQuadraticApproximation& approximation) const override {
+    approximation.f += getValue(t, x, u, targetTrajectories, preComp);
+    approximation.dfdx += q_.cwiseProduct(x);
+    approximation.dfdu += r_.cwiseProduct(u);
+    approximation.dfdxx.diagonal() += q_;
+    approximation.dfduu.diagonal() += r_;
+  }
+
+ private:
+  vector_t q_;
+  vector_t r_;
+};
+
+/** Records the heap allocations of each LQ approximation of the intermediate nodes. */
+template <typename DDP>
+class AllocationCountingDdp final : public DDP {
+ public:
+  using DDP::DDP;
+
+  std::vector<size_t> lqApproximationAllocations;
+
+ protected:
+  void approximateIntermediateLQ(PrimalDataContainer& primalData) override {
+    const size_t numAllocationsBefore = numAllocations;
+    DDP::approximateIntermediateLQ(primalData);
+    lqApproximationAllocations.push_back(numAllocations - numAllocationsBefore);
+  }
+};
+
+}  // unnamed namespace
+
+template <typename DDP>
+class ModelDataReuseTest : public testing::Test {
+ protected:
+  static constexpr size_t STATE_DIM = 2;
+  static constexpr size_t INPUT_DIM = 1;
+
+  ModelDataReuseTest() : initializer(INPUT_DIM) {
+    const matrix_t A = (matrix_t(STATE_DIM, STATE_DIM) << 0.0, 1.0, 0.0, 0.0).finished();
+    const matrix_t B = (matrix_t(STATE_DIM, INPUT_DIM) << 0.0, 1.0).finished();
+    problem.dynamicsPtr.reset(new LinearSystemDynamics(A, B));
+    problem.costPtr->add("cost", std::unique_ptr<StateInputCost>(new DiagonalRegulatorCost(vector_t::Ones(STATE_DIM),
+                                                                                           vector_t::Ones(INPUT_DIM))));
+    problem.finalCostPtr->add("finalCost", std::unique_ptr<StateCost>(new QuadraticStateCost(matrix_t::Identity(STATE_DIM, STATE_DIM))));
+
+    // a fixed step integrator keeps the time grid of the rollout constant
+    rollout::Settings rolloutSettings;
+    rolloutSettings.integratorType = IntegratorType::RK4;
+    rolloutSettings.timeStep = 0.05;
+    rolloutPtr.reset(new TimeTriggeredRollout(*problem.dynamicsPtr, rolloutSettings));
+
+    referenceManagerPtr = std::make_shared<ReferenceManager>(
+        TargetTrajectories({0.0}, {vector_t::Zero(STATE_DIM)}, {vector_t::Zero(INPUT_DIM)}));
+
+    ddpSettings.algorithm_ = std::is_same<DDP, SLQ>::value ? ddp::Algorithm::SLQ : ddp::Algorithm::ILQR;
+    ddpSettings.nThreads_ = 1;
+    ddpSettings.maxNumIterations_ = 3;
+    ddpSettings.minRelCost_ = 0.0;
+    ddpSettings.timeStep_ = rolloutSettings.timeStep;
+    ddpSettings.backwardPassIntegratorType_ = IntegratorType::RK4;
+    ddpSettings.displayInfo_ = false;
+    ddpSettings.displayShortSummary_ = false;
+    ddpSettings.checkNumericalStability_ = false;
+  }
+
+  OptimalControlProblem problem;
+  DefaultInitializer initializer;
+  std::unique_ptr<RolloutBase> rolloutPtr;
+  std::shared_ptr<ReferenceManager> referenceManagerPtr;
+  ddp::Settings ddpSettings;
+};
+
+template <typename DDP>
+constexpr size_t ModelDataReuseTest<DDP>::STATE_DIM;
+template <typename DDP>
+constexpr size_t ModelDataReuseTest<DDP>::INPUT_DIM;
+
+using DdpTypes = testing::Types<SLQ, ILQR>;
+TYPED_TEST_CASE(ModelDataReuseTest, DdpTypes);
+
+TYPED_TEST(ModelDataReuseTest, noAllocationsPerNodeInSteadyStateLqApproximation) {
+  // returns the heap allocations of each LQ approximation over consecutive MPC calls of the same horizon
+  auto getLqApproximationAllocations = [this](scalar_t finalTime) {
+    AllocationCountingDdp<TypeParam> ddp(this->ddpSettings, *this->rolloutPtr, this->problem, this->initializer);
+    ddp.setReferenceManager(this->referenceManagerPtr);
+    const vector_t initState = (vector_t(this->STATE_DIM) << 1.0, 0.0).finished();
+    for (int i = 0; i < 3; i++) {
+      ddp.run(0.0, initState, finalTime);
+    }
+    return ddp.lqApproximationAllocations;
+  };
+  const auto shortHorizonAllocations = getLqApproximationAllocations(1.0);
+  const auto longHorizonAllocations = getLqApproximationAllocations(4.0);
+
+  // The nominal and the cached primal data are approximated in turns, each allocates its model data once. After that, only the thread
+  // pool allocates for dispatching the loop, which does not depend on the number of nodes.
+  ASSERT_GT(shortHorizonAllocations.size(), 2);
+  ASSERT_GT(longHorizonAllocations.size(), 2);
+  EXPECT_LT(shortHorizonAllocations[0], longHorizonAllocations[0]);
+  const auto steadyStateAllocations = shortHorizonAllocations[2];
+  EXPECT_LT(steadyStateAllocations, 1.0 / this->ddpSettings.timeStep_);
+  for (size_t i = 2; i < shortHorizonAllocations.size(); i++) {
+    EXPECT_EQ(shortHorizonAllocations[i], steadyStateAllocations) << "LQ approximation " << i << " of the short horizon.";
+  }
+  for (size_t i = 2; i < longHorizonAllocations.size(); i++) {
+    EXPECT_EQ(longHorizonAllocations[i], steadyStateAllocations) << "LQ approximation " << i << " of the long horizon.";
+  }
+}
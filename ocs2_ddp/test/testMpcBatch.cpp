@@ -0,0 +1,127 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_mpc/MpcBatch.h>
+
+#include <ocs2_core/cost/QuadraticStateInputCost.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+
+#include "ocs2_ddp/GaussNewtonDDP_MPC.h"
+
+using namespace ocs2;
+
+class MpcBatchTest : public testing::Test {
+ protected:
+  static constexpr size_t STATE_DIM = 2;
+  static constexpr size_t INPUT_DIM = 1;
+
+  MpcBatchTest() : initializer(INPUT_DIM), targetTrajectories({0.0}, {vector_t::Zero(STATE_DIM)}, {vector_t::Zero(INPUT_DIM)}) {
+    const matrix_t A = (matrix_t(STATE_DIM, STATE_DIM) << 0.0, 1.0, 0.0, 0.0).finished();
+    const matrix_t B = (matrix_t(STATE_DIM, INPUT_DIM) << 0.0, 1.0).finished();
+    problem.dynamicsPtr.reset(new LinearSystemDynamics(A, B));
+
+    const matrix_t Q = matrix_t::Identity(STATE_DIM, STATE_DIM);
+    const matrix_t R = matrix_t::Identity(INPUT_DIM, INPUT_DIM);
+    problem.costPtr->add("cost", std::unique_ptr<StateInputCost>(new QuadraticStateInputCost(Q, R)));
+
+    rolloutPtr.reset(new TimeTriggeredRollout(*problem.dynamicsPtr, rollout::Settings()));
+
+    mpcSettings.timeHorizon_ = 1.0;
+    mpcSettings.solutionTimeWindow_ = -1.0;
+    mpcSettings.debugPrint_ = false;
+    ddpSettings.algorithm_ = ddp::Algorithm::SLQ;
+    ddpSettings.nThreads_ = 1;
+    ddpSettings.maxNumIterations_ = 5;
+    ddpSettings.displayInfo_ = false;
+    ddpSettings.displayShortSummary_ = false;
+  }
+
+  std::unique_ptr<MPC_BASE> createMpc() const {
+    std::unique_ptr<GaussNewtonDDP_MPC> mpcPtr(new GaussNewtonDDP_MPC(mpcSettings, ddpSettings, *rolloutPtr, problem, initializer));
+    mpcPtr->getSolverPtr()->getReferenceManager().setTargetTrajectories(targetTrajectories);
+    return std::move(mpcPtr);
+  }
+
+  OptimalControlProblem problem;
+  DefaultInitializer initializer;
+  std::unique_ptr<RolloutBase> rolloutPtr;
+  TargetTrajectories targetTrajectories;
+  mpc::Settings mpcSettings;
+  ddp::Settings ddpSettings;
+};
+
+constexpr size_t MpcBatchTest::STATE_DIM;
+constexpr size_t MpcBatchTest::INPUT_DIM;
+
+TEST_F(MpcBatchTest, compareWithSingleInstance) {
+  const size_t numInstances = 7;
+  const size_t numThreads = 3;
+  MpcBatch mpcBatch(numInstances, [&](size_t) { return createMpc(); }, numThreads);
+  ASSERT_EQ(mpcBatch.size(), numInstances);
+
+  std::vector<SystemObservation> observations(numInstances);
+  for (size_t i = 0; i < numInstances; i++) {
+    observations[i].time = 0.0;
+    observations[i].state = vector_t::Random(STATE_DIM);
+    observations[i].input = vector_t::Zero(INPUT_DIM);
+  }
+
+  std::vector<PrimalSolution> primalSolutions;
+  for (int iter = 0; iter < 3; iter++) {
+    for (auto& observation : observations) {
+      observation.time = 0.1 * iter;
+    }
+    ASSERT_EQ(mpcBatch.run(observations, primalSolutions), numInstances);
+  }
+
+  // Each instance is solved as if it was run alone
+  for (size_t i = 0; i < numInstances; i++) {
+    auto mpcPtr = createMpc();
+    PrimalSolution primalSolution;
+    for (int iter = 0; iter < 3; iter++) {
+      mpcPtr->run(0.1 * iter, observations[i].state);
+    }
+    mpcPtr->getSolverPtr()->getPrimalSolution(mpcPtr->getSolverPtr()->getFinalTime(), &primalSolution);
+
+    ASSERT_EQ(primalSolutions[i].timeTrajectory_.size(), primalSolution.timeTrajectory_.size());
+    for (size_t k = 0; k < primalSolution.timeTrajectory_.size(); k++) {
+      EXPECT_DOUBLE_EQ(primalSolutions[i].timeTrajectory_[k], primalSolution.timeTrajectory_[k]);
+      EXPECT_TRUE(primalSolutions[i].stateTrajectory_[k].isApprox(primalSolution.stateTrajectory_[k]));
+      EXPECT_TRUE(primalSolutions[i].inputTrajectory_[k].isApprox(primalSolution.inputTrajectory_[k]));
+    }
+  }
+
+  // Observation count must match the number of instances
+  observations.pop_back();
+  EXPECT_THROW(mpcBatch.run(observations, primalSolutions), std::runtime_error);
+}
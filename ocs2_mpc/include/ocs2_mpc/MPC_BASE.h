@@ -67,6 +67,14 @@ class MPC_BASE {
    */
   virtual bool run(scalar_t currentTime, const vector_t& currentState);
 
+  /**
+   * Prepares the next call of run(), before the state at that time is known. Solvers with a real-time iteration scheme do the expensive
+   * part of their iteration here, such that run() only has to process the new state (feedback phase).
+   *
+   * @param [in] nextTime: The time of the next run() call.
+   */
+  void prepare(scalar_t nextTime);
+
   /** Gets a pointer to the underlying solver used in the MPC. */
   virtual SolverBase* getSolverPtr() = 0;
 
@@ -89,6 +97,14 @@ class MPC_BASE {
    */
   virtual void calculateController(scalar_t initTime, const vector_t& initState, scalar_t finalTime) = 0;
 
+  /**
+   * Prepares the solver for the next calculateController() call, see prepare(). Does nothing by default.
+   *
+   * @param [in] initTime: Initial time of the next call.
+   * @param [in] finalTime: Final time of the next call.
+   */
+  virtual void prepareController(scalar_t initTime, scalar_t finalTime) {}
+
   /** Whether this is the first iteration of MPC or not. */
   bool isFirstMpcRun() const { return initRun_; }
 
@@ -76,6 +76,14 @@ class MPC_MRT_Interface final : public MRT_BASE {
    */
   void advanceMpc();
 
+  /**
+   * Prepares the next advanceMpc() call, for MPCs with a real-time iteration scheme. The next advanceMpc() then only does the feedback
+   * phase for the latest observation. Call this right after advanceMpc(), while waiting for the next observation.
+   *
+   * @param [in] nextTime: Time of the observation that the next advanceMpc() call will use.
+   */
+  void prepareMpc(scalar_t nextTime);
+
   /**
    * @brief getLinearFeedbackGain retrieves K matrix from solver
    * @param [in] time
@@ -56,6 +56,13 @@ struct Settings {
    * or the given operating trajectories (cold start). */
   bool coldStart_ = false;
 
+  /**
+   * Computation time budget of an MPC call in seconds. The solver stops iterating early when it predicts that the next
+   * iteration would exceed the budget, such that a slightly sub-optimal policy is published in time. Calls that still
+   * exceed the budget are counted by the solver. Any non-positive number disables the budget.
+   */
+  scalar_t timeBudget_ = -1;
+
   /**
    * MPC loop frequency in Hz. This setting is only used in Dummy_Loop for testing. If set to a
    * positive number, THe MPC loop will be simulated to run by the given frequency (note that this
@@ -0,0 +1,115 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+
+#include "ocs2_mpc/CommandData.h"
+#include "ocs2_mpc/MPC_BASE.h"
+#include "ocs2_mpc/PolicySerialization.h"
+#include "ocs2_mpc/SharedMemoryChannel.h"
+#include "ocs2_mpc/SharedMemoryTopics.h"
+#include "ocs2_mpc/SystemObservation.h"
+
+namespace ocs2 {
+
+/**
+ * This class implements the MPC communication interface through shared memory, for an MRT in another process on the same host, see
+ * MRT_SharedMemory_Interface. It does not need ROS. The observations, policies and reset requests are exchanged through
+ * SharedMemoryChannel, and the MPC always solves for the latest observation.
+ */
+class MPC_SharedMemory_Interface {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param [in] mpc: The underlying MPC class to be used.
+   * @param [in] topicPrefix: The prefix of the shared memory channel names, e.g. the robot's name.
+   * @param [in] maxPolicySize: The maximum size of a serialized policy in bytes, if the channel is created by this process.
+   */
+  explicit MPC_SharedMemory_Interface(MPC_BASE& mpc, const std::string& topicPrefix = "anonymousRobot",
+                                      size_t maxPolicySize = 16 * 1024 * 1024);
+
+  /**
+   * Resets the class to its instantiation state.
+   *
+   * @param [in] initTargetTrajectories: The initial desired cost trajectories.
+   */
+  void resetMpcNode(TargetTrajectories&& initTargetTrajectories);
+
+  /**
+   * Checks the shared memory once. It handles a reset request of the MRT. If there is a new observation, it runs the MPC for it and
+   * writes the policy.
+   *
+   * @return True if the MPC was run for a new observation.
+   */
+  bool spinOnce();
+
+  /**
+   * Calls spinOnce() until shutdown() is called. It polls the shared memory without sleeping to minimize the latency.
+   */
+  void spin();
+
+  /**
+   * Makes spin() return.
+   */
+  void shutdown() { terminate_ = true; }
+
+ private:
+  /** Serializes the MPC solution and writes it to the policy channel. */
+  void writePolicy(const SystemObservation& mpcInitObservation);
+
+  MPC_BASE& mpc_;
+
+  SharedMemoryChannel observationChannel_;
+  SharedMemoryChannel policyChannel_;
+  SharedMemoryChannel resetChannel_;
+  SharedMemoryChannel resetAcknowledgeChannel_;
+
+  // buffers reused for every MPC iteration
+  SystemObservation observation_;
+  CommandData command_;
+  PrimalSolution primalSolution_;
+  PolicySerializer policySerializer_;
+  std::vector<uint8_t> policyData_;
+
+  benchmark::RepeatedTimer mpcTimer_;
+
+  bool resetRequestedEver_ = false;
+  std::atomic_bool terminate_{false};
+};
+
+}  // namespace ocs2
@@ -31,10 +31,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <Eigen/Dense>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <memory>
-#include <mutex>
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/ControllerBase.h>
@@ -54,6 +54,9 @@ namespace ocs2 {
 /**
  * This class implements core MRT (Model Reference Tracking) functionality.
  * The responsibility of filling the buffer variables is left to the deriving classes.
+ *
+ * The policies are handed over from the thread filling the buffer to the thread calling updatePolicy() through a wait-free triple buffer.
+ * The three preallocated policy buffers are recycled, such that neither side blocks or allocates a new policy object on an update.
  */
 class MRT_BASE {
  public:
@@ -64,7 +67,8 @@ class MRT_BASE {
   virtual ~MRT_BASE() = default;
 
   /**
-   * Resets the class to its instantiated state.
+   * Resets the class to its instantiated state. It can be called from any thread: the in-use policy stays valid until the next call to
+   * updatePolicy(), which drops it. A policy that is being filled concurrently is published afterwards as usual.
    */
   void reset();
 
@@ -145,6 +149,8 @@ class MRT_BASE {
    * is available on the buffer this method will load it to the in-use policy.
    * This method also calls the modifyActiveSolution() method.
    *
+   * This method never blocks. The in-use policy is always replaced by the latest published one, older unused policies are skipped.
+   *
    * @return True if the policy is updated.
    */
   bool updatePolicy();
@@ -161,35 +167,53 @@ class MRT_BASE {
   void addMrtObserver(std::shared_ptr<MrtObserver> mrtObserver) { observerPtrArray_.push_back(std::move(mrtObserver)); };
 
  protected:
+  /** The policy data exchanged between the MPC and the MRT. */
+  struct PolicyBuffer {
+    CommandData command;
+    PrimalSolution primalSolution;
+    PerformanceIndex performanceIndices;
+  };
+
+  /**
+   * Gets the buffer to be filled with the next policy. It holds an older policy whose memory can be reused.
+   * Only a single thread may fill the buffer, and it owns the buffer until it calls publishBuffer().
+   *
+   * @return reference to the buffer to be filled.
+   */
+  PolicyBuffer& getBufferToFill() { return policyBuffers_[fillIndex_]; }
+
+  /**
+   * Calls modifyBufferedSolution() on the filled buffer and makes it the latest policy available to updatePolicy().
+   * The buffer returned by the next call to getBufferToFill() is a different one.
+   */
+  void publishBuffer();
+
+  /** Moves the given policy into the buffer and publishes it, see publishBuffer(). */
   void moveToBuffer(std::unique_ptr<CommandData> commandDataPtr, std::unique_ptr<PrimalSolution> primalSolutionPtr,
                     std::unique_ptr<PerformanceIndex> performanceIndicesPtr);
 
  private:
-  /** Calls modifyActiveSolution on all mrt observers. This function is called while holding a policyBufferMutex lock */
+  /** Calls modifyActiveSolution on all mrt observers. This function is called by the thread calling updatePolicy() */
   void modifyActiveSolution(const CommandData& command, PrimalSolution& primalSolution);
 
-  /** Calls modifyBufferedSolution on all mrt observers. This function is called while holding a policyBufferMutex lock */
+  /** Calls modifyBufferedSolution on all mrt observers. This function is called by the thread filling the buffer */
   void modifyBufferedSolution(const CommandData& commandBuffer, PrimalSolution& primalSolutionBuffer);
 
   // flags on state of the class
   std::atomic_bool policyReceivedEver_;
-  bool newPolicyInBuffer_;  // whether a new policy is waiting to be swapped in
-
-  // variables related to the MPC output
-  std::unique_ptr<CommandData> activeCommandPtr_;
-  std::unique_ptr<CommandData> bufferCommandPtr_;
-  std::unique_ptr<PrimalSolution> activePrimalSolutionPtr_;
-  std::unique_ptr<PrimalSolution> bufferPrimalSolutionPtr_;
-  std::unique_ptr<PerformanceIndex> activePerformanceIndicesPtr_;
-  std::unique_ptr<PerformanceIndex> bufferPerformanceIndicesPtr_;
+  std::atomic_bool resetRequested_;  // whether updatePolicy() has to drop the in-use policy
+  bool activePolicyValid_;           // whether the in-use policy has been loaded from the buffer
 
-  // thread safety
-  mutable std::mutex bufferMutex_;  // for policy variables with the prefix (buffer*)
-  const size_t mrtTrylockWarningThreshold_ = 5;
-  size_t mrtTrylockWarningCount_;
+  // triple buffer for the MPC output. The in-use policy is at activeIndex_ and the policy being filled at fillIndex_. The remaining
+  // buffer is exchanged between the two threads through sharedIndex_, which also flags whether it holds a policy not yet in use.
+  std::array<PolicyBuffer, 3> policyBuffers_;
+  size_t activeIndex_;
+  size_t fillIndex_;
+  std::atomic<size_t> sharedIndex_;
 
   // variables needed for policy evaluation
   std::unique_ptr<RolloutBase> rolloutPtr_;
+  LinearInterpolation::TimeSegmentCursor stateTimeSegmentCursor_;
 
   std::vector<std::shared_ptr<MrtObserver>> observerPtrArray_;
 };
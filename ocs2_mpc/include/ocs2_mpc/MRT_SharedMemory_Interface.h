@@ -0,0 +1,82 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ocs2_mpc/MRT_BASE.h"
+#include "ocs2_mpc/PolicySerialization.h"
+#include "ocs2_mpc/SharedMemoryChannel.h"
+#include "ocs2_mpc/SharedMemoryTopics.h"
+
+namespace ocs2 {
+
+/**
+ * This class implements the MRT communication interface through shared memory, for an MPC in another process on the same host, see
+ * MPC_SharedMemory_Interface. It does not need ROS.
+ */
+class MRT_SharedMemory_Interface : public MRT_BASE {
+ public:
+  /**
+   * Constructor
+   *
+   * @param [in] topicPrefix: The prefix of the shared memory channel names, e.g. the robot's name. It has to match the one of the MPC.
+   * @param [in] maxPolicySize: The maximum size of a serialized policy in bytes, if the channel is created by this process.
+   */
+  explicit MRT_SharedMemory_Interface(const std::string& topicPrefix = "anonymousRobot", size_t maxPolicySize = 16 * 1024 * 1024);
+
+  /** Destructor */
+  ~MRT_SharedMemory_Interface() override = default;
+
+  void resetMpcNode(const TargetTrajectories& initTargetTrajectories) override;
+
+  void setCurrentObservation(const SystemObservation& currentObservation) override;
+
+  /**
+   * Checks the shared memory for a new policy and loads it into the policy buffer. Call it before updatePolicy(), or repeatedly on a
+   * separate thread.
+   *
+   * @return True if a new policy was loaded into the buffer.
+   */
+  bool spinMRT();
+
+ private:
+  SharedMemoryChannel observationChannel_;
+  SharedMemoryChannel policyChannel_;
+  SharedMemoryChannel resetChannel_;
+  SharedMemoryChannel resetAcknowledgeChannel_;
+
+  PolicyDeserializer policyDeserializer_;
+  std::vector<uint8_t> observationData_;
+};
+
+}  // namespace ocs2
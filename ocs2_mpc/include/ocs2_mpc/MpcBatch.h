@@ -0,0 +1,91 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <ocs2_core/thread_support/ThreadPool.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+
+#include "ocs2_mpc/MPC_BASE.h"
+#include "ocs2_mpc/SystemObservation.h"
+
+namespace ocs2 {
+
+/**
+ * Runs many independent MPC instances of the same problem in one process, e.g. for simulating a fleet of robots or collecting data.
+ * The instances are solved in parallel on one thread pool, one instance per thread at a time.
+ *
+ * The instances are created by a factory. To avoid duplicating the model data (e.g. loaded CppAD libraries), create them from a single
+ * RobotInterface. Since the parallelism is across instances, the solvers should be configured to run single-threaded.
+ */
+class MpcBatch {
+ public:
+  /** Creates the MPC of the instance with the given index */
+  using MpcFactory = std::function<std::unique_ptr<MPC_BASE>(size_t index)>;
+
+  /**
+   * Constructor
+   *
+   * @param [in] numInstances: The number of MPC instances.
+   * @param [in] mpcFactory: Creates the MPC instances.
+   * @param [in] numThreads: The number of threads solving the instances, including the calling thread.
+   * @param [in] threadPriority: The priority of the worker threads.
+   */
+  MpcBatch(size_t numInstances, const MpcFactory& mpcFactory, size_t numThreads, int threadPriority = 0);
+
+  /** Returns the number of MPC instances */
+  size_t size() const { return mpcInstances_.size(); }
+
+  /** Access to an MPC instance, e.g. to set its reference */
+  MPC_BASE& getMpc(size_t index) { return *mpcInstances_[index]; }
+  const MPC_BASE& getMpc(size_t index) const { return *mpcInstances_[index]; }
+
+  /** Resets all MPC instances. */
+  void reset();
+
+  /**
+   * Runs one MPC iteration for every instance.
+   *
+   * @param [in] observations: The current observation of each instance.
+   * @param [out] primalSolutions: The policy of each instance over its solution time window. The entry of an instance that did not update
+   * its controller is left unchanged.
+   * @return The number of instances that updated their controller.
+   */
+  size_t run(const std::vector<SystemObservation>& observations, std::vector<PrimalSolution>& primalSolutions);
+
+ private:
+  std::vector<std::unique_ptr<MPC_BASE>> mpcInstances_;
+  ThreadPool threadPool_;
+};
+
+}  // namespace ocs2
@@ -66,7 +66,7 @@ class MrtObserver {
    * This function is executed sequentially with updatePolicy and thus blocks the main thread. Computationally expensive modifications
    * should therefore rather be done in "modifyBufferedSolution".
    *
-   * A call to this function is protected by the same mutex as modifyBufferedSolution.
+   * This function may run concurrently with modifyBufferedSolution. Data shared between the two has to be synchronized by the observer.
    */
   virtual void modifyActiveSolution(const CommandData& command, PrimalSolution& primalSolution) {}
 
@@ -76,7 +76,7 @@ class MrtObserver {
    *
    * When using a multi-threaded MRT, this function does not block the main thread.
    *
-   * A call to this function is protected by the same mutex as modifyActiveSolution.
+   * This function may run concurrently with modifyActiveSolution. Data shared between the two has to be synchronized by the observer.
    */
   virtual void modifyBufferedSolution(const CommandData& commandBuffer, PrimalSolution& primalSolutionBuffer) {}
 };
@@ -0,0 +1,170 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/reference/ModeSchedule.h>
+#include <ocs2_core/reference/TargetTrajectories.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+#include <ocs2_oc/oc_solver/PerformanceIndex.h>
+
+#include "ocs2_mpc/CommandData.h"
+#include "ocs2_mpc/SystemObservation.h"
+
+namespace ocs2 {
+namespace policy_serialization {
+
+/** Identifies a serialized policy, "OCS2" in ASCII. A message from a host with a different byte order does not match. */
+constexpr uint32_t MAGIC_NUMBER = 0x3253434F;
+
+/** Version of the binary policy format. It is increased on every incompatible change of the format. */
+constexpr uint32_t FORMAT_VERSION = 1;
+
+/**
+ * Serializes an observation with the same encoding as the policy.
+ *
+ * @param [in] observation: The observation.
+ * @param [out] data: The serialized observation. Its memory is reused.
+ */
+void serializeObservation(const SystemObservation& observation, std::vector<uint8_t>& data);
+
+/**
+ * Deserializes an observation, see serializeObservation(). Throws if the data is not a serialized observation.
+ *
+ * @param [in] data: Pointer to the serialized observation.
+ * @param [in] size: Size of the serialized observation in bytes.
+ * @param [out] observation: The observation.
+ */
+void deserializeObservation(const uint8_t* data, size_t size, SystemObservation& observation);
+
+/**
+ * Serializes target trajectories with the same encoding as the policy.
+ *
+ * @param [in] targetTrajectories: The target trajectories.
+ * @param [out] data: The serialized target trajectories. Its memory is reused.
+ */
+void serializeTargetTrajectories(const TargetTrajectories& targetTrajectories, std::vector<uint8_t>& data);
+
+/**
+ * Deserializes target trajectories, see serializeTargetTrajectories(). Throws if the data is not serialized target trajectories.
+ *
+ * @param [in] data: Pointer to the serialized target trajectories.
+ * @param [in] size: Size of the serialized target trajectories in bytes.
+ * @param [out] targetTrajectories: The target trajectories.
+ */
+void deserializeTargetTrajectories(const uint8_t* data, size_t size, TargetTrajectories& targetTrajectories);
+
+}  // namespace policy_serialization
+
+/**
+ * Serializes MPC policies into a flat, versioned binary format. It is meant for transporting policies between processes on hosts with the
+ * same byte order. The message is one contiguous byte array that contains:
+ *   - A header with the magic number, the format version, the controller type and the delta encoding revisions.
+ *   - The command data, the performance indices and the mode schedule.
+ *   - The time trajectory, followed by the state and the input trajectories, each stored as one contiguous block of doubles.
+ *   - The controller time stamps, followed by the feedforward or bias block and, for a linear controller, the column-major gain block.
+ * All numbers are stored in double precision, such that the deserialized policy is identical to the serialized one.
+ *
+ * With delta encoding, the target trajectories and the mode schedule are left out if they have not changed since the previous policy.
+ * Each of them carries a revision, which is increased on every change, such that the deserializer can detect a missed change. Every
+ * keyFrameInterval-th policy is complete, such that a receiver that missed a message recovers.
+ */
+class PolicySerializer {
+ public:
+  /**
+   * Constructor
+   *
+   * @param [in] deltaEncoding: Whether unchanged target trajectories and mode schedules are left out.
+   * @param [in] keyFrameInterval: Every keyFrameInterval-th policy is serialized completely when using delta encoding.
+   */
+  explicit PolicySerializer(bool deltaEncoding = false, size_t keyFrameInterval = 10);
+
+  /**
+   * Serializes a policy. The memory of the data array is reused, such that serializing policies of the same size does not allocate.
+   *
+   * @param [in] commandData: The MPC command data.
+   * @param [in] primalSolution: The MPC policy. Its controller must be a FeedforwardController or a LinearController.
+   * @param [in] performanceIndices: The performance indices of the solver.
+   * @param [out] data: The serialized policy.
+   */
+  void serialize(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+                 std::vector<uint8_t>& data);
+
+  /** Forgets the previous policy, such that the next one is serialized completely. */
+  void reset();
+
+ private:
+  bool deltaEncoding_;
+  size_t keyFrameInterval_;
+  size_t numPoliciesSinceKeyFrame_;
+
+  TargetTrajectories previousTargetTrajectories_;
+  ModeSchedule previousModeSchedule_;
+  uint64_t targetTrajectoriesRevision_;
+  uint64_t modeScheduleRevision_;
+};
+
+/**
+ * Deserializes MPC policies that were serialized by PolicySerializer. It keeps the latest target trajectories and mode schedule to
+ * complete delta encoded policies.
+ */
+class PolicyDeserializer {
+ public:
+  /** Constructor */
+  PolicyDeserializer();
+
+  /**
+   * Deserializes a policy. The memory of the outputs is reused where possible.
+   *
+   * @param [in] data: Pointer to the serialized policy.
+   * @param [in] size: Size of the serialized policy in bytes.
+   * @param [out] commandData: The MPC command data.
+   * @param [out] primalSolution: The MPC policy.
+   * @param [out] performanceIndices: The performance indices of the solver.
+   * @return False if the policy is delta encoded against a target trajectory or mode schedule that has not been received. The outputs are
+   * then left unchanged.
+   */
+  bool deserialize(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+                   PerformanceIndex& performanceIndices);
+
+  /** Forgets the received target trajectories and mode schedule. */
+  void reset();
+
+ private:
+  TargetTrajectories targetTrajectories_;
+  ModeSchedule modeSchedule_;
+  uint64_t targetTrajectoriesRevision_;  // zero if not received
+  uint64_t modeScheduleRevision_;        // zero if not received
+};
+
+}  // namespace ocs2
@@ -0,0 +1,112 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ocs2 {
+
+/**
+ * A channel for messages of bounded size between two processes on the same host through POSIX shared memory. Messages are handed over
+ * through a wait-free triple buffer: writing never blocks, and the reader always gets the latest message while older unread messages are
+ * dropped. A channel supports a single writing and a single reading process.
+ *
+ * Both processes construct the channel with the same name. The first one creates the shared memory and owns it, the other one opens it
+ * and uses the message size of the creator. The owner marks the channel as closed and removes the shared memory when it is destroyed.
+ * The other process notices this on its next read() or write() and reopens the channel, such that it creates a new shared memory for the
+ * restarted process to open. Messages which are not read yet are lost in this case. If the owner crashed without removing the shared
+ * memory, the next process that opens it takes over the ownership.
+ */
+class SharedMemoryChannel {
+ public:
+  /**
+   * Constructor, creates or opens the shared memory.
+   *
+   * @param [in] name: The name of the channel. It must be unique on the host and not contain slashes.
+   * @param [in] maxMessageSize: The maximum size of a message in bytes if the channel is created.
+   */
+  SharedMemoryChannel(const std::string& name, size_t maxMessageSize);
+
+  /** Destructor, closes the channel and removes the shared memory if this process owns it. */
+  ~SharedMemoryChannel();
+
+  SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+  SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+  /** Gets the maximum size of a message in bytes */
+  size_t maxMessageSize() const { return maxMessageSize_; }
+
+  /**
+   * Writes a message to the channel. Never blocks, unless the owner closed the channel and it has to be reopened.
+   *
+   * @param [in] data: Pointer to the message.
+   * @param [in] size: Size of the message in bytes, at most maxMessageSize().
+   */
+  void write(const uint8_t* data, size_t size);
+
+  /**
+   * Takes the latest message from the channel if there is a new one. Never blocks, unless the owner closed the channel and it has to be
+   * reopened.
+   * The message is read in place with messageData() and messageSize() until the next call to read().
+   *
+   * @return True if a new message was taken.
+   */
+  bool read();
+
+  /** Gets the message taken by the last successful read(). */
+  const uint8_t* messageData() const;
+
+  /** Gets the size of the message taken by the last successful read(). Zero if no message was taken yet. */
+  size_t messageSize() const;
+
+ private:
+  struct Header;
+
+  /** Creates or opens the shared memory and maps it */
+  void open();
+
+  /** Unmaps the shared memory, and closes and removes it if this process owns it */
+  void close();
+
+  /** Gets the start of a message slot */
+  uint8_t* slot(uint32_t index) const;
+
+  std::string name_;
+  bool isOwner_;
+  size_t maxMessageSize_;
+  size_t slotSize_;
+  size_t mappedSize_;
+  void* mappedMemory_;
+  Header* header_;
+};
+
+}  // namespace ocs2
@@ -0,0 +1,59 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ocs2 {
+namespace shared_memory {
+
+/** Maximum size of a serialized observation in bytes */
+constexpr size_t MAX_OBSERVATION_SIZE = 64 * 1024;
+
+/** Maximum size of a serialized reset request in bytes, the reset acknowledgement is empty */
+constexpr size_t MAX_RESET_REQUEST_SIZE = 1024 * 1024;
+
+/** Names of the channels between MPC_SharedMemory_Interface and MRT_SharedMemory_Interface */
+inline std::string observationChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_observation";
+}
+inline std::string policyChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_policy";
+}
+inline std::string resetChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_reset";
+}
+inline std::string resetAcknowledgeChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_reset_acknowledge";
+}
+
+}  // namespace shared_memory
+}  // namespace ocs2
@@ -72,6 +72,7 @@ bool MPC_BASE::run(scalar_t currentTime, const vector_t& currentState) {
   }
 
   // calculate the MPC policy
+  getSolverPtr()->setTimeBudget(mpcSettings_.timeBudget_);
   calculateController(currentTime, currentState, finalTime);
 
   // set initRun flag to false
@@ -83,10 +84,22 @@ bool MPC_BASE::run(scalar_t currentTime, const vector_t& currentState) {
     std::cerr << "\n### MPC Benchmarking";
     std::cerr << "\n###   Maximum : " << mpcTimer_.getMaxIntervalInMilliseconds() << "[ms].";
     std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
-    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
+    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Time budget misses : " << getSolverPtr()->getNumTimeBudgetMisses() << std::endl;
   }
 
   return true;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_BASE::prepare(scalar_t nextTime) {
+  // Nothing to prepare from before the first run
+  if (initRun_) {
+    return;
+  }
+  prepareController(nextTime, nextTime + mpcSettings_.timeHorizon_);
+}
+
 }  // namespace ocs2
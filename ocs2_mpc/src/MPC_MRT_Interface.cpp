@@ -112,27 +112,34 @@ void MPC_MRT_Interface::advanceMpc() {
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_MRT_Interface::prepareMpc(scalar_t nextTime) {
+  mpc_.prepare(nextTime);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MPC_MRT_Interface::copyToBuffer(const SystemObservation& mpcInitObservation) {
+  // the buffer is recycled from an earlier policy, such that its memory is reused
+  auto& buffer = this->getBufferToFill();
+
   // policy
-  std::unique_ptr<PrimalSolution> primalSolutionPtr(new PrimalSolution);
   const scalar_t startTime = mpcInitObservation.time;
   const scalar_t finalTime =
       (mpc_.settings().solutionTimeWindow_ < 0) ? mpc_.getSolverPtr()->getFinalTime() : startTime + mpc_.settings().solutionTimeWindow_;
-  mpc_.getSolverPtr()->getPrimalSolution(finalTime, primalSolutionPtr.get());
+  mpc_.getSolverPtr()->getPrimalSolution(finalTime, &buffer.primalSolution);
 
   // command
-  std::unique_ptr<CommandData> commandPtr(new CommandData);
-  commandPtr->mpcInitObservation_ = mpcInitObservation;
-  commandPtr->mpcTargetTrajectories_ = mpc_.getSolverPtr()->getReferenceManager().getTargetTrajectories();
+  buffer.command.mpcInitObservation_ = mpcInitObservation;
+  buffer.command.mpcTargetTrajectories_ = mpc_.getSolverPtr()->getReferenceManager().getTargetTrajectories();
 
   // performance indices
-  std::unique_ptr<PerformanceIndex> performanceIndicesPtr(new PerformanceIndex);
-  *performanceIndicesPtr = mpc_.getSolverPtr()->getPerformanceIndeces();
+  buffer.performanceIndices = mpc_.getSolverPtr()->getPerformanceIndeces();
 
-  this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+  this->publishBuffer();
 }
 
 /******************************************************************************************************/
@@ -0,0 +1,132 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/MPC_SharedMemory_Interface.h"
+
+#include <iostream>
+#include <thread>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MPC_SharedMemory_Interface::MPC_SharedMemory_Interface(MPC_BASE& mpc, const std::string& topicPrefix, size_t maxPolicySize)
+    : mpc_(mpc),
+      observationChannel_(shared_memory::observationChannelName(topicPrefix), shared_memory::MAX_OBSERVATION_SIZE),
+      policyChannel_(shared_memory::policyChannelName(topicPrefix), maxPolicySize),
+      resetChannel_(shared_memory::resetChannelName(topicPrefix), shared_memory::MAX_RESET_REQUEST_SIZE),
+      resetAcknowledgeChannel_(shared_memory::resetAcknowledgeChannelName(topicPrefix), 0) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemory_Interface::resetMpcNode(TargetTrajectories&& initTargetTrajectories) {
+  mpc_.reset();
+  mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
+  mpcTimer_.reset();
+  policySerializer_.reset();
+  resetRequestedEver_ = true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MPC_SharedMemory_Interface::spinOnce() {
+  // reset request of the MRT
+  if (resetChannel_.read()) {
+    TargetTrajectories targetTrajectories;
+    policy_serialization::deserializeTargetTrajectories(resetChannel_.messageData(), resetChannel_.messageSize(), targetTrajectories);
+    resetMpcNode(std::move(targetTrajectories));
+
+    // discard an observation from before the reset
+    observationChannel_.read();
+    resetAcknowledgeChannel_.write(nullptr, 0);
+    std::cerr << "\n#################  MPC is reset.  ###################\n";
+  }
+
+  // the observations are only taken once the MPC is reset
+  if (!resetRequestedEver_ || !observationChannel_.read()) {
+    return false;
+  }
+  policy_serialization::deserializeObservation(observationChannel_.messageData(), observationChannel_.messageSize(), observation_);
+
+  // measure the delay in running MPC
+  mpcTimer_.startTimer();
+
+  // run MPC
+  bool controllerIsUpdated = mpc_.run(observation_.time, observation_.state);
+  if (!controllerIsUpdated) {
+    return true;
+  }
+  writePolicy(observation_);
+
+  mpcTimer_.endTimer();
+
+  // display
+  if (mpc_.settings().debugPrint_) {
+    std::cerr << "\n### MPC_SharedMemory Benchmarking";
+    std::cerr << "\n###   Maximum : " << mpcTimer_.getMaxIntervalInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
+  }
+
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemory_Interface::spin() {
+  while (!terminate_) {
+    if (!spinOnce()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemory_Interface::writePolicy(const SystemObservation& mpcInitObservation) {
+  // policy
+  const scalar_t startTime = mpcInitObservation.time;
+  const scalar_t finalTime =
+      (mpc_.settings().solutionTimeWindow_ < 0) ? mpc_.getSolverPtr()->getFinalTime() : startTime + mpc_.settings().solutionTimeWindow_;
+  mpc_.getSolverPtr()->getPrimalSolution(finalTime, &primalSolution_);
+
+  // command
+  command_.mpcInitObservation_ = mpcInitObservation;
+  command_.mpcTargetTrajectories_ = mpc_.getSolverPtr()->getReferenceManager().getTargetTrajectories();
+
+  policySerializer_.serialize(command_, primalSolution_, mpc_.getSolverPtr()->getPerformanceIndeces(), policyData_);
+  policyChannel_.write(policyData_.data(), policyData_.size());
+}
+
+}  // namespace ocs2
@@ -33,10 +33,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+namespace {
+// sharedIndex_ holds the index of the shared buffer in its lower bits and the flag for an unused policy on top
+constexpr size_t bufferIndexMask = 3;
+constexpr size_t newPolicyFlag = 4;
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-MRT_BASE::MRT_BASE() {
+MRT_BASE::MRT_BASE() : activePolicyValid_(false), activeIndex_(0), fillIndex_(1), sharedIndex_(2) {
   reset();
 }
 
@@ -44,26 +50,20 @@ MRT_BASE::MRT_BASE() {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MRT_BASE::reset() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
-
   policyReceivedEver_ = false;
-  newPolicyInBuffer_ = false;
-  mrtTrylockWarningCount_ = 0;
-
-  activeCommandPtr_.reset();
-  bufferCommandPtr_.reset();
-  activePrimalSolutionPtr_.reset();
-  bufferPrimalSolutionPtr_.reset();
-  activePerformanceIndicesPtr_.reset();
-  bufferPerformanceIndicesPtr_.reset();
+
+  // drop a published policy that has not been used yet. The buffers being filled and in use are owned by the other threads, such that
+  // the in-use policy is dropped by the next updatePolicy().
+  sharedIndex_.fetch_and(bufferIndexMask, std::memory_order_acq_rel);
+  resetRequested_.store(true, std::memory_order_release);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 const CommandData& MRT_BASE::getCommand() const {
-  if (activeCommandPtr_ != nullptr) {
-    return *activeCommandPtr_;
+  if (activePolicyValid_) {
+    return policyBuffers_[activeIndex_].command;
   } else {
     throw std::runtime_error("[MRT_BASE::getCommand] updatePolicy() should be called first!");
   }
@@ -73,8 +73,8 @@ const CommandData& MRT_BASE::getCommand() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 const PrimalSolution& MRT_BASE::getPolicy() const {
-  if (activePrimalSolutionPtr_ != nullptr) {
-    return *activePrimalSolutionPtr_;
+  if (activePolicyValid_) {
+    return policyBuffers_[activeIndex_].primalSolution;
   } else {
     throw std::runtime_error("[MRT_BASE::getPolicy] updatePolicy() should be called first!");
   }
@@ -84,8 +84,8 @@ const PrimalSolution& MRT_BASE::getPolicy() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 const PerformanceIndex& MRT_BASE::getPerformanceIndices() const {
-  if (activePerformanceIndicesPtr_ != nullptr) {
-    return *activePerformanceIndicesPtr_;
+  if (activePolicyValid_) {
+    return policyBuffers_[activeIndex_].performanceIndices;
   } else {
     throw std::runtime_error("[MRT_BASE::getPerformanceIndices] updatePolicy() should be called first!");
   }
@@ -102,20 +102,21 @@ void MRT_BASE::initRollout(const RolloutBase* rolloutPtr) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MRT_BASE::evaluatePolicy(scalar_t currentTime, const vector_t& currentState, vector_t& mpcState, vector_t& mpcInput, size_t& mode) {
-  if (activePrimalSolutionPtr_ == nullptr) {
+  if (!activePolicyValid_) {
     throw std::runtime_error("[MRT_BASE::evaluatePolicy] updatePolicy() should be called first!");
   }
+  const auto& activePrimalSolution = policyBuffers_[activeIndex_].primalSolution;
 
-  if (currentTime > activePrimalSolutionPtr_->timeTrajectory_.back()) {
+  if (currentTime > activePrimalSolution.timeTrajectory_.back()) {
     std::cerr << "The requested currentTime is greater than the received plan: " << std::to_string(currentTime) << ">"
-              << std::to_string(activePrimalSolutionPtr_->timeTrajectory_.back()) << "\n";
+              << std::to_string(activePrimalSolution.timeTrajectory_.back()) << "\n";
   }
 
-  mpcInput = activePrimalSolutionPtr_->controllerPtr_->computeInput(currentTime, currentState);
-  mpcState =
-      LinearInterpolation::interpolate(currentTime, activePrimalSolutionPtr_->timeTrajectory_, activePrimalSolutionPtr_->stateTrajectory_);
+  activePrimalSolution.controllerPtr_->computeInput(currentTime, currentState, mpcInput);
+  const auto indexAlpha = stateTimeSegmentCursor_.timeSegment(currentTime, activePrimalSolution.timeTrajectory_);
+  mpcState = LinearInterpolation::interpolate(indexAlpha, activePrimalSolution.stateTrajectory_);
 
-  mode = activePrimalSolutionPtr_->modeSchedule_.modeAtTime(currentTime);
+  mode = activePrimalSolution.modeSchedule_.modeAtTime(currentTime);
 }
 
 /******************************************************************************************************/
@@ -127,13 +128,14 @@ void MRT_BASE::rolloutPolicy(scalar_t currentTime, const vector_t& currentState,
     throw std::runtime_error("[MRT_BASE::rolloutPolicy] rollout class is not set! Use initRollout() to initialize it!");
   }
 
-  if (activePrimalSolutionPtr_ == nullptr) {
+  if (!activePolicyValid_) {
     throw std::runtime_error("[MRT_BASE::rolloutPolicy] updatePolicy() should be called first!");
   }
+  auto& activePrimalSolution = policyBuffers_[activeIndex_].primalSolution;
 
-  if (currentTime > activePrimalSolutionPtr_->timeTrajectory_.back()) {
+  if (currentTime > activePrimalSolution.timeTrajectory_.back()) {
     std::cerr << "The requested currentTime is greater than the received plan: " << std::to_string(currentTime) << ">"
-              << std::to_string(activePrimalSolutionPtr_->timeTrajectory_.back()) << "\n";
+              << std::to_string(activePrimalSolution.timeTrajectory_.back()) << "\n";
   }
 
   // perform a rollout
@@ -141,42 +143,47 @@ void MRT_BASE::rolloutPolicy(scalar_t currentTime, const vector_t& currentState,
   size_array_t postEventIndicesStock;
   vector_array_t stateTrajectory, inputTrajectory;
   const scalar_t finalTime = currentTime + timeStep;
-  rolloutPtr_->run(currentTime, currentState, finalTime, activePrimalSolutionPtr_->controllerPtr_.get(),
-                   activePrimalSolutionPtr_->modeSchedule_, timeTrajectory, postEventIndicesStock, stateTrajectory, inputTrajectory);
+  rolloutPtr_->run(currentTime, currentState, finalTime, activePrimalSolution.controllerPtr_.get(), activePrimalSolution.modeSchedule_,
+                   timeTrajectory, postEventIndicesStock, stateTrajectory, inputTrajectory);
 
   mpcState = stateTrajectory.back();
   mpcInput = inputTrajectory.back();
 
-  mode = activePrimalSolutionPtr_->modeSchedule_.modeAtTime(finalTime);
+  mode = activePrimalSolution.modeSchedule_.modeAtTime(finalTime);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 bool MRT_BASE::updatePolicy() {
-  std::unique_lock<std::mutex> lock(bufferMutex_, std::try_to_lock);
-  if (lock.owns_lock()) {
-    mrtTrylockWarningCount_ = 0;
-    if (newPolicyInBuffer_) {
-      // update the active solution from buffer
-      activeCommandPtr_.swap(bufferCommandPtr_);
-      activePrimalSolutionPtr_.swap(bufferPrimalSolutionPtr_);
-      activePerformanceIndicesPtr_.swap(bufferPerformanceIndicesPtr_);
-      newPolicyInBuffer_ = false;  // make sure we don't swap in the old policy again
-
-      modifyActiveSolution(*activeCommandPtr_, *activePrimalSolutionPtr_);
-      return true;
-    } else {
-      return false;  // No policy update: the buffer contains nothing new.
-    }
-  } else {
-    ++mrtTrylockWarningCount_;
-    if (mrtTrylockWarningCount_ > mrtTrylockWarningThreshold_) {
-      std::cerr << "[MRT_BASE::updatePolicy] failed to lock the policyBufferMutex for " << mrtTrylockWarningCount_
-                << " consecutive times.\n";
-    }
-    return false;  // No policy update: the lock could not be acquired.
+  if (resetRequested_.exchange(false, std::memory_order_acq_rel)) {
+    activePolicyValid_ = false;
   }
+
+  if ((sharedIndex_.load(std::memory_order_relaxed) & newPolicyFlag) == 0) {
+    return false;  // No policy update: the buffer contains nothing new.
+  }
+
+  // hand over the in-use buffer for recycling and take the latest published policy
+  activeIndex_ = sharedIndex_.exchange(activeIndex_, std::memory_order_acq_rel) & bufferIndexMask;
+  activePolicyValid_ = true;
+
+  auto& activeBuffer = policyBuffers_[activeIndex_];
+  modifyActiveSolution(activeBuffer.command, activeBuffer.primalSolution);
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_BASE::publishBuffer() {
+  // allow user to modify the buffer
+  auto& buffer = policyBuffers_[fillIndex_];
+  modifyBufferedSolution(buffer.command, buffer.primalSolution);
+
+  // publish the filled buffer and continue with the one that is not in use anymore
+  fillIndex_ = sharedIndex_.exchange(fillIndex_ | newPolicyFlag, std::memory_order_acq_rel) & bufferIndexMask;
+  policyReceivedEver_ = true;
 }
 
 /******************************************************************************************************/
@@ -196,17 +203,11 @@ void MRT_BASE::moveToBuffer(std::unique_ptr<CommandData> commandDataPtr, std::un
     throw std::runtime_error("[MRT_BASE::moveToBuffer] performanceIndicesPtr cannot be a null pointer!");
   }
 
-  std::lock_guard<std::mutex> lk(bufferMutex_);
-  // use swap such that the old objects are destroyed after releasing the lock.
-  bufferCommandPtr_.swap(commandDataPtr);
-  bufferPrimalSolutionPtr_.swap(primalSolutionPtr);
-  bufferPerformanceIndicesPtr_.swap(performanceIndicesPtr);
-
-  // allow user to modify the buffer
-  modifyBufferedSolution(*bufferCommandPtr_, *bufferPrimalSolutionPtr_);
-
-  newPolicyInBuffer_ = true;
-  policyReceivedEver_ = true;
+  auto& buffer = getBufferToFill();
+  buffer.command = std::move(*commandDataPtr);
+  buffer.primalSolution = std::move(*primalSolutionPtr);
+  buffer.performanceIndices = *performanceIndicesPtr;
+  publishBuffer();
 }
 
 /******************************************************************************************************/
@@ -0,0 +1,102 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/MRT_SharedMemory_Interface.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MRT_SharedMemory_Interface::MRT_SharedMemory_Interface(const std::string& topicPrefix, size_t maxPolicySize)
+    : observationChannel_(shared_memory::observationChannelName(topicPrefix), shared_memory::MAX_OBSERVATION_SIZE),
+      policyChannel_(shared_memory::policyChannelName(topicPrefix), maxPolicySize),
+      resetChannel_(shared_memory::resetChannelName(topicPrefix), shared_memory::MAX_RESET_REQUEST_SIZE),
+      resetAcknowledgeChannel_(shared_memory::resetAcknowledgeChannelName(topicPrefix), 0) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemory_Interface::resetMpcNode(const TargetTrajectories& initTargetTrajectories) {
+  this->reset();
+  policyDeserializer_.reset();
+
+  // discard an old acknowledgement, e.g. of a previous run of this process
+  resetAcknowledgeChannel_.read();
+
+  std::vector<uint8_t> data;
+  policy_serialization::serializeTargetTrajectories(initTargetTrajectories, data);
+  resetChannel_.write(data.data(), data.size());
+
+  // wait for the MPC to reset
+  auto lastWarning = std::chrono::steady_clock::now();
+  while (!resetAcknowledgeChannel_.read()) {
+    if (std::chrono::steady_clock::now() - lastWarning > std::chrono::seconds(5)) {
+      std::cerr << "[MRT_SharedMemory_Interface::resetMpcNode] Waiting for the MPC to reset ...\n";
+      lastWarning = std::chrono::steady_clock::now();
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  // discard a policy from before the reset
+  policyChannel_.read();
+  std::cerr << "MPC node has been reset.\n";
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemory_Interface::setCurrentObservation(const SystemObservation& currentObservation) {
+  policy_serialization::serializeObservation(currentObservation, observationData_);
+  observationChannel_.write(observationData_.data(), observationData_.size());
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MRT_SharedMemory_Interface::spinMRT() {
+  if (!policyChannel_.read()) {
+    return false;
+  }
+
+  // read the policy in place into the recycled buffer
+  auto& buffer = this->getBufferToFill();
+  if (!policyDeserializer_.deserialize(policyChannel_.messageData(), policyChannel_.messageSize(), buffer.command,
+                                       buffer.primalSolution, buffer.performanceIndices)) {
+    return false;
+  }
+  this->publishBuffer();
+  return true;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,85 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/MpcBatch.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MpcBatch::MpcBatch(size_t numInstances, const MpcFactory& mpcFactory, size_t numThreads, int threadPriority)
+    : threadPool_(std::max(numThreads, size_t(1)) - 1, threadPriority) {
+  mpcInstances_.reserve(numInstances);
+  for (size_t i = 0; i < numInstances; i++) {
+    mpcInstances_.push_back(mpcFactory(i));
+    if (mpcInstances_.back() == nullptr) {
+      throw std::runtime_error("[MpcBatch] The factory returned no MPC for instance " + std::to_string(i) + ".");
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MpcBatch::reset() {
+  for (auto& mpcPtr : mpcInstances_) {
+    mpcPtr->reset();
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t MpcBatch::run(const std::vector<SystemObservation>& observations, std::vector<PrimalSolution>& primalSolutions) {
+  if (observations.size() != mpcInstances_.size()) {
+    throw std::runtime_error("[MpcBatch::run] Expected one observation per MPC instance.");
+  }
+  primalSolutions.resize(mpcInstances_.size());
+
+  std::atomic_size_t numUpdated{0};
+  const int numInstances = static_cast<int>(mpcInstances_.size());
+  threadPool_.parallelFor(0, numInstances, 1, [&](int workerIndex, int i) {
+    auto& mpc = *mpcInstances_[i];
+    const auto& observation = observations[i];
+    if (mpc.run(observation.time, observation.state)) {
+      const scalar_t finalTime = (mpc.settings().solutionTimeWindow_ < 0) ? mpc.getSolverPtr()->getFinalTime()
+                                                                           : observation.time + mpc.settings().solutionTimeWindow_;
+      mpc.getSolverPtr()->getPrimalSolution(finalTime, &primalSolutions[i]);
+      ++numUpdated;
+    }
+  });
+
+  return numUpdated;
+}
+
+}  // namespace ocs2
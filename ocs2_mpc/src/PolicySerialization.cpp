@@ -0,0 +1,463 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/PolicySerialization.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+
+namespace ocs2 {
+
+namespace {
+
+// flags of the blocks that are included in a delta encoded policy
+constexpr uint32_t TARGET_TRAJECTORIES_INCLUDED = 1;
+constexpr uint32_t MODE_SCHEDULE_INCLUDED = 2;
+
+void appendBytes(const void* source, size_t numBytes, std::vector<uint8_t>& data) {
+  const auto bytes = static_cast<const uint8_t*>(source);
+  data.insert(data.end(), bytes, bytes + numBytes);
+}
+
+template <typename T>
+void append(T value, std::vector<uint8_t>& data) {
+  appendBytes(&value, sizeof(T), data);
+}
+
+void append(const vector_t& vector, std::vector<uint8_t>& data) {
+  append<uint64_t>(vector.size(), data);
+  appendBytes(vector.data(), vector.size() * sizeof(scalar_t), data);
+}
+
+void append(const scalar_array_t& array, std::vector<uint8_t>& data) {
+  append<uint64_t>(array.size(), data);
+  appendBytes(array.data(), array.size() * sizeof(scalar_t), data);
+}
+
+void append(const size_array_t& array, std::vector<uint8_t>& data) {
+  append<uint64_t>(array.size(), data);
+  for (const auto i : array) {
+    append<uint64_t>(i, data);
+  }
+}
+
+void append(const vector_array_t& array, std::vector<uint8_t>& data) {
+  append<uint64_t>(array.size(), data);
+  for (const auto& v : array) {
+    append<uint64_t>(v.size(), data);
+  }
+  for (const auto& v : array) {
+    appendBytes(v.data(), v.size() * sizeof(scalar_t), data);
+  }
+}
+
+void append(const matrix_array_t& array, std::vector<uint8_t>& data) {
+  append<uint64_t>(array.size(), data);
+  for (const auto& m : array) {
+    append<uint64_t>(m.rows(), data);
+    append<uint64_t>(m.cols(), data);
+  }
+  for (const auto& m : array) {
+    appendBytes(m.data(), m.size() * sizeof(scalar_t), data);  // column-major
+  }
+}
+
+void append(const SystemObservation& observation, std::vector<uint8_t>& data) {
+  append(observation.time, data);
+  append<uint64_t>(observation.mode, data);
+  append(observation.state, data);
+  append(observation.input, data);
+}
+
+void append(const TargetTrajectories& targetTrajectories, std::vector<uint8_t>& data) {
+  append(targetTrajectories.timeTrajectory, data);
+  append(targetTrajectories.stateTrajectory, data);
+  append(targetTrajectories.inputTrajectory, data);
+}
+
+/** Reads the serialized data in the order it was written, checking that it does not read past the end. */
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size), position_(0) {}
+
+  void readBytes(void* destination, size_t numBytes) {
+    if (numBytes > size_ - position_) {
+      throw std::runtime_error("[policy_serialization] The serialized data is truncated!");
+    }
+    std::memcpy(destination, data_ + position_, numBytes);
+    position_ += numBytes;
+  }
+
+  template <typename T>
+  T read() {
+    T value;
+    readBytes(&value, sizeof(T));
+    return value;
+  }
+
+  void read(vector_t& vector) {
+    vector.resize(readSize());
+    readBytes(vector.data(), vector.size() * sizeof(scalar_t));
+  }
+
+  void read(scalar_array_t& array) {
+    array.resize(readSize());
+    readBytes(array.data(), array.size() * sizeof(scalar_t));
+  }
+
+  void read(size_array_t& array) {
+    array.resize(readSize());
+    for (auto& i : array) {
+      i = read<uint64_t>();
+    }
+  }
+
+  void read(vector_array_t& array) {
+    array.resize(readSize());
+    for (auto& v : array) {
+      v.resize(readSize());
+    }
+    for (auto& v : array) {
+      readBytes(v.data(), v.size() * sizeof(scalar_t));
+    }
+  }
+
+  void read(SystemObservation& observation) {
+    observation.time = read<scalar_t>();
+    observation.mode = read<uint64_t>();
+    read(observation.state);
+    read(observation.input);
+  }
+
+  void read(TargetTrajectories& targetTrajectories) {
+    read(targetTrajectories.timeTrajectory);
+    read(targetTrajectories.stateTrajectory);
+    read(targetTrajectories.inputTrajectory);
+  }
+
+  void read(matrix_array_t& array) {
+    array.resize(readSize());
+    for (auto& m : array) {
+      const auto rows = readSize();
+      const auto cols = readSize();
+      m.resize(rows, cols);
+    }
+    for (auto& m : array) {
+      readBytes(m.data(), m.size() * sizeof(scalar_t));
+    }
+  }
+
+  void expectEnd() const {
+    if (position_ != size_) {
+      throw std::runtime_error("[policy_serialization] The serialized data has trailing bytes!");
+    }
+  }
+
+ private:
+  /** Reads a size and checks that it is plausible, such that corrupted data does not cause huge allocations. */
+  size_t readSize() {
+    const auto size = read<uint64_t>();
+    if (size > size_ - position_) {
+      throw std::runtime_error("[policy_serialization] The serialized data is truncated!");
+    }
+    return static_cast<size_t>(size);
+  }
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t position_;
+};
+
+bool isEqual(const vector_array_t& lhs, const vector_array_t& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); i++) {
+    if (lhs[i].size() != rhs[i].size() || lhs[i] != rhs[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isEqual(const TargetTrajectories& lhs, const TargetTrajectories& rhs) {
+  return lhs.timeTrajectory == rhs.timeTrajectory && isEqual(lhs.stateTrajectory, rhs.stateTrajectory) &&
+         isEqual(lhs.inputTrajectory, rhs.inputTrajectory);
+}
+
+bool isEqual(const ModeSchedule& lhs, const ModeSchedule& rhs) {
+  return lhs.eventTimes == rhs.eventTimes && lhs.modeSequence == rhs.modeSequence;
+}
+
+}  // unnamed namespace
+
+namespace policy_serialization {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void serializeObservation(const SystemObservation& observation, std::vector<uint8_t>& data) {
+  data.clear();
+  append(observation, data);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void deserializeObservation(const uint8_t* data, size_t size, SystemObservation& observation) {
+  Reader reader(data, size);
+  reader.read(observation);
+  reader.expectEnd();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void serializeTargetTrajectories(const TargetTrajectories& targetTrajectories, std::vector<uint8_t>& data) {
+  data.clear();
+  append(targetTrajectories, data);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void deserializeTargetTrajectories(const uint8_t* data, size_t size, TargetTrajectories& targetTrajectories) {
+  Reader reader(data, size);
+  reader.read(targetTrajectories);
+  reader.expectEnd();
+}
+
+}  // namespace policy_serialization
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PolicySerializer::PolicySerializer(bool deltaEncoding, size_t keyFrameInterval)
+    : deltaEncoding_(deltaEncoding), keyFrameInterval_(keyFrameInterval) {
+  if (keyFrameInterval_ == 0) {
+    throw std::runtime_error("[PolicySerializer] keyFrameInterval must be positive!");
+  }
+  reset();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PolicySerializer::reset() {
+  numPoliciesSinceKeyFrame_ = 0;
+  previousTargetTrajectories_.clear();
+  previousModeSchedule_.clear();
+  targetTrajectoriesRevision_ = 0;
+  modeScheduleRevision_ = 0;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PolicySerializer::serialize(const CommandData& commandData, const PrimalSolution& primalSolution,
+                                 const PerformanceIndex& performanceIndices, std::vector<uint8_t>& data) {
+  if (primalSolution.controllerPtr_ == nullptr) {
+    throw std::runtime_error("[PolicySerializer::serialize] The policy has no controller!");
+  }
+  const auto controllerType = primalSolution.controllerPtr_->getType();
+  if (controllerType != ControllerType::FEEDFORWARD && controllerType != ControllerType::LINEAR) {
+    throw std::runtime_error("[PolicySerializer::serialize] Unsupported ControllerType!");
+  }
+
+  // with delta encoding, leave out the blocks that did not change since the previous policy
+  uint32_t flags = TARGET_TRAJECTORIES_INCLUDED | MODE_SCHEDULE_INCLUDED;
+  if (deltaEncoding_) {
+    const bool isKeyFrame = numPoliciesSinceKeyFrame_ == 0;
+    numPoliciesSinceKeyFrame_ = (numPoliciesSinceKeyFrame_ + 1) % keyFrameInterval_;
+
+    if (targetTrajectoriesRevision_ == 0 || !isEqual(commandData.mpcTargetTrajectories_, previousTargetTrajectories_)) {
+      previousTargetTrajectories_ = commandData.mpcTargetTrajectories_;
+      ++targetTrajectoriesRevision_;
+    } else if (!isKeyFrame) {
+      flags &= ~TARGET_TRAJECTORIES_INCLUDED;
+    }
+
+    if (modeScheduleRevision_ == 0 || !isEqual(primalSolution.modeSchedule_, previousModeSchedule_)) {
+      previousModeSchedule_ = primalSolution.modeSchedule_;
+      ++modeScheduleRevision_;
+    } else if (!isKeyFrame) {
+      flags &= ~MODE_SCHEDULE_INCLUDED;
+    }
+  }
+
+  data.clear();
+
+  // header
+  append(policy_serialization::MAGIC_NUMBER, data);
+  append(policy_serialization::FORMAT_VERSION, data);
+  append(static_cast<uint32_t>(controllerType), data);
+  append(flags, data);
+  append(targetTrajectoriesRevision_, data);
+  append(modeScheduleRevision_, data);
+
+  // command and performance indices
+  append(commandData.mpcInitObservation_, data);
+  append(performanceIndices.merit, data);
+  append(performanceIndices.cost, data);
+  append(performanceIndices.dynamicsViolationSSE, data);
+  append(performanceIndices.equalityConstraintsSSE, data);
+  append(performanceIndices.inequalityConstraintsSSE, data);
+  append(performanceIndices.equalityLagrangian, data);
+  append(performanceIndices.inequalityLagrangian, data);
+  if ((flags & TARGET_TRAJECTORIES_INCLUDED) != 0) {
+    append(commandData.mpcTargetTrajectories_, data);
+  }
+  if ((flags & MODE_SCHEDULE_INCLUDED) != 0) {
+    append(primalSolution.modeSchedule_.eventTimes, data);
+    append(primalSolution.modeSchedule_.modeSequence, data);
+  }
+
+  // trajectories
+  append(primalSolution.timeTrajectory_, data);
+  append(primalSolution.stateTrajectory_, data);
+  append(primalSolution.inputTrajectory_, data);
+  append(primalSolution.postEventIndices_, data);
+
+  // controller
+  if (controllerType == ControllerType::FEEDFORWARD) {
+    const auto& controller = static_cast<const FeedforwardController&>(*primalSolution.controllerPtr_);
+    append(controller.timeStamp_, data);
+    append(controller.uffArray_, data);
+  } else {
+    const auto& controller = static_cast<const LinearController&>(*primalSolution.controllerPtr_);
+    append(controller.timeStamp_, data);
+    append(controller.biasArray_, data);
+    append(controller.gainArray_, data);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PolicyDeserializer::PolicyDeserializer() {
+  reset();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PolicyDeserializer::reset() {
+  targetTrajectories_.clear();
+  modeSchedule_.clear();
+  targetTrajectoriesRevision_ = 0;
+  modeScheduleRevision_ = 0;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool PolicyDeserializer::deserialize(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+                                     PerformanceIndex& performanceIndices) {
+  Reader reader(data, size);
+
+  // header
+  if (reader.read<uint32_t>() != policy_serialization::MAGIC_NUMBER) {
+    throw std::runtime_error("[PolicyDeserializer::deserialize] The data is not a serialized policy or has a different byte order!");
+  }
+  const auto version = reader.read<uint32_t>();
+  if (version != policy_serialization::FORMAT_VERSION) {
+    throw std::runtime_error("[PolicyDeserializer::deserialize] Unsupported format version " + std::to_string(version) + "!");
+  }
+  const auto controllerType = static_cast<ControllerType>(reader.read<uint32_t>());
+  if (controllerType != ControllerType::FEEDFORWARD && controllerType != ControllerType::LINEAR) {
+    throw std::runtime_error("[PolicyDeserializer::deserialize] Unknown ControllerType!");
+  }
+  const auto flags = reader.read<uint32_t>();
+  const auto targetTrajectoriesRevision = reader.read<uint64_t>();
+  const auto modeScheduleRevision = reader.read<uint64_t>();
+
+  // a delta encoded policy can only be completed if the omitted blocks have been received
+  if ((flags & TARGET_TRAJECTORIES_INCLUDED) == 0 && targetTrajectoriesRevision != targetTrajectoriesRevision_) {
+    return false;
+  }
+  if ((flags & MODE_SCHEDULE_INCLUDED) == 0 && modeScheduleRevision != modeScheduleRevision_) {
+    return false;
+  }
+
+  // command and performance indices
+  reader.read(commandData.mpcInitObservation_);
+  performanceIndices.merit = reader.read<scalar_t>();
+  performanceIndices.cost = reader.read<scalar_t>();
+  performanceIndices.dynamicsViolationSSE = reader.read<scalar_t>();
+  performanceIndices.equalityConstraintsSSE = reader.read<scalar_t>();
+  performanceIndices.inequalityConstraintsSSE = reader.read<scalar_t>();
+  performanceIndices.equalityLagrangian = reader.read<scalar_t>();
+  performanceIndices.inequalityLagrangian = reader.read<scalar_t>();
+  if ((flags & TARGET_TRAJECTORIES_INCLUDED) != 0) {
+    reader.read(targetTrajectories_);
+    targetTrajectoriesRevision_ = targetTrajectoriesRevision;
+  }
+  commandData.mpcTargetTrajectories_ = targetTrajectories_;
+  if ((flags & MODE_SCHEDULE_INCLUDED) != 0) {
+    reader.read(modeSchedule_.eventTimes);
+    reader.read(modeSchedule_.modeSequence);
+    modeScheduleRevision_ = modeScheduleRevision;
+  }
+  primalSolution.modeSchedule_ = modeSchedule_;
+
+  // trajectories
+  reader.read(primalSolution.timeTrajectory_);
+  reader.read(primalSolution.stateTrajectory_);
+  reader.read(primalSolution.inputTrajectory_);
+  reader.read(primalSolution.postEventIndices_);
+
+  // controller, reusing the existing one if it has the right type
+  if (primalSolution.controllerPtr_ == nullptr || primalSolution.controllerPtr_->getType() != controllerType) {
+    if (controllerType == ControllerType::FEEDFORWARD) {
+      primalSolution.controllerPtr_.reset(new FeedforwardController);
+    } else {
+      primalSolution.controllerPtr_.reset(new LinearController);
+    }
+  }
+  if (controllerType == ControllerType::FEEDFORWARD) {
+    auto& controller = static_cast<FeedforwardController&>(*primalSolution.controllerPtr_);
+    reader.read(controller.timeStamp_);
+    reader.read(controller.uffArray_);
+  } else {
+    auto& controller = static_cast<LinearController&>(*primalSolution.controllerPtr_);
+    reader.read(controller.timeStamp_);
+    reader.read(controller.biasArray_);
+    reader.read(controller.gainArray_);
+    controller.deltaBiasArray_.clear();
+  }
+
+  reader.expectEnd();
+  return true;
+}
+
+}  // namespace ocs2
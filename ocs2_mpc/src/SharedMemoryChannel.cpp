@@ -0,0 +1,287 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/SharedMemoryChannel.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ocs2 {
+
+namespace {
+// marks a channel whose header is initialized
+constexpr uint32_t CHANNEL_MAGIC_NUMBER = 0x4C4E4843;
+
+// the shared index holds the index of the shared slot in its lower bits and the flag for an unread message on top
+constexpr uint32_t SLOT_INDEX_MASK = 3;
+constexpr uint32_t NEW_MESSAGE_FLAG = 4;
+
+// slots are aligned to cache lines to avoid false sharing between the processes
+constexpr size_t ALIGNMENT = 64;
+
+// time to wait for the creating process to initialize the channel
+constexpr std::chrono::seconds INITIALIZATION_TIMEOUT(5);
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory channels require lock-free atomics.");
+
+size_t alignToCacheLine(size_t size) {
+  return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+std::runtime_error systemError(const std::string& function, const std::string& name) {
+  return std::runtime_error("[SharedMemoryChannel] " + function + " failed for \"" + name + "\": " + std::strerror(errno));
+}
+}  // unnamed namespace
+
+/** The layout at the start of the shared memory. It is followed by the three slots, each holding the message size and the message. */
+struct SharedMemoryChannel::Header {
+  std::atomic<uint32_t> magicNumber;
+  std::atomic<uint32_t> isClosed;       // set by the owner before it removes the shared memory
+  std::atomic<int32_t> ownerProcessId;  // process which removes the shared memory
+  uint64_t maxMessageSize;
+  std::atomic<uint32_t> sharedIndex;  // slot exchanged between the processes
+  std::atomic<uint32_t> writeIndex;   // slot being written, owned by the writer
+  std::atomic<uint32_t> readIndex;    // slot being read, owned by the reader
+};
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, size_t maxMessageSize)
+    : name_("/" + name), isOwner_(false), maxMessageSize_(maxMessageSize), mappedMemory_(nullptr), header_(nullptr) {
+  open();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::~SharedMemoryChannel() {
+  close();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::open() {
+  const auto deadline = std::chrono::steady_clock::now() + INITIALIZATION_TIMEOUT;
+  while (true) {
+    isOwner_ = true;
+    int fileDescriptor = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fileDescriptor == -1 && errno == EEXIST) {
+      isOwner_ = false;
+      fileDescriptor = shm_open(name_.c_str(), O_RDWR, 0600);
+      if (fileDescriptor == -1 && errno == ENOENT) {
+        // removed by its owner in the meantime
+        continue;
+      }
+    }
+    if (fileDescriptor == -1) {
+      throw systemError("shm_open", name_);
+    }
+
+    if (isOwner_) {
+      slotSize_ = alignToCacheLine(sizeof(uint64_t) + maxMessageSize_);
+      mappedSize_ = alignToCacheLine(sizeof(Header)) + 3 * slotSize_;
+      if (ftruncate(fileDescriptor, mappedSize_) == -1) {
+        ::close(fileDescriptor);
+        shm_unlink(name_.c_str());
+        throw systemError("ftruncate", name_);
+      }
+    } else {
+      // wait until the creating process has set the size
+      struct stat fileStatus;
+      while (true) {
+        if (fstat(fileDescriptor, &fileStatus) == -1) {
+          ::close(fileDescriptor);
+          throw systemError("fstat", name_);
+        }
+        if (static_cast<size_t>(fileStatus.st_size) >= sizeof(Header)) {
+          break;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+          ::close(fileDescriptor);
+          throw std::runtime_error("[SharedMemoryChannel] The channel \"" + name_ + "\" was not initialized by its creator!");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      mappedSize_ = fileStatus.st_size;
+    }
+
+    mappedMemory_ = mmap(nullptr, mappedSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    ::close(fileDescriptor);
+    if (mappedMemory_ == MAP_FAILED) {
+      if (isOwner_) {
+        shm_unlink(name_.c_str());
+      }
+      throw systemError("mmap", name_);
+    }
+
+    if (isOwner_) {
+      header_ = new (mappedMemory_) Header;
+      header_->isClosed.store(0, std::memory_order_relaxed);
+      header_->ownerProcessId.store(getpid(), std::memory_order_relaxed);
+      header_->maxMessageSize = maxMessageSize_;
+      header_->readIndex.store(0, std::memory_order_relaxed);
+      header_->writeIndex.store(1, std::memory_order_relaxed);
+      header_->sharedIndex.store(2, std::memory_order_relaxed);
+      for (uint32_t i = 0; i < 3; i++) {
+        const uint64_t messageSize = 0;
+        std::memcpy(slot(i), &messageSize, sizeof(uint64_t));
+      }
+      header_->magicNumber.store(CHANNEL_MAGIC_NUMBER, std::memory_order_release);
+      return;
+    }
+
+    // wait until the creating process has initialized the header
+    header_ = static_cast<Header*>(mappedMemory_);
+    while (header_->magicNumber.load(std::memory_order_acquire) != CHANNEL_MAGIC_NUMBER) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        munmap(mappedMemory_, mappedSize_);
+        throw std::runtime_error("[SharedMemoryChannel] The channel \"" + name_ + "\" was not initialized by its creator!");
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // the owner is about to remove the shared memory, try again with a new one
+    if (header_->isClosed.load(std::memory_order_acquire) != 0) {
+      munmap(mappedMemory_, mappedSize_);
+      if (std::chrono::steady_clock::now() > deadline) {
+        throw std::runtime_error("[SharedMemoryChannel] The channel \"" + name_ + "\" is closed but was not removed by its owner!");
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+
+    maxMessageSize_ = header_->maxMessageSize;
+    slotSize_ = alignToCacheLine(sizeof(uint64_t) + maxMessageSize_);
+    if (mappedSize_ < alignToCacheLine(sizeof(Header)) + 3 * slotSize_) {
+      munmap(mappedMemory_, mappedSize_);
+      throw std::runtime_error("[SharedMemoryChannel] The channel \"" + name_ + "\" is smaller than its header declares!");
+    }
+
+    // take over the shared memory of a crashed owner, such that it is removed eventually
+    int32_t ownerProcessId = header_->ownerProcessId.load(std::memory_order_relaxed);
+    if (kill(ownerProcessId, 0) == -1 && errno == ESRCH) {
+      isOwner_ = header_->ownerProcessId.compare_exchange_strong(ownerProcessId, getpid(), std::memory_order_relaxed);
+    }
+    return;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::close() {
+  if (isOwner_) {
+    header_->isClosed.store(1, std::memory_order_release);
+    shm_unlink(name_.c_str());
+  }
+  munmap(mappedMemory_, mappedSize_);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::write(const uint8_t* data, size_t size) {
+  if (header_->isClosed.load(std::memory_order_acquire) != 0) {
+    close();
+    open();
+  }
+  if (size > maxMessageSize_) {
+    throw std::runtime_error("[SharedMemoryChannel::write] The message of " + std::to_string(size) + " bytes exceeds the maximum of " +
+                             std::to_string(maxMessageSize_) + " bytes of the channel \"" + name_ + "\"!");
+  }
+
+  const auto index = header_->writeIndex.load(std::memory_order_relaxed);
+  const uint64_t messageSize = size;
+  std::memcpy(slot(index), &messageSize, sizeof(uint64_t));
+  if (size > 0) {
+    std::memcpy(slot(index) + sizeof(uint64_t), data, size);
+  }
+
+  // publish the written slot and continue with the one the reader does not use anymore
+  const auto previousIndex = header_->sharedIndex.exchange(index | NEW_MESSAGE_FLAG, std::memory_order_acq_rel);
+  header_->writeIndex.store(previousIndex & SLOT_INDEX_MASK, std::memory_order_relaxed);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::read() {
+  if (header_->isClosed.load(std::memory_order_acquire) != 0) {
+    close();
+    open();
+    return false;
+  }
+  if ((header_->sharedIndex.load(std::memory_order_relaxed) & NEW_MESSAGE_FLAG) == 0) {
+    return false;
+  }
+
+  // hand over the slot read so far and take the latest message
+  const auto index = header_->readIndex.load(std::memory_order_relaxed);
+  const auto newIndex = header_->sharedIndex.exchange(index, std::memory_order_acq_rel) & SLOT_INDEX_MASK;
+  header_->readIndex.store(newIndex, std::memory_order_relaxed);
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+const uint8_t* SharedMemoryChannel::messageData() const {
+  return slot(header_->readIndex.load(std::memory_order_relaxed)) + sizeof(uint64_t);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t SharedMemoryChannel::messageSize() const {
+  uint64_t messageSize;
+  std::memcpy(&messageSize, slot(header_->readIndex.load(std::memory_order_relaxed)), sizeof(uint64_t));
+  return static_cast<size_t>(messageSize);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint8_t* SharedMemoryChannel::slot(uint32_t index) const {
+  return static_cast<uint8_t*>(mappedMemory_) + alignToCacheLine(sizeof(Header)) + index * slotSize_;
+}
+
+}  // namespace ocs2
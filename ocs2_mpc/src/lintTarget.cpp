@@ -1,7 +1,13 @@
 #include <ocs2_mpc/MPC_BASE.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_mpc/MPC_Settings.h>
+#include <ocs2_mpc/MPC_SharedMemory_Interface.h>
 #include <ocs2_mpc/MRT_BASE.h>
+#include <ocs2_mpc/MRT_SharedMemory_Interface.h>
+#include <ocs2_mpc/MpcBatch.h>
+#include <ocs2_mpc/PolicySerialization.h>
+#include <ocs2_mpc/SharedMemoryChannel.h>
+#include <ocs2_mpc/SharedMemoryTopics.h>
 
 #include <ocs2_mpc/CommandData.h>
 #include <ocs2_mpc/SystemObservation.h>
@@ -0,0 +1,114 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/misc/Benchmark.h>
+
+#include "ocs2_mpc/SharedMemoryChannel.h"
+
+using namespace ocs2;
+
+/**
+ * Measures the round-trip latency of SharedMemoryChannel between two processes for several message sizes. The child process sends every
+ * message back on a second channel, as the MPC answers an observation of the MRT with a policy.
+ * usage: ocs2_mpc_shared_memory_round_trip_benchmark
+ */
+int main() {
+  constexpr size_t numRoundTrips = 10000;
+  const std::string prefix = "ocs2_round_trip_benchmark_" + std::to_string(getpid());
+  const std::string pingName = prefix + "_ping";
+  const std::string pongName = prefix + "_pong";
+
+  std::cerr << "\nmessage size [B] | average [us] | max [us]\n";
+  for (const size_t messageSize : {size_t(64), size_t(512), size_t(4 * 1024), size_t(64 * 1024), size_t(512 * 1024)}) {
+    SharedMemoryChannel ping(pingName, messageSize);
+    SharedMemoryChannel pong(pongName, messageSize);
+
+    // the child process sends every message back, an empty message stops it
+    const pid_t pid = fork();
+    if (pid == -1) {
+      std::cerr << "fork() failed.\n";
+      return 1;
+    }
+    if (pid == 0) {
+      SharedMemoryChannel childPing(pingName, messageSize);
+      SharedMemoryChannel childPong(pongName, messageSize);
+      while (true) {
+        if (childPing.read()) {
+          childPong.write(childPing.messageData(), childPing.messageSize());
+          if (childPing.messageSize() == 0) {
+            _exit(0);
+          }
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    benchmark::RepeatedTimer roundTripTimer;
+    std::vector<uint8_t> message(messageSize);
+    size_t numMismatches = 0;
+    for (size_t i = 0; i < numRoundTrips; i++) {
+      std::memcpy(message.data(), &i, sizeof(i));
+      roundTripTimer.startTimer();
+      ping.write(message.data(), message.size());
+      while (!pong.read()) {
+        std::this_thread::yield();
+      }
+      roundTripTimer.endTimer();
+
+      size_t returned;
+      std::memcpy(&returned, pong.messageData(), sizeof(returned));
+      if (returned != i) {
+        numMismatches++;
+      }
+    }
+
+    ping.write(nullptr, 0);
+    int status;
+    waitpid(pid, &status, 0);
+
+    std::cerr << messageSize << "\t\t | " << 1000.0 * roundTripTimer.getAverageInMilliseconds() << "\t| "
+              << 1000.0 * roundTripTimer.getMaxIntervalInMilliseconds() << "\n";
+    if (numMismatches > 0) {
+      std::cerr << numMismatches << " messages were not returned in order.\n";
+      return 1;
+    }
+  }
+
+  return 0;
+}
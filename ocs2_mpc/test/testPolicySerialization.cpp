@@ -0,0 +1,208 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+
+#include "ocs2_mpc/PolicySerialization.h"
+
+using namespace ocs2;
+
+class PolicySerializationTest : public testing::Test {
+ protected:
+  // size of a legged robot policy
+  static constexpr size_t N = 100;
+  static constexpr size_t STATE_DIM = 24;
+  static constexpr size_t INPUT_DIM = 24;
+
+  PolicySerializationTest() {
+    command.mpcInitObservation_.time = 0.1;
+    command.mpcInitObservation_.mode = 3;
+    command.mpcInitObservation_.state = vector_t::Random(STATE_DIM);
+    command.mpcInitObservation_.input = vector_t::Random(INPUT_DIM);
+    command.mpcTargetTrajectories_ = TargetTrajectories({0.0, 1.0}, {vector_t::Random(STATE_DIM), vector_t::Random(STATE_DIM)},
+                                                        {vector_t::Random(INPUT_DIM), vector_t::Random(INPUT_DIM)});
+
+    performanceIndices.merit = 1.0;
+    performanceIndices.cost = 2.0;
+    performanceIndices.dynamicsViolationSSE = 3.0;
+    performanceIndices.equalityConstraintsSSE = 4.0;
+    performanceIndices.inequalityConstraintsSSE = 5.0;
+    performanceIndices.equalityLagrangian = 6.0;
+    performanceIndices.inequalityLagrangian = 7.0;
+
+    vector_array_t biasArray;
+    matrix_array_t gainArray;
+    for (size_t k = 0; k < N; k++) {
+      primalSolution.timeTrajectory_.push_back(0.1 + 0.01 * k);
+      primalSolution.stateTrajectory_.push_back(vector_t::Random(STATE_DIM));
+      primalSolution.inputTrajectory_.push_back(vector_t::Random(INPUT_DIM));
+      biasArray.push_back(vector_t::Random(INPUT_DIM));
+      gainArray.push_back(matrix_t::Random(INPUT_DIM, STATE_DIM));
+    }
+    primalSolution.postEventIndices_ = {40, 80};
+    primalSolution.modeSchedule_ = ModeSchedule({0.5, 0.9}, {3, 5, 3});
+    primalSolution.controllerPtr_.reset(new LinearController(primalSolution.timeTrajectory_, biasArray, gainArray));
+  }
+
+  void expectEqual(const CommandData& otherCommand, const PrimalSolution& otherPrimalSolution,
+                   const PerformanceIndex& otherPerformanceIndices) const {
+    EXPECT_EQ(otherCommand.mpcInitObservation_.time, command.mpcInitObservation_.time);
+    EXPECT_EQ(otherCommand.mpcInitObservation_.mode, command.mpcInitObservation_.mode);
+    EXPECT_TRUE(otherCommand.mpcInitObservation_.state == command.mpcInitObservation_.state);
+    EXPECT_TRUE(otherCommand.mpcInitObservation_.input == command.mpcInitObservation_.input);
+    EXPECT_EQ(otherCommand.mpcTargetTrajectories_.timeTrajectory, command.mpcTargetTrajectories_.timeTrajectory);
+    EXPECT_EQ(otherCommand.mpcTargetTrajectories_.stateTrajectory, command.mpcTargetTrajectories_.stateTrajectory);
+    EXPECT_EQ(otherCommand.mpcTargetTrajectories_.inputTrajectory, command.mpcTargetTrajectories_.inputTrajectory);
+
+    EXPECT_EQ(otherPerformanceIndices.merit, performanceIndices.merit);
+    EXPECT_EQ(otherPerformanceIndices.cost, performanceIndices.cost);
+    EXPECT_EQ(otherPerformanceIndices.dynamicsViolationSSE, performanceIndices.dynamicsViolationSSE);
+    EXPECT_EQ(otherPerformanceIndices.equalityConstraintsSSE, performanceIndices.equalityConstraintsSSE);
+    EXPECT_EQ(otherPerformanceIndices.inequalityConstraintsSSE, performanceIndices.inequalityConstraintsSSE);
+    EXPECT_EQ(otherPerformanceIndices.equalityLagrangian, performanceIndices.equalityLagrangian);
+    EXPECT_EQ(otherPerformanceIndices.inequalityLagrangian, performanceIndices.inequalityLagrangian);
+
+    EXPECT_EQ(otherPrimalSolution.timeTrajectory_, primalSolution.timeTrajectory_);
+    EXPECT_EQ(otherPrimalSolution.stateTrajectory_, primalSolution.stateTrajectory_);
+    EXPECT_EQ(otherPrimalSolution.inputTrajectory_, primalSolution.inputTrajectory_);
+    EXPECT_EQ(otherPrimalSolution.postEventIndices_, primalSolution.postEventIndices_);
+    EXPECT_EQ(otherPrimalSolution.modeSchedule_.eventTimes, primalSolution.modeSchedule_.eventTimes);
+    EXPECT_EQ(otherPrimalSolution.modeSchedule_.modeSequence, primalSolution.modeSchedule_.modeSequence);
+
+    ASSERT_EQ(otherPrimalSolution.controllerPtr_->getType(), primalSolution.controllerPtr_->getType());
+    if (primalSolution.controllerPtr_->getType() == ControllerType::LINEAR) {
+      const auto& controller = static_cast<const LinearController&>(*primalSolution.controllerPtr_);
+      const auto& otherController = static_cast<const LinearController&>(*otherPrimalSolution.controllerPtr_);
+      EXPECT_EQ(otherController.timeStamp_, controller.timeStamp_);
+      EXPECT_EQ(otherController.biasArray_, controller.biasArray_);
+      EXPECT_EQ(otherController.gainArray_, controller.gainArray_);
+    } else {
+      const auto& controller = static_cast<const FeedforwardController&>(*primalSolution.controllerPtr_);
+      const auto& otherController = static_cast<const FeedforwardController&>(*otherPrimalSolution.controllerPtr_);
+      EXPECT_EQ(otherController.timeStamp_, controller.timeStamp_);
+      EXPECT_EQ(otherController.uffArray_, controller.uffArray_);
+    }
+  }
+
+  CommandData command;
+  PrimalSolution primalSolution;
+  PerformanceIndex performanceIndices;
+};
+
+constexpr size_t PolicySerializationTest::N;
+constexpr size_t PolicySerializationTest::STATE_DIM;
+constexpr size_t PolicySerializationTest::INPUT_DIM;
+
+TEST_F(PolicySerializationTest, linearController) {
+  PolicySerializer serializer;
+  PolicyDeserializer deserializer;
+
+  std::vector<uint8_t> data;
+  serializer.serialize(command, primalSolution, performanceIndices, data);
+
+  CommandData otherCommand;
+  PrimalSolution otherPrimalSolution;
+  PerformanceIndex otherPerformanceIndices;
+  ASSERT_TRUE(deserializer.deserialize(data.data(), data.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  expectEqual(otherCommand, otherPrimalSolution, otherPerformanceIndices);
+}
+
+TEST_F(PolicySerializationTest, feedforwardController) {
+  primalSolution.controllerPtr_.reset(new FeedforwardController(primalSolution.timeTrajectory_, primalSolution.inputTrajectory_));
+
+  PolicySerializer serializer;
+  PolicyDeserializer deserializer;
+
+  std::vector<uint8_t> data;
+  serializer.serialize(command, primalSolution, performanceIndices, data);
+
+  // deserialize into a policy with a controller of the other type
+  CommandData otherCommand;
+  PrimalSolution otherPrimalSolution;
+  otherPrimalSolution.controllerPtr_.reset(new LinearController);
+  PerformanceIndex otherPerformanceIndices;
+  ASSERT_TRUE(deserializer.deserialize(data.data(), data.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  expectEqual(otherCommand, otherPrimalSolution, otherPerformanceIndices);
+}
+
+TEST_F(PolicySerializationTest, deltaEncoding) {
+  const size_t keyFrameInterval = 3;
+  PolicySerializer serializer(true, keyFrameInterval);
+  PolicyDeserializer deserializer;
+
+  CommandData otherCommand;
+  PrimalSolution otherPrimalSolution;
+  PerformanceIndex otherPerformanceIndices;
+
+  // the first policy is complete, the second one leaves out the unchanged target trajectories and mode schedule
+  std::vector<uint8_t> keyFrame, deltaFrame;
+  serializer.serialize(command, primalSolution, performanceIndices, keyFrame);
+  serializer.serialize(command, primalSolution, performanceIndices, deltaFrame);
+  EXPECT_LT(deltaFrame.size(), keyFrame.size());
+
+  // a delta encoded policy is rejected if the reference has not been received
+  EXPECT_FALSE(deserializer.deserialize(deltaFrame.data(), deltaFrame.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  ASSERT_TRUE(deserializer.deserialize(keyFrame.data(), keyFrame.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  ASSERT_TRUE(deserializer.deserialize(deltaFrame.data(), deltaFrame.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  expectEqual(otherCommand, otherPrimalSolution, otherPerformanceIndices);
+
+  // a changed target trajectory is included
+  command.mpcTargetTrajectories_.stateTrajectory.front().setZero();
+  std::vector<uint8_t> data;
+  serializer.serialize(command, primalSolution, performanceIndices, data);
+  EXPECT_EQ(data.size(), keyFrame.size() - sizeof(scalar_t) * (primalSolution.modeSchedule_.eventTimes.size() + 1) -
+                             sizeof(uint64_t) * (primalSolution.modeSchedule_.modeSequence.size() + 1));
+  ASSERT_TRUE(deserializer.deserialize(data.data(), data.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  expectEqual(otherCommand, otherPrimalSolution, otherPerformanceIndices);
+
+  // every keyFrameInterval-th policy is complete
+  serializer.serialize(command, primalSolution, performanceIndices, data);
+  EXPECT_EQ(data.size(), keyFrame.size());
+  PolicyDeserializer newDeserializer;
+  ASSERT_TRUE(newDeserializer.deserialize(data.data(), data.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  expectEqual(otherCommand, otherPrimalSolution, otherPerformanceIndices);
+}
+
+TEST_F(PolicySerializationTest, invalidData) {
+  PolicySerializer serializer;
+  PolicyDeserializer deserializer;
+
+  std::vector<uint8_t> data;
+  serializer.serialize(command, primalSolution, performanceIndices, data);
+
+  CommandData otherCommand;
+  PrimalSolution otherPrimalSolution;
+  PerformanceIndex otherPerformanceIndices;
+  EXPECT_ANY_THROW(deserializer.deserialize(data.data(), data.size() - 1, otherCommand, otherPrimalSolution, otherPerformanceIndices));
+  data.front() = 0;
+  EXPECT_ANY_THROW(deserializer.deserialize(data.data(), data.size(), otherCommand, otherPrimalSolution, otherPerformanceIndices));
+}
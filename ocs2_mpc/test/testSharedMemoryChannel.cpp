@@ -0,0 +1,194 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ocs2_mpc/SharedMemoryChannel.h"
+
+using namespace ocs2;
+
+namespace {
+// unique channel names, such that tests running in parallel do not interfere
+std::string channelName(const std::string& name) {
+  return "ocs2_test_" + name + "_" + std::to_string(getpid());
+}
+}  // unnamed namespace
+
+TEST(testSharedMemoryChannel, latestMessage) {
+  const size_t maxMessageSize = 16;
+  SharedMemoryChannel writer(channelName("latest"), maxMessageSize);
+  SharedMemoryChannel reader(channelName("latest"), 0);
+  ASSERT_EQ(reader.maxMessageSize(), maxMessageSize);
+
+  EXPECT_FALSE(reader.read());
+  EXPECT_EQ(reader.messageSize(), 0);
+
+  // only the latest message is read
+  for (uint8_t i = 0; i < 5; i++) {
+    const uint8_t message[2] = {i, i};
+    writer.write(message, sizeof(message));
+  }
+  ASSERT_TRUE(reader.read());
+  ASSERT_EQ(reader.messageSize(), 2);
+  EXPECT_EQ(reader.messageData()[0], 4);
+  EXPECT_EQ(reader.messageData()[1], 4);
+  EXPECT_FALSE(reader.read());
+
+  // the message stays readable while the writer continues
+  const uint8_t message[3] = {5, 6, 7};
+  writer.write(message, sizeof(message));
+  writer.write(message, sizeof(message));
+  EXPECT_EQ(reader.messageData()[0], 4);
+  ASSERT_TRUE(reader.read());
+  ASSERT_EQ(reader.messageSize(), 3);
+  EXPECT_EQ(std::memcmp(reader.messageData(), message, sizeof(message)), 0);
+
+  const uint8_t tooLarge[maxMessageSize + 1] = {};
+  EXPECT_ANY_THROW(writer.write(tooLarge, sizeof(tooLarge)));
+}
+
+TEST(testSharedMemoryChannel, restartOfOwner) {
+  const auto name = channelName("restart");
+  const uint8_t message[2] = {1, 2};
+  auto expectMessage = [&](SharedMemoryChannel& reader) {
+    ASSERT_TRUE(reader.read());
+    ASSERT_EQ(reader.messageSize(), sizeof(message));
+    EXPECT_EQ(std::memcmp(reader.messageData(), message, sizeof(message)), 0);
+  };
+
+  std::unique_ptr<SharedMemoryChannel> reader(new SharedMemoryChannel(name, 16));
+  std::unique_ptr<SharedMemoryChannel> writer(new SharedMemoryChannel(name, 0));
+
+  // the owning reader restarts before the writer notices it
+  reader.reset();
+  reader.reset(new SharedMemoryChannel(name, 16));
+  writer->write(message, sizeof(message));
+  expectMessage(*reader);
+
+  // the owning reader restarts after the writer reopened the channel, such that the writer owns it now
+  reader.reset();
+  writer->write(message, sizeof(message));
+  reader.reset(new SharedMemoryChannel(name, 0));
+  EXPECT_EQ(reader->maxMessageSize(), 16);
+  expectMessage(*reader);
+
+  // the owning writer restarts
+  writer.reset();
+  EXPECT_FALSE(reader->read());
+  writer.reset(new SharedMemoryChannel(name, 0));
+  writer->write(message, sizeof(message));
+  expectMessage(*reader);
+}
+
+TEST(testSharedMemoryChannel, crashedOwner) {
+  const auto name = channelName("crashed");
+
+  // the child creates the channel and exits without removing it
+  const pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    new SharedMemoryChannel(name, 16);
+    _exit(0);
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status));
+
+  // the channel is taken over and removed
+  {
+    SharedMemoryChannel channel(name, 0);
+    EXPECT_EQ(channel.maxMessageSize(), 16);
+  }
+  EXPECT_EQ(shm_open(("/" + name).c_str(), O_RDWR, 0600), -1);
+}
+
+TEST(testSharedMemoryChannel, roundTripBetweenProcesses) {
+  const size_t numRoundTrips = 1000;
+  for (const size_t messageSize : {size_t(512), size_t(512 * 1024)}) {
+    const auto pingName = channelName("ping");
+    const auto pongName = channelName("pong");
+    SharedMemoryChannel ping(pingName, messageSize);
+    SharedMemoryChannel pong(pongName, messageSize);
+
+    // the child process sends every message back, an empty message stops it
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+      SharedMemoryChannel childPing(pingName, messageSize);
+      SharedMemoryChannel childPong(pongName, messageSize);
+      while (true) {
+        if (childPing.read()) {
+          childPong.write(childPing.messageData(), childPing.messageSize());
+          if (childPing.messageSize() == 0) {
+            _exit(0);
+          }
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    // stop at the first mismatch, the child is stopped below in any case
+    std::vector<uint8_t> message(messageSize);
+    size_t numMatches = 0;
+    for (size_t i = 0; i < numRoundTrips && numMatches == i; i++) {
+      std::memcpy(message.data(), &i, sizeof(i));
+      ping.write(message.data(), message.size());
+      while (!pong.read()) {
+        std::this_thread::yield();
+      }
+
+      size_t returned;
+      std::memcpy(&returned, pong.messageData(), sizeof(returned));
+      EXPECT_EQ(returned, i);
+      EXPECT_EQ(pong.messageSize(), messageSize);
+      if (returned == i) {
+        numMatches++;
+      }
+    }
+    EXPECT_EQ(numMatches, numRoundTrips);
+
+    ping.write(nullptr, 0);
+    int status;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status));
+  }
+}
@@ -128,6 +128,13 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input);
 
+/**
+ * Compute the quadratic approximation of the total intermediate cost (i.e. cost + softConstraints) into the given approximation. Its
+ * memory is reused if the dimensions do not change. It is assumed that the precomputation request is already made.
+ */
+void approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                     ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the total preJump cost (i.e. cost + softConstraints). It is assumed that the precomputation request is already made.
  */
@@ -140,6 +147,13 @@ scalar_t computeEventCost(const OptimalControlProblem& problem, const scalar_t&
 ScalarFunctionQuadraticApproximation approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state);
 
+/**
+ * Compute the quadratic approximation of the total preJump cost (i.e. cost + softConstraints) into the given approximation. Its memory
+ * is reused if the dimensions do not change. It is assumed that the precomputation request is already made.
+ */
+void approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the total final cost (i.e. cost + softConstraints). It is assumed that the precomputation request is already made.
  */
@@ -152,6 +166,13 @@ scalar_t computeFinalCost(const OptimalControlProblem& problem, const scalar_t&
 ScalarFunctionQuadraticApproximation approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state);
 
+/**
+ * Compute the quadratic approximation of the total final cost (i.e. cost + softConstraints) into the given approximation. Its memory is
+ * reused if the dimensions do not change. It is assumed that the precomputation request is already made.
+ */
+void approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the intermediate-time metrics (i.e. cost, softConstraints, and constraints).
  *
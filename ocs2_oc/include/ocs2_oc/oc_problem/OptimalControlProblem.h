@@ -75,6 +75,8 @@ struct OptimalControlProblem {
   std::unique_ptr<StateConstraintCollection> preJumpEqualityConstraintPtr;
   /** Final equality constraints */
   std::unique_ptr<StateConstraintCollection> finalEqualityConstraintPtr;
+  /** Intermediate inequality constraints h(x, u) >= 0, only handled by solvers with native inequality support (e.g. SQP) */
+  std::unique_ptr<StateInputConstraintCollection> inequalityConstraintPtr;
 
   /* Lagrangians */
   /** Lagrangian for intermediate equality constraints */
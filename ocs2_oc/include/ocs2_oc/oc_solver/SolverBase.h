@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -129,6 +130,29 @@ class SolverBase {
     synchronizedModules_.push_back(std::move(synchronizedModule));
   }
 
+  /**
+   * Sets the computation time budget of each run. The solver stops iterating early when it predicts that the next iteration
+   * would not finish within the budget, such that the latest iterate is returned in time.
+   *
+   * @param [in] timeBudget: The time budget in seconds. Any non-positive number disables the budget.
+   */
+  void setTimeBudget(scalar_t timeBudget) { timeBudget_ = timeBudget; }
+
+  /** Gets the computation time budget of each run in seconds. A non-positive number means no budget. */
+  scalar_t getTimeBudget() const { return timeBudget_; }
+
+  /** Whether the latest run took longer than the time budget. */
+  bool isTimeBudgetMissed() const { return isTimeBudgetMissed_; }
+
+  /** Number of runs that took longer than the time budget since the last call to resetTimeBudgetMisses(). */
+  size_t getNumTimeBudgetMisses() const { return numTimeBudgetMisses_; }
+
+  /** Resets the counter of runs that took longer than the time budget. */
+  void resetTimeBudgetMisses() {
+    isTimeBudgetMissed_ = false;
+    numTimeBudgetMisses_ = 0;
+  }
+
   /**
    * Returns the cost, merit function and ISEs of constraints for the latest optimized trajectory.
    *
@@ -213,6 +237,15 @@ class SolverBase {
    */
   void printString(const std::string& text) const;
 
+ protected:
+  /**
+   * Checks whether an operation with the given predicted duration would still finish within the time budget of the current run.
+   *
+   * @param [in] predictedDuration: The predicted duration in milliseconds.
+   * @return true if there is no time budget or the operation is predicted to finish within it.
+   */
+  bool isWithinTimeBudget(scalar_t predictedDuration) const;
+
  private:
   virtual void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) = 0;
 
@@ -224,12 +257,23 @@ class SolverBase {
 
   void postRun();
 
+  /** Starts measuring the duration of a run. */
+  void startTimeBudget();
+
+  /** Checks whether the run took longer than the time budget. */
+  void endTimeBudget();
+
   /***********
    * Variables
    ***********/
   mutable std::mutex outputDisplayGuardMutex_;
   std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr_;  // this pointer cannot be nullptr
   std::vector<std::shared_ptr<SolverSynchronizedModule>> synchronizedModules_;
+
+  scalar_t timeBudget_ = -1.0;
+  std::chrono::steady_clock::time_point runStartTime_;
+  bool isTimeBudgetMissed_ = false;
+  size_t numTimeBudgetMisses_ = 0;
 };
 
 }  // namespace ocs2
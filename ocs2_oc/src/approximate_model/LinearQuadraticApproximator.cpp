@@ -51,10 +51,10 @@ void approximateIntermediateLQ(OptimalControlProblem& problem, const scalar_t ti
 
   // Dynamics
   modelData.dynamicsCovariance = problem.dynamicsPtr->dynamicsCovariance(time, state, input);
-  modelData.dynamics = problem.dynamicsPtr->linearApproximation(time, state, input, preComputation);
+  problem.dynamicsPtr->linearApproximationInPlace(time, state, input, preComputation, modelData.dynamics);
 
   // Cost
-  modelData.cost = ocs2::approximateCost(problem, time, state, input);
+  ocs2::approximateCost(problem, time, state, input, modelData.cost);
 
   // Equality constraints
   modelData.stateEqConstraint = problem.stateEqualityConstraintPtr->getLinearApproximation(time, state, preComputation);
@@ -178,14 +178,25 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input) {
+  ScalarFunctionQuadraticApproximation cost;
+  approximateCost(problem, time, state, input, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                     ScalarFunctionQuadraticApproximation& cost) {
   const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
   const auto& preComputation = *problem.preComputationPtr;
 
   // get the state-input cost approximations
-  auto cost = problem.costPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
+  cost.setZero(state.rows(), input.rows());
+  problem.costPtr->accumulateQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
 
   if (!problem.softConstraintPtr->empty()) {
-    cost += problem.softConstraintPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
+    problem.softConstraintPtr->accumulateQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
   }
 
   // get the state only cost approximations
@@ -202,8 +213,6 @@ ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem
     cost.dfdx += stateCost.dfdx;
     cost.dfdxx += stateCost.dfdxx;
   }
-
-  return cost;
 }
 
 /******************************************************************************************************/
@@ -235,6 +244,23 @@ ScalarFunctionQuadraticApproximation approximateEventCost(const OptimalControlPr
   return cost;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost) {
+  const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
+  const auto& preComputation = *problem.preComputationPtr;
+
+  cost.setZero(state.rows(), 0);
+  if (!problem.preJumpCostPtr->empty()) {
+    cost += problem.preJumpCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  }
+  if (!problem.preJumpSoftConstraintPtr->empty()) {
+    cost += problem.preJumpSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -264,6 +290,23 @@ ScalarFunctionQuadraticApproximation approximateFinalCost(const OptimalControlPr
   return cost;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost) {
+  const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
+  const auto& preComputation = *problem.preComputationPtr;
+
+  cost.setZero(state.rows(), 0);
+  if (!problem.finalCostPtr->empty()) {
+    cost += problem.finalCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  }
+  if (!problem.finalSoftConstraintPtr->empty()) {
+    cost += problem.finalSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
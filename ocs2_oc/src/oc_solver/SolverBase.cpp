@@ -47,27 +47,33 @@ SolverBase::SolverBase() : referenceManagerPtr_(new ReferenceManager) {}
 /******************************************************************************************************/
 /******************************************************************************************************/
 void SolverBase::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime) {
+  startTimeBudget();
   preRun(initTime, initState, finalTime);
   runImpl(initTime, initState, finalTime);
   postRun();
+  endTimeBudget();
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void SolverBase::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const ControllerBase* externalControllerPtr) {
+  startTimeBudget();
   preRun(initTime, initState, finalTime);
   runImpl(initTime, initState, finalTime, externalControllerPtr);
   postRun();
+  endTimeBudget();
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void SolverBase::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution) {
+  startTimeBudget();
   preRun(initTime, initState, finalTime);
   runImpl(initTime, initState, finalTime, primalSolution);
   postRun();
+  endTimeBudget();
 }
 
 /******************************************************************************************************/
@@ -110,4 +116,32 @@ void SolverBase::postRun() {
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SolverBase::startTimeBudget() {
+  runStartTime_ = std::chrono::steady_clock::now();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SolverBase::endTimeBudget() {
+  isTimeBudgetMissed_ = !isWithinTimeBudget(0.0);
+  if (isTimeBudgetMissed_) {
+    numTimeBudgetMisses_++;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SolverBase::isWithinTimeBudget(scalar_t predictedDuration) const {
+  if (timeBudget_ <= 0.0) {
+    return true;
+  }
+  const auto elapsedTime = std::chrono::duration<scalar_t, std::milli>(std::chrono::steady_clock::now() - runStartTime_).count();
+  return elapsedTime + predictedDuration <= 1000.0 * timeBudget_;
+}
+
 }  // namespace ocs2
@@ -46,6 +46,9 @@ enum anymal : size_t {
 
 static const std::vector<std::string> anymal3DofContactNames = {"LF_FOOT", "RF_FOOT", "LH_FOOT", "RH_FOOT"};
 static const std::vector<std::string> anymal6DofContactNames = {};
+// Front feet treated as 6-DoF contacts, to cover contact wrenches
+static const std::vector<std::string> anymalMixed3DofContactNames = {"LH_FOOT", "RH_FOOT"};
+static const std::vector<std::string> anymalMixed6DofContactNames = {"LF_FOOT", "RF_FOOT"};
 static const std::string anymalUrdfFile = ocs2::robotic_assets::getPath() + "/resources/anymal_c/urdf/anymal.urdf";
 
 inline ocs2::vector_t getInitialState() {
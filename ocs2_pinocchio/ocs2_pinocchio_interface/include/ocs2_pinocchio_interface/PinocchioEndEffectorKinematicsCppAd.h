@@ -48,6 +48,9 @@ namespace ocs2 {
  * centroidal model mapping (refer to CentroidalModelPinocchioMapping).
  *
  * See also PinocchioEndEffectorKinematics, which uses analytical computation and caching.
+ *
+ * @note The evaluations reuse mutable CppAdInterface workspaces, so the const methods of one instance are not reentrant.
+ * Use one clone per thread.
  */
 class PinocchioEndEffectorKinematicsCppAd final : public EndEffectorKinematics<scalar_t> {
  public:
@@ -123,6 +126,9 @@ class PinocchioEndEffectorKinematicsCppAd final : public EndEffectorKinematics<s
   std::unique_ptr<CppAdInterface> positionCppAdInterfacePtr_;
   std::unique_ptr<CppAdInterface> velocityCppAdInterfacePtr_;
   std::unique_ptr<CppAdInterface> orientationErrorCppAdInterfacePtr_;
+  mutable CppAdInterface::Workspace positionWorkspace_;
+  mutable CppAdInterface::Workspace velocityWorkspace_;
+  mutable CppAdInterface::Workspace orientationErrorWorkspace_;
 
   const std::vector<std::string> endEffectorIds_;
   std::vector<size_t> endEffectorFrameIds_;
@@ -0,0 +1,101 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include <ocs2_core/PreComputation.h>
+
+#include <ocs2_pinocchio_interface/PinocchioInterface.h>
+#include <ocs2_pinocchio_interface/PinocchioStateInputMapping.h>
+
+namespace ocs2 {
+
+/**
+ * Pre-computation stage which updates the pinocchio::Data of its PinocchioInterface once per node, such that all the pinocchio-based
+ * cost, constraint, and dynamics terms can read the kinematics from it instead of recomputing them. The terms should get the updated
+ * interface through cast<PinocchioPreComputation>(preComp).getPinocchioInterface().
+ *
+ * For requests matching Settings::request, pinocchio::Data is updated as:
+ *   pinocchio::forwardKinematics(model, data, q)           (or pinocchio::computeCentroidalMap(model, data, q) if Settings::centroidalMap)
+ *   pinocchio::updateFramePlacements(model, data)
+ * and additionally on Request::Approximation (if Settings::jointJacobians):
+ *   pinocchio::computeJointJacobians(model, data)
+ * The joint Jacobians are computed in the same pass as the joint placements, i.e. a single forward kinematics pass is done per node.
+ */
+class PinocchioPreComputation : public PreComputation {
+ public:
+  struct Settings {
+    /** The requests for which pinocchio::Data is updated. */
+    RequestSet request = Request::Cost + Request::Constraint + Request::SoftConstraint;
+    /** Whether the joint Jacobians are computed on Request::Approximation. */
+    bool jointJacobians = true;
+    /** Whether the centroidal momentum matrix (data.Ag) is computed. */
+    bool centroidalMap = false;
+  };
+
+  /**
+   * Constructor
+   * @param [in] pinocchioInterface : The pinocchio interface which is updated.
+   * @param [in] mapping : Mapping from the OCS2 state to the pinocchio joint configuration.
+   * @param [in] settings : Settings which determine what is computed.
+   */
+  PinocchioPreComputation(PinocchioInterface pinocchioInterface, const PinocchioStateInputMapping<scalar_t>& mapping, Settings settings);
+
+  /** Constructor with the default settings */
+  PinocchioPreComputation(PinocchioInterface pinocchioInterface, const PinocchioStateInputMapping<scalar_t>& mapping);
+
+  ~PinocchioPreComputation() override = default;
+  PinocchioPreComputation* clone() const override;
+
+  void request(RequestSet request, scalar_t t, const vector_t& x, const vector_t& u) override;
+  void requestPreJump(RequestSet request, scalar_t t, const vector_t& x) override;
+  void requestFinal(RequestSet request, scalar_t t, const vector_t& x) override;
+
+  PinocchioInterface& getPinocchioInterface() { return pinocchioInterface_; }
+  const PinocchioInterface& getPinocchioInterface() const { return pinocchioInterface_; }
+
+  const PinocchioStateInputMapping<scalar_t>& getPinocchioMapping() const { return *mappingPtr_; }
+
+  const Settings& settings() const { return settings_; }
+
+ protected:
+  PinocchioPreComputation(const PinocchioPreComputation& rhs);
+
+  /** Updates pinocchio::Data for the given request and state. */
+  virtual void updatePinocchioData(RequestSet request, const vector_t& x);
+
+ private:
+  PinocchioInterface pinocchioInterface_;
+  std::unique_ptr<PinocchioStateInputMapping<scalar_t>> mappingPtr_;
+  Settings settings_;
+};
+
+}  // namespace ocs2
@@ -99,14 +99,12 @@ PinocchioEndEffectorKinematicsCppAd::PinocchioEndEffectorKinematicsCppAd(
   orientationErrorCppAdInterfacePtr_.reset(
       new CppAdInterface(orientationFunc, stateDim, 4 * endEffectorFrameIds_.size(), modelName + "_orientation", modelFolder));
 
+  const std::vector<CppAdInterface*> adInterfaces{positionCppAdInterfacePtr_.get(), velocityCppAdInterfacePtr_.get(),
+                                                  orientationErrorCppAdInterfacePtr_.get()};
   if (recompileLibraries) {
-    positionCppAdInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    velocityCppAdInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    orientationErrorCppAdInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::createModels(adInterfaces, CppAdInterface::ApproximationOrder::First, verbose);
   } else {
-    positionCppAdInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    velocityCppAdInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    orientationErrorCppAdInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::loadModelsIfAvailable(adInterfaces, CppAdInterface::ApproximationOrder::First, verbose);
   }
 }
 
@@ -160,7 +158,7 @@ ad_vector_t PinocchioEndEffectorKinematicsCppAd::getPositionCppAd(PinocchioInter
 /******************************************************************************************************/
 /******************************************************************************************************/
 auto PinocchioEndEffectorKinematicsCppAd::getPosition(const vector_t& state) const -> std::vector<vector3_t> {
-  const vector_t positionValues = positionCppAdInterfacePtr_->getFunctionValue(state);
+  const vector_t& positionValues = positionCppAdInterfacePtr_->getFunctionValue(state, vector_t(0), positionWorkspace_);
 
   std::vector<vector3_t> positions;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -174,8 +172,8 @@ auto PinocchioEndEffectorKinematicsCppAd::getPosition(const vector_t& state) con
 /******************************************************************************************************/
 std::vector<VectorFunctionLinearApproximation> PinocchioEndEffectorKinematicsCppAd::getPositionLinearApproximation(
     const vector_t& state) const {
-  const vector_t positionValues = positionCppAdInterfacePtr_->getFunctionValue(state);
-  const matrix_t positionJacobian = positionCppAdInterfacePtr_->getJacobian(state);
+  const vector_t& positionValues = positionCppAdInterfacePtr_->getFunctionValue(state, vector_t(0), positionWorkspace_);
+  const matrix_t& positionJacobian = positionCppAdInterfacePtr_->getJacobian(state, vector_t(0), positionWorkspace_);
 
   std::vector<VectorFunctionLinearApproximation> positions;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -215,7 +213,7 @@ ad_vector_t PinocchioEndEffectorKinematicsCppAd::getVelocityCppAd(PinocchioInter
 auto PinocchioEndEffectorKinematicsCppAd::getVelocity(const vector_t& state, const vector_t& input) const -> std::vector<vector3_t> {
   vector_t stateInput(state.rows() + input.rows());
   stateInput << state, input;
-  const vector_t velocityValues = velocityCppAdInterfacePtr_->getFunctionValue(stateInput);
+  const vector_t& velocityValues = velocityCppAdInterfacePtr_->getFunctionValue(stateInput, vector_t(0), velocityWorkspace_);
 
   std::vector<vector3_t> velocities;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -231,8 +229,8 @@ std::vector<VectorFunctionLinearApproximation> PinocchioEndEffectorKinematicsCpp
     const vector_t& state, const vector_t& input) const {
   vector_t stateInput(state.rows() + input.rows());
   stateInput << state, input;
-  const vector_t velocityValues = velocityCppAdInterfacePtr_->getFunctionValue(stateInput);
-  const matrix_t velocityJacobian = velocityCppAdInterfacePtr_->getJacobian(stateInput);
+  const vector_t& velocityValues = velocityCppAdInterfacePtr_->getFunctionValue(stateInput, vector_t(0), velocityWorkspace_);
+  const matrix_t& velocityJacobian = velocityCppAdInterfacePtr_->getJacobian(stateInput, vector_t(0), velocityWorkspace_);
 
   std::vector<VectorFunctionLinearApproximation> velocities;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -256,7 +254,7 @@ auto PinocchioEndEffectorKinematicsCppAd::getOrientationError(const vector_t& st
     params.segment<4>(i) = referenceOrientations[i].coeffs();
   }
 
-  const vector_t errorValues = orientationErrorCppAdInterfacePtr_->getFunctionValue(state, params);
+  const vector_t& errorValues = orientationErrorCppAdInterfacePtr_->getFunctionValue(state, params, orientationErrorWorkspace_);
 
   std::vector<vector3_t> errors;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -275,8 +273,8 @@ std::vector<VectorFunctionLinearApproximation> PinocchioEndEffectorKinematicsCpp
     params.segment<4>(i) = referenceOrientations[i].coeffs();
   }
 
-  const vector_t errorValues = orientationErrorCppAdInterfacePtr_->getFunctionValue(state, params);
-  const matrix_t errorJacobian = orientationErrorCppAdInterfacePtr_->getJacobian(state, params);
+  const vector_t& errorValues = orientationErrorCppAdInterfacePtr_->getFunctionValue(state, params, orientationErrorWorkspace_);
+  const matrix_t& errorJacobian = orientationErrorCppAdInterfacePtr_->getJacobian(state, params, orientationErrorWorkspace_);
 
   std::vector<VectorFunctionLinearApproximation> errors;
   for (int i = 0; i < endEffectorIds_.size(); i++) {
@@ -0,0 +1,122 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <pinocchio/fwd.hpp>
+
+#include <pinocchio/algorithm/centroidal.hpp>
+#include <pinocchio/algorithm/frames.hpp>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+
+#include <ocs2_pinocchio_interface/PinocchioPreComputation.h>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PinocchioPreComputation::PinocchioPreComputation(PinocchioInterface pinocchioInterface, const PinocchioStateInputMapping<scalar_t>& mapping,
+                                                 Settings settings)
+    : pinocchioInterface_(std::move(pinocchioInterface)), mappingPtr_(mapping.clone()), settings_(std::move(settings)) {
+  mappingPtr_->setPinocchioInterface(pinocchioInterface_);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PinocchioPreComputation::PinocchioPreComputation(PinocchioInterface pinocchioInterface, const PinocchioStateInputMapping<scalar_t>& mapping)
+    : PinocchioPreComputation(std::move(pinocchioInterface), mapping, Settings()) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PinocchioPreComputation::PinocchioPreComputation(const PinocchioPreComputation& rhs)
+    : PreComputation(rhs), pinocchioInterface_(rhs.pinocchioInterface_), mappingPtr_(rhs.mappingPtr_->clone()), settings_(rhs.settings_) {
+  mappingPtr_->setPinocchioInterface(pinocchioInterface_);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PinocchioPreComputation* PinocchioPreComputation::clone() const {
+  return new PinocchioPreComputation(*this);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioPreComputation::request(RequestSet request, scalar_t t, const vector_t& x, const vector_t& u) {
+  if (request.containsAny(settings_.request)) {
+    updatePinocchioData(request, x);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioPreComputation::requestPreJump(RequestSet request, scalar_t t, const vector_t& x) {
+  if (request.containsAny(settings_.request)) {
+    updatePinocchioData(request, x);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioPreComputation::requestFinal(RequestSet request, scalar_t t, const vector_t& x) {
+  if (request.containsAny(settings_.request)) {
+    updatePinocchioData(request, x);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioPreComputation::updatePinocchioData(RequestSet request, const vector_t& x) {
+  const auto& model = pinocchioInterface_.getModel();
+  auto& data = pinocchioInterface_.getData();
+  const vector_t q = mappingPtr_->getPinocchioJointPosition(x);
+  const bool jointJacobians = settings_.jointJacobians && request.contains(Request::Approximation);
+
+  // a single pass over the kinematic tree which updates the joint placements
+  if (settings_.centroidalMap) {
+    pinocchio::computeCentroidalMap(model, data, q);
+    if (jointJacobians) {
+      pinocchio::computeJointJacobians(model, data);  // reuses the joint placements
+    }
+  } else if (jointJacobians) {
+    pinocchio::computeJointJacobians(model, data, q);
+  } else {
+    pinocchio::forwardKinematics(model, data, q);
+  }
+
+  pinocchio::updateFramePlacements(model, data);
+}
+
+}  // namespace ocs2
@@ -0,0 +1,121 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <pinocchio/fwd.hpp>
+
+#include <pinocchio/algorithm/frames.hpp>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_pinocchio_interface/PinocchioPreComputation.h>
+#include <ocs2_pinocchio_interface/urdf.h>
+
+#include "ManipulatorArmUrdf.h"
+
+namespace {
+
+class IdentityMapping final : public ocs2::PinocchioStateInputMapping<ocs2::scalar_t> {
+ public:
+  IdentityMapping() = default;
+  ~IdentityMapping() override = default;
+  IdentityMapping* clone() const override { return new IdentityMapping(*this); }
+
+  ocs2::vector_t getPinocchioJointPosition(const ocs2::vector_t& state) const override { return state; }
+
+  ocs2::vector_t getPinocchioJointVelocity(const ocs2::vector_t& state, const ocs2::vector_t& input) const override { return input; }
+
+  std::pair<ocs2::matrix_t, ocs2::matrix_t> getOcs2Jacobian(const ocs2::vector_t& state, const ocs2::matrix_t& Jq,
+                                                            const ocs2::matrix_t& Jv) const override {
+    return {Jq, Jv};
+  }
+};
+
+}  // unnamed namespace
+
+class TestPinocchioPreComputation : public ::testing::Test {
+ public:
+  TestPinocchioPreComputation()
+      : pinocchioInterface(ocs2::getPinocchioInterfaceFromUrdfString(manipulatorArmUrdf)), preComputation(pinocchioInterface, mapping) {
+    x.resize(6);
+    x << 2.5, -1.0, 1.5, 0.0, 1.0, 0.0;
+    u.setOnes(6);
+
+    // reference computation
+    const auto& model = pinocchioInterface.getModel();
+    auto& data = pinocchioInterface.getData();
+    pinocchio::forwardKinematics(model, data, x);
+    pinocchio::updateFramePlacements(model, data);
+    pinocchio::computeJointJacobians(model, data);
+    frameId = model.getBodyId("WRIST_2");
+  }
+
+  void compareToReference(const ocs2::PinocchioInterface& cachedInterface, bool withJacobian) const {
+    const auto& model = pinocchioInterface.getModel();
+    const auto& data = pinocchioInterface.getData();
+    const auto& cachedData = cachedInterface.getData();
+    EXPECT_TRUE(cachedData.oMf[frameId].isApprox(data.oMf[frameId]));
+    if (withJacobian) {
+      ocs2::matrix_t J = ocs2::matrix_t::Zero(6, model.nv);
+      ocs2::matrix_t cachedJ = ocs2::matrix_t::Zero(6, model.nv);
+      pinocchio::getFrameJacobian(model, data, frameId, pinocchio::ReferenceFrame::LOCAL_WORLD_ALIGNED, J);
+      pinocchio::getFrameJacobian(model, cachedData, frameId, pinocchio::ReferenceFrame::LOCAL_WORLD_ALIGNED, cachedJ);
+      EXPECT_TRUE(cachedJ.isApprox(J));
+    }
+  }
+
+  ocs2::vector_t x;
+  ocs2::vector_t u;
+  ocs2::PinocchioInterface pinocchioInterface;
+  IdentityMapping mapping;
+  ocs2::PinocchioPreComputation preComputation;
+  size_t frameId;
+};
+
+TEST_F(TestPinocchioPreComputation, value) {
+  preComputation.request(ocs2::Request::Cost + ocs2::Request::Constraint, 0.0, x, u);
+  compareToReference(preComputation.getPinocchioInterface(), false);
+}
+
+TEST_F(TestPinocchioPreComputation, approximation) {
+  preComputation.request(ocs2::Request::Cost + ocs2::Request::Approximation, 0.0, x, u);
+  compareToReference(preComputation.getPinocchioInterface(), true);
+
+  std::unique_ptr<ocs2::PinocchioPreComputation> clonePtr(preComputation.clone());
+  clonePtr->requestFinal(ocs2::Request::SoftConstraint + ocs2::Request::Approximation, 0.0, x);
+  compareToReference(clonePtr->getPinocchioInterface(), true);
+}
+
+TEST_F(TestPinocchioPreComputation, skipsUnrequested) {
+  const ocs2::vector_t xOther = ocs2::vector_t::Zero(6);
+  preComputation.request(ocs2::Request::Cost, 0.0, x, u);
+  preComputation.request(ocs2::Request::Dynamics + ocs2::Request::Approximation, 0.0, xOther, u);
+  compareToReference(preComputation.getPinocchioInterface(), false);
+}
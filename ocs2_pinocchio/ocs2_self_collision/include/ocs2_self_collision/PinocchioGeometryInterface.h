@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <limits>
+#include <memory>
 #include <utility>
 
 #include <ocs2_pinocchio_interface/PinocchioInterface.h>
@@ -40,12 +42,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Forward declaration of pinocchio geometry types */
 namespace pinocchio {
 struct GeometryModel;
+struct GeometryData;
 }  // namespace pinocchio
 
 namespace ocs2 {
 
 class PinocchioGeometryInterface final {
  public:
+  using vector3_t = Eigen::Matrix<scalar_t, 3, 1>;
+
   /**
    * Constructor
    *
@@ -67,15 +72,31 @@ class PinocchioGeometryInterface final {
                              const std::vector<std::pair<std::string, std::string>>& collisionLinkPairs,
                              const std::vector<std::pair<size_t, size_t>>& collisionObjectPairs = std::vector<std::pair<size_t, size_t>>());
 
+  /** Copy constructor, the copy shares the geometry model but has its own geometry data. */
+  PinocchioGeometryInterface(const PinocchioGeometryInterface& rhs);
+
+  /** Move constructor */
+  PinocchioGeometryInterface(PinocchioGeometryInterface&& rhs);
+
+  /** Destructor */
+  ~PinocchioGeometryInterface();
+
   /**
    * Compute collision pair distances
    *
+   * The geometry data is kept between the calls and the GJK algorithm of each pair is warm-started from its previous solution.
+   * Pairs whose bounding spheres are further apart than maxDistance are skipped. Their results are cleared, i.e. their min_distance
+   * is std::numeric_limits<double>::max() and their nearest points are not set.
+   *
    * @note Requires pinocchioInterface with updated joint placements by calling forwardKinematics().
+   * @note The returned reference is valid until the next call. Use a copy of this class per thread.
    *
    * @param [in] pinocchioInterface: pinocchio interface of the robot model
+   * @param [in] maxDistance: Distance above which the exact distance of a pair is not required.
    * @return An array of distances between pairs of collision bodies defined in the constructor.
    */
-  std::vector<hpp::fcl::DistanceResult> computeDistances(const PinocchioInterface& pinocchioInterface) const;
+  const std::vector<hpp::fcl::DistanceResult>& computeDistances(
+      const PinocchioInterface& pinocchioInterface, scalar_t maxDistance = std::numeric_limits<scalar_t>::infinity()) const;
 
   /** Get the number of collision pairs */
   size_t getNumCollisionPairs() const;
@@ -91,8 +112,15 @@ class PinocchioGeometryInterface final {
                                const std::vector<std::pair<size_t, size_t>>& collisionObjectPairs);
   void addCollisionLinkPairs(const PinocchioInterface& pinocchioInterface,
                              const std::vector<std::pair<std::string, std::string>>& collisionLinkPairs);
+  void computeBoundingSpheres();
+  void resetGeometryData() const;
 
   std::shared_ptr<pinocchio::GeometryModel> geometryModelPtr_;
+  mutable std::unique_ptr<pinocchio::GeometryData> geometryDataPtr_;
+
+  // Bounding spheres of the geometry objects for the broad phase, the centers are expressed in the frames of the objects.
+  std::vector<vector3_t> boundingSphereCenters_;
+  std::vector<scalar_t> boundingSphereRadii_;
 };
 
 }  // namespace ocs2
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <limits>
+
 #include <ocs2_pinocchio_interface/PinocchioInterface.h>
 #include <ocs2_self_collision/PinocchioGeometryInterface.h>
 
@@ -43,8 +45,12 @@ class SelfCollision {
    *
    * @param [in] pinocchioGeometryInterface: pinocchio geometry interface of the robot model
    * @parma [in] minimumDistance: minimum allowed distance between each collision pair
+   * @param [in] activationDistance: The distance of a pair is saturated at this value, i.e. the pairs which are further apart have a
+   *                                 constant value and a zero gradient. Their exact distance is not computed if their bounding
+   *                                 spheres are further apart.
    */
-  SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance);
+  SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance,
+                scalar_t activationDistance = std::numeric_limits<scalar_t>::infinity());
 
   /** Get the number of collision pairs */
   size_t getNumCollisionPairs() const { return pinocchioGeometryInterface_.getNumCollisionPairs(); }
@@ -57,7 +63,7 @@ class SelfCollision {
    * @note Requires updated forwardKinematics() on pinocchioInterface.
    *
    * @param [in] pinocchioInterface: pinocchio interface of the robot model
-   * @return: The differences between the distance of each collision pair and the minimum distance
+   * @return: The differences between the (saturated) distance of each collision pair and the minimum distance
    */
   vector_t getValue(const PinocchioInterface& pinocchioInterface) const;
 
@@ -76,6 +82,7 @@ class SelfCollision {
  private:
   PinocchioGeometryInterface pinocchioGeometryInterface_;
   scalar_t minimumDistance_;
+  scalar_t activationDistance_;
 };
 
 }  // namespace ocs2
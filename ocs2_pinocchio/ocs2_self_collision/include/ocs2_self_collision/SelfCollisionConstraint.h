@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <limits>
 #include <memory>
 
 #include <ocs2_core/constraint/StateConstraint.h>
@@ -49,9 +50,10 @@ class SelfCollisionConstraint : public StateConstraint {
    * @param [in] mapping: The pinocchio mapping from pinocchio states to ocs2 states.
    * @param [in] pinocchioGeometryInterface: Pinocchio geometry interface of the robot model.
    * @param [in] minimumDistance: The minimum allowed distance between collision pairs.
+   * @param [in] activationDistance: The distance above which a pair has a constant value and a zero gradient, see SelfCollision.
    */
   SelfCollisionConstraint(const PinocchioStateInputMapping<scalar_t>& mapping, PinocchioGeometryInterface pinocchioGeometryInterface,
-                          scalar_t minimumDistance);
+                          scalar_t minimumDistance, scalar_t activationDistance = std::numeric_limits<scalar_t>::infinity());
 
   ~SelfCollisionConstraint() override = default;
 
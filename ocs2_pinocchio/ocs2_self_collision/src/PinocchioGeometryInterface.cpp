@@ -51,6 +51,7 @@ PinocchioGeometryInterface::PinocchioGeometryInterface(const PinocchioInterface&
   buildGeomFromPinocchioInterface(pinocchioInterface, *geometryModelPtr_);
 
   addCollisionObjectPairs(pinocchioInterface, collisionObjectPairs);
+  computeBoundingSpheres();
 }
 
 PinocchioGeometryInterface::PinocchioGeometryInterface(const PinocchioInterface& pinocchioInterface,
@@ -61,18 +62,79 @@ PinocchioGeometryInterface::PinocchioGeometryInterface(const PinocchioInterface&
 
   addCollisionObjectPairs(pinocchioInterface, collisionObjectPairs);
   addCollisionLinkPairs(pinocchioInterface, collisionLinkPairs);
+  computeBoundingSpheres();
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-std::vector<hpp::fcl::DistanceResult> PinocchioGeometryInterface::computeDistances(const PinocchioInterface& pinocchioInterface) const {
-  pinocchio::GeometryData geometryData(*geometryModelPtr_);
+PinocchioGeometryInterface::PinocchioGeometryInterface(const PinocchioGeometryInterface& rhs)
+    : geometryModelPtr_(rhs.geometryModelPtr_),
+      boundingSphereCenters_(rhs.boundingSphereCenters_),
+      boundingSphereRadii_(rhs.boundingSphereRadii_) {}
 
-  pinocchio::updateGeometryPlacements(pinocchioInterface.getModel(), pinocchioInterface.getData(), *geometryModelPtr_, geometryData);
-  pinocchio::computeDistances(*geometryModelPtr_, geometryData);
+PinocchioGeometryInterface::PinocchioGeometryInterface(PinocchioGeometryInterface&& rhs) = default;
 
-  return std::move(geometryData.distanceResults);
+PinocchioGeometryInterface::~PinocchioGeometryInterface() = default;
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+const std::vector<hpp::fcl::DistanceResult>& PinocchioGeometryInterface::computeDistances(const PinocchioInterface& pinocchioInterface,
+                                                                                         scalar_t maxDistance) const {
+  const auto& geometryModel = *geometryModelPtr_;
+  if (geometryDataPtr_ == nullptr || geometryDataPtr_->distanceResults.size() != geometryModel.collisionPairs.size()) {
+    resetGeometryData();
+  }
+  auto& geometryData = *geometryDataPtr_;
+
+  pinocchio::updateGeometryPlacements(pinocchioInterface.getModel(), pinocchioInterface.getData(), geometryModel, geometryData);
+
+  for (size_t i = 0; i < geometryModel.collisionPairs.size(); ++i) {
+    const size_t first = geometryModel.collisionPairs[i].first;
+    const size_t second = geometryModel.collisionPairs[i].second;
+
+    // broad phase: lower bound of the distance from the bounding spheres
+    if (maxDistance < std::numeric_limits<scalar_t>::infinity()) {
+      const vector3_t center1 = geometryData.oMg[first].act(boundingSphereCenters_[first]);
+      const vector3_t center2 = geometryData.oMg[second].act(boundingSphereCenters_[second]);
+      if ((center2 - center1).norm() - boundingSphereRadii_[first] - boundingSphereRadii_[second] > maxDistance) {
+        geometryData.distanceResults[i].clear();
+        continue;
+      }
+    }
+
+    // narrow phase, warm-started from the previous call
+    pinocchio::computeDistance(geometryModel, geometryData, i);
+    geometryData.distanceRequests[i].updateGuess(geometryData.distanceResults[i]);
+  }
+
+  return geometryData.distanceResults;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioGeometryInterface::resetGeometryData() const {
+  geometryDataPtr_.reset(new pinocchio::GeometryData(*geometryModelPtr_));
+  for (auto& request : geometryDataPtr_->distanceRequests) {
+    request.enable_cached_gjk_guess = true;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PinocchioGeometryInterface::computeBoundingSpheres() {
+  const auto& geometryObjects = geometryModelPtr_->geometryObjects;
+  boundingSphereCenters_.resize(geometryObjects.size());
+  boundingSphereRadii_.resize(geometryObjects.size());
+  for (size_t i = 0; i < geometryObjects.size(); ++i) {
+    auto& geometry = *geometryObjects[i].geometry;
+    geometry.computeLocalAABB();
+    boundingSphereCenters_[i] = geometry.aabb_center;
+    boundingSphereRadii_[i] = geometry.aabb_radius;
+  }
 }
 
 /******************************************************************************************************/
@@ -29,6 +29,8 @@
 
 #include <pinocchio/fwd.hpp>
 
+#include <algorithm>
+
 #include <pinocchio/algorithm/jacobian.hpp>
 #include <pinocchio/multibody/geometry.hpp>
 
@@ -42,18 +44,20 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-SelfCollision::SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance)
-    : pinocchioGeometryInterface_(std::move(pinocchioGeometryInterface)), minimumDistance_(minimumDistance) {}
+SelfCollision::SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance, scalar_t activationDistance)
+    : pinocchioGeometryInterface_(std::move(pinocchioGeometryInterface)),
+      minimumDistance_(minimumDistance),
+      activationDistance_(activationDistance) {}
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t SelfCollision::getValue(const PinocchioInterface& pinocchioInterface) const {
-  const std::vector<hpp::fcl::DistanceResult> distanceArray = pinocchioGeometryInterface_.computeDistances(pinocchioInterface);
+  const auto& distanceArray = pinocchioGeometryInterface_.computeDistances(pinocchioInterface, activationDistance_);
 
   vector_t violations = vector_t::Zero(distanceArray.size());
   for (size_t i = 0; i < distanceArray.size(); ++i) {
-    violations[i] = distanceArray[i].min_distance - minimumDistance_;
+    violations[i] = std::min(distanceArray[i].min_distance, activationDistance_) - minimumDistance_;
   }
 
   return violations;
@@ -63,16 +67,27 @@ vector_t SelfCollision::getValue(const PinocchioInterface& pinocchioInterface) c
 /******************************************************************************************************/
 /******************************************************************************************************/
 std::pair<vector_t, matrix_t> SelfCollision::getLinearApproximation(const PinocchioInterface& pinocchioInterface) const {
-  const std::vector<hpp::fcl::DistanceResult> distanceArray = pinocchioGeometryInterface_.computeDistances(pinocchioInterface);
+  const auto& distanceArray = pinocchioGeometryInterface_.computeDistances(pinocchioInterface, activationDistance_);
 
   const auto& model = pinocchioInterface.getModel();
   const auto& data = pinocchioInterface.getData();
 
   const auto& geometryModel = pinocchioGeometryInterface_.getGeometryModel();
 
+  // Jacobian buffers, shared by all the pairs
+  Eigen::Matrix<scalar_t, 6, Eigen::Dynamic> joint1Jacobian(6, model.nv);
+  Eigen::Matrix<scalar_t, 6, Eigen::Dynamic> joint2Jacobian(6, model.nv);
+  Eigen::Matrix<scalar_t, 3, Eigen::Dynamic> differenceJacobian(3, model.nv);
+
   vector_t f(distanceArray.size());
-  matrix_t dfdq(distanceArray.size(), model.nq);
+  matrix_t dfdq = matrix_t::Zero(distanceArray.size(), model.nq);
   for (size_t i = 0; i < distanceArray.size(); ++i) {
+    // Pairs beyond the activation distance have a constant value
+    if (distanceArray[i].min_distance >= activationDistance_) {
+      f[i] = activationDistance_ - minimumDistance_;
+      continue;
+    }
+
     // Distance violation
     f[i] = distanceArray[i].min_distance - minimumDistance_;
 
@@ -84,23 +99,22 @@ std::pair<vector_t, matrix_t> SelfCollision::getLinearApproximation(const Pinocc
     // We need to get the jacobian of the point on the first object; use the joint jacobian translated to the point
     const vector3_t joint1Position = data.oMi[joint1].translation();
     const vector3_t pt1Offset = distanceArray[i].nearest_points[0] - joint1Position;
-    matrix_t joint1Jacobian = matrix_t::Zero(6, model.nv);
+    joint1Jacobian.setZero();
     pinocchio::getJointJacobian(model, data, joint1, pinocchio::ReferenceFrame::LOCAL_WORLD_ALIGNED, joint1Jacobian);
-    // Jacobians from pinocchio are given as
-    // [ position jacobian ]
-    // [ rotation jacobian ]
-    const matrix_t pt1Jacobian = joint1Jacobian.topRows(3) - skewSymmetricMatrix(pt1Offset) * joint1Jacobian.bottomRows(3);
 
     // We need to get the jacobian of the point on the second object; use the joint jacobian translated to the point
     const vector3_t joint2Position = data.oMi[joint2].translation();
     const vector3_t pt2Offset = distanceArray[i].nearest_points[1] - joint2Position;
-    matrix_t joint2Jacobian = matrix_t::Zero(6, model.nv);
+    joint2Jacobian.setZero();
     pinocchio::getJointJacobian(model, data, joint2, pinocchio::ReferenceFrame::LOCAL_WORLD_ALIGNED, joint2Jacobian);
-    const matrix_t pt2Jacobian = joint2Jacobian.topRows(3) - skewSymmetricMatrix(pt2Offset) * joint2Jacobian.bottomRows(3);
 
     // To get the (approximate) jacobian of the distance, get the difference between the two nearest point jacobians, then multiply by the
-    // vector from point to point
-    const matrix_t differenceJacobian = pt2Jacobian - pt1Jacobian;
+    // vector from point to point. Jacobians from pinocchio are given as
+    // [ position jacobian ]
+    // [ rotation jacobian ]
+    differenceJacobian = joint2Jacobian.topRows<3>() - joint1Jacobian.topRows<3>();
+    differenceJacobian.noalias() -= skewSymmetricMatrix(pt2Offset) * joint2Jacobian.bottomRows<3>();
+    differenceJacobian.noalias() += skewSymmetricMatrix(pt1Offset) * joint1Jacobian.bottomRows<3>();
     // TODO(perry): is there a way to calculate a correct jacobian for the case of distanceVector = 0?
     const vector3_t distanceVector = distanceArray[i].min_distance > 0
                                          ? (distanceArray[i].nearest_points[1] - distanceArray[i].nearest_points[0]).normalized()
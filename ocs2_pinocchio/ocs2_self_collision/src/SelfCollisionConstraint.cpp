@@ -36,9 +36,10 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 SelfCollisionConstraint::SelfCollisionConstraint(const PinocchioStateInputMapping<scalar_t>& mapping,
-                                                 PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance)
+                                                 PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance,
+                                                 scalar_t activationDistance)
     : StateConstraint(ConstraintOrder::Linear),
-      selfCollision_(std::move(pinocchioGeometryInterface), minimumDistance),
+      selfCollision_(std::move(pinocchioGeometryInterface), minimumDistance, activationDistance),
       mappingPtr_(mapping.clone()) {}
 
 /******************************************************************************************************/
@@ -45,6 +45,8 @@ namespace ocs2 {
  * End-effector Kinematics implementation using pinocchio and CppAD.
  *
  * @note See also PinocchioSphereKinematics, which uses analytical computation and caching.
+ * @note The evaluations reuse a mutable CppAdInterface workspace, so the const methods of one instance are not reentrant.
+ * Use one clone per thread.
  */
 class PinocchioSphereKinematicsCppAd final : public EndEffectorKinematics<scalar_t> {
  public:
@@ -113,6 +115,7 @@ class PinocchioSphereKinematicsCppAd final : public EndEffectorKinematics<scalar
                                const std::vector<SphereApproxParam>& sphereApproxParams, const ad_vector_t& state);
 
   std::unique_ptr<CppAdInterface> positionCppAdInterfacePtr_;
+  mutable CppAdInterface::Workspace positionWorkspace_;
 
   PinocchioSphereInterface pinocchioSphereInterface_;
   std::vector<std::string> linkIds_;
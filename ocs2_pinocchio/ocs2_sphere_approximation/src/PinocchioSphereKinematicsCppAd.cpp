@@ -135,7 +135,7 @@ ad_vector_t PinocchioSphereKinematicsCppAd::getPositionCppAd(PinocchioInterfaceC
 /******************************************************************************************************/
 /******************************************************************************************************/
 auto PinocchioSphereKinematicsCppAd::getPosition(const vector_t& state) const -> std::vector<vector3_t> {
-  const vector_t positionValues = positionCppAdInterfacePtr_->getFunctionValue(state);
+  const vector_t& positionValues = positionCppAdInterfacePtr_->getFunctionValue(state, vector_t(0), positionWorkspace_);
 
   std::vector<vector3_t> positions;
   positions.reserve(linkIds_.size());
@@ -149,8 +149,8 @@ auto PinocchioSphereKinematicsCppAd::getPosition(const vector_t& state) const ->
 /******************************************************************************************************/
 /******************************************************************************************************/
 std::vector<VectorFunctionLinearApproximation> PinocchioSphereKinematicsCppAd::getPositionLinearApproximation(const vector_t& state) const {
-  const vector_t positionValues = positionCppAdInterfacePtr_->getFunctionValue(state);
-  const matrix_t positionJacobian = positionCppAdInterfacePtr_->getJacobian(state);
+  const vector_t& positionValues = positionCppAdInterfacePtr_->getFunctionValue(state, vector_t(0), positionWorkspace_);
+  const matrix_t& positionJacobian = positionCppAdInterfacePtr_->getJacobian(state, vector_t(0), positionWorkspace_);
 
   std::vector<VectorFunctionLinearApproximation> positions;
   positions.reserve(linkIds_.size());
@@ -30,13 +30,34 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 #include <ocs2_core/Types.h>
 
+#include "ocs2_python_interface/PythonInterface.h"
+
 using namespace pybind11::literals;
 
+namespace ocs2 {
+namespace python {
+
+/**
+ * Returns a numpy array of shape (batch size, rows, cols) which views a batch of row-major flattened matrices without copying.
+ * The owner is kept alive as long as the view exists.
+ */
+inline pybind11::array_t<scalar_t> batchMatrixView(const batch_matrix_t& batch, Eigen::Index rows, pybind11::handle owner) {
+  const Eigen::Index cols = (rows > 0) ? batch.cols() / rows : 0;
+  const Eigen::Index elementSize = sizeof(scalar_t);
+  return pybind11::array_t<scalar_t>(std::vector<Eigen::Index>{batch.rows(), rows, cols},
+                                     std::vector<Eigen::Index>{batch.cols() * elementSize, cols * elementSize, elementSize}, batch.data(),
+                                     owner);
+}
+
+}  // namespace python
+}  // namespace ocs2
+
 //! convenience macro to bind all kinds of std::vector-like types
 #define VECTOR_TYPE_BINDING(VTYPE, NAME)                                                    \
   pybind11::class_<VTYPE>(m, NAME)                                                          \
@@ -94,6 +115,36 @@ using namespace pybind11::literals;
         .def_readwrite("dfdxx", &ocs2::ScalarFunctionQuadraticApproximation::dfdxx)                                                        \
         .def_readwrite("dfdux", &ocs2::ScalarFunctionQuadraticApproximation::dfdux)                                                        \
         .def_readwrite("dfduu", &ocs2::ScalarFunctionQuadraticApproximation::dfduu);                                                       \
+    /* bind batch approximations, matrices are returned as (batch size, rows, cols) views */                                               \
+    pybind11::class_<ocs2::BatchVectorFunctionLinearApproximation>(m, "BatchVectorFunctionLinearApproximation")                            \
+        .def_readonly("f", &ocs2::BatchVectorFunctionLinearApproximation::f)                                                               \
+        .def_property_readonly("dfdx",                                                                                                     \
+                               [](pybind11::object self) {                                                                                 \
+                                 const auto& batch = self.cast<const ocs2::BatchVectorFunctionLinearApproximation&>();                     \
+                                 return ocs2::python::batchMatrixView(batch.dfdx, batch.f.cols(), self);                                   \
+                               })                                                                                                          \
+        .def_property_readonly("dfdu", [](pybind11::object self) {                                                                         \
+          const auto& batch = self.cast<const ocs2::BatchVectorFunctionLinearApproximation&>();                                            \
+          return ocs2::python::batchMatrixView(batch.dfdu, batch.f.cols(), self);                                                          \
+        });                                                                                                                                \
+    pybind11::class_<ocs2::BatchScalarFunctionQuadraticApproximation>(m, "BatchScalarFunctionQuadraticApproximation")                      \
+        .def_readonly("f", &ocs2::BatchScalarFunctionQuadraticApproximation::f)                                                            \
+        .def_readonly("dfdx", &ocs2::BatchScalarFunctionQuadraticApproximation::dfdx)                                                      \
+        .def_readonly("dfdu", &ocs2::BatchScalarFunctionQuadraticApproximation::dfdu)                                                      \
+        .def_property_readonly("dfdxx",                                                                                                    \
+                               [](pybind11::object self) {                                                                                 \
+                                 const auto& batch = self.cast<const ocs2::BatchScalarFunctionQuadraticApproximation&>();                  \
+                                 return ocs2::python::batchMatrixView(batch.dfdxx, batch.dfdx.cols(), self);                               \
+                               })                                                                                                          \
+        .def_property_readonly("dfdux",                                                                                                    \
+                               [](pybind11::object self) {                                                                                 \
+                                 const auto& batch = self.cast<const ocs2::BatchScalarFunctionQuadraticApproximation&>();                  \
+                                 return ocs2::python::batchMatrixView(batch.dfdux, batch.dfdu.cols(), self);                               \
+                               })                                                                                                          \
+        .def_property_readonly("dfduu", [](pybind11::object self) {                                                                        \
+          const auto& batch = self.cast<const ocs2::BatchScalarFunctionQuadraticApproximation&>();                                         \
+          return ocs2::python::batchMatrixView(batch.dfduu, batch.dfdu.cols(), self);                                                      \
+        });                                                                                                                                \
     /* bind TargetTrajectories class */                                                                                                    \
     pybind11::class_<ocs2::TargetTrajectories>(m, "TargetTrajectories")                                                                    \
         .def(pybind11::init<ocs2::scalar_array_t, ocs2::vector_array_t, ocs2::vector_array_t>());                                          \
@@ -119,6 +170,19 @@ using namespace pybind11::literals;
              "x"_a.noconvert(), "u"_a.noconvert())                                                                                         \
         .def("stateInputEqualityConstraintLagrangian", &PY_INTERFACE::stateInputEqualityConstraintLagrangian, "t"_a, "x"_a.noconvert(),    \
              "u"_a.noconvert())                                                                                                            \
+        /* batch evaluations release the GIL while the samples are evaluated in parallel */                                                \
+        .def("flowMapBatch", &PY_INTERFACE::flowMapBatch, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(),                         \
+             pybind11::call_guard<pybind11::gil_scoped_release>())                                                                         \
+        .def("flowMapLinearApproximationBatch", &PY_INTERFACE::flowMapLinearApproximationBatch, "t"_a.noconvert(), "x"_a.noconvert(),      \
+             "u"_a.noconvert(), pybind11::call_guard<pybind11::gil_scoped_release>())                                                      \
+        .def("costBatch", &PY_INTERFACE::costBatch, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(),                               \
+             pybind11::call_guard<pybind11::gil_scoped_release>())                                                                         \
+        .def("costQuadraticApproximationBatch", &PY_INTERFACE::costQuadraticApproximationBatch, "t"_a.noconvert(), "x"_a.noconvert(),      \
+             "u"_a.noconvert(), pybind11::call_guard<pybind11::gil_scoped_release>())                                                      \
+        .def("stateInputEqualityConstraintBatch", &PY_INTERFACE::stateInputEqualityConstraintBatch, "t"_a.noconvert(), "x"_a.noconvert(),  \
+             "u"_a.noconvert(), pybind11::call_guard<pybind11::gil_scoped_release>())                                                      \
+        .def("stateInputEqualityConstraintLinearApproximationBatch", &PY_INTERFACE::stateInputEqualityConstraintLinearApproximationBatch,  \
+             "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(), pybind11::call_guard<pybind11::gil_scoped_release>())                \
         .def("visualizeTrajectory", &PY_INTERFACE::visualizeTrajectory, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(),           \
              "speed"_a);                                                                                                                   \
   }
@@ -31,12 +31,38 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/dynamics/SystemDynamicsBase.h>
 #include <ocs2_core/penalties/penalties/PenaltyBase.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_robotic_tools/common/RobotInterface.h>
 
 namespace ocs2 {
 
+/** Row-major matrix holding one sample per row. Matches the memory layout of C-contiguous numpy arrays. */
+using batch_matrix_t = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * Linear approximations of a batch of samples. Row i holds sample i, its matrices dfdx and dfdu are flattened in row-major order.
+ */
+struct BatchVectorFunctionLinearApproximation {
+  batch_matrix_t f;
+  batch_matrix_t dfdx;
+  batch_matrix_t dfdu;
+};
+
+/**
+ * Quadratic approximations of a batch of samples. Row i holds sample i, its matrices dfdxx, dfdux and dfduu are flattened in row-major
+ * order.
+ */
+struct BatchScalarFunctionQuadraticApproximation {
+  vector_t f;
+  batch_matrix_t dfdx;
+  batch_matrix_t dfdu;
+  batch_matrix_t dfdxx;
+  batch_matrix_t dfdux;
+  batch_matrix_t dfduu;
+};
+
 /**
  * PythonInterface provides a unified interface for all systems
  * to the MPC_MRT_Interface to be used for Python bindings
@@ -51,8 +77,9 @@ class PythonInterface {
    * @note This should be called from derived class constructor.
    * @param [in] robot: Robot interface.
    * @param [in] mpcPtr: The Python interface takes ownership of the mpcPtr
+   * @param [in] numThreads: Number of threads for the batch evaluations, 0 uses the number of hardware threads.
    */
-  void init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr);
+  void init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr, size_t numThreads = 0);
 
  public:
   /** Destructor */
@@ -169,6 +196,26 @@ class PythonInterface {
    */
   vector_t stateInputEqualityConstraintLagrangian(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u);
 
+  /**
+   * Batch versions of the functions above. The samples are evaluated in parallel.
+   * @param[in] t: Times, size T
+   * @param[in] x: States, size T x stateDim
+   * @param[in] u: Inputs, size T x inputDim
+   * @return The results stacked with one row per sample.
+   */
+  batch_matrix_t flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x, Eigen::Ref<const batch_matrix_t> u);
+  BatchVectorFunctionLinearApproximation flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                                         Eigen::Ref<const batch_matrix_t> u);
+  vector_t costBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x, Eigen::Ref<const batch_matrix_t> u);
+  BatchScalarFunctionQuadraticApproximation costQuadraticApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                            Eigen::Ref<const batch_matrix_t> x,
+                                                                            Eigen::Ref<const batch_matrix_t> u);
+  batch_matrix_t stateInputEqualityConstraintBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                   Eigen::Ref<const batch_matrix_t> u);
+  BatchVectorFunctionLinearApproximation stateInputEqualityConstraintLinearApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                                             Eigen::Ref<const batch_matrix_t> x,
+                                                                                             Eigen::Ref<const batch_matrix_t> u);
+
   /**
    * @brief Visualize the time-state-input trajectory
    * @param[in] t Array of times
@@ -191,8 +238,27 @@ class PythonInterface {
   std::unique_ptr<MPC_BASE> mpcPtr_;
   std::unique_ptr<MPC_MRT_Interface> mpcMrtInterface_;
 
+  /** Point-wise evaluations on a given copy of the optimal control problem */
+  scalar_t evaluateCost(OptimalControlProblem& problem, scalar_t t, const vector_t& x, const vector_t& u);
+  ScalarFunctionQuadraticApproximation evaluateCostQuadraticApproximation(OptimalControlProblem& problem, scalar_t t, const vector_t& x,
+                                                                          const vector_t& u);
+  vector_t evaluateStateInputEqualityConstraint(OptimalControlProblem& problem, scalar_t t, const vector_t& x, const vector_t& u);
+  VectorFunctionLinearApproximation evaluateStateInputEqualityConstraintLinearApproximation(OptimalControlProblem& problem, scalar_t t,
+                                                                                            const vector_t& x, const vector_t& u);
+
+  /** Checks that the sizes of a batch are consistent and returns its number of samples */
+  int checkBatchSize(const Eigen::Ref<const vector_t>& t, const Eigen::Ref<const batch_matrix_t>& x,
+                     const Eigen::Ref<const batch_matrix_t>& u) const;
+
+  /** Runs loopBody(problem, i) for all samples i in parallel, each thread on its own copy of the optimal control problem. */
+  void parallelForSamples(int numSamples, const std::function<void(OptimalControlProblem&, int)>& loopBody);
+
   TargetTrajectories targetTrajectories_;
   OptimalControlProblem problem_;
+
+  // Batch evaluation, one copy of the problem per thread
+  std::unique_ptr<ThreadPool> threadPoolPtr_;
+  std::vector<OptimalControlProblem> batchProblems_;
 };
 
 }  // namespace ocs2
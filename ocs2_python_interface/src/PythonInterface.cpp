@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_python_interface/PythonInterface.h"
 
+#include <algorithm>
+#include <thread>
+
 #include <ocs2_core/misc/LinearAlgebra.h>
 #include <ocs2_core/penalties/MultidimensionalPenalty.h>
 
@@ -39,7 +42,7 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr) {
+void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr, size_t numThreads) {
   if (!mpcPtr) {
     throw std::runtime_error("[PythonInterface] Mpc pointer must be initialized before passing to the Python interface.");
   }
@@ -48,6 +51,15 @@ void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE
   mpcMrtInterface_.reset(new MPC_MRT_Interface(*mpcPtr_));
 
   problem_ = robot.getOptimalControlProblem();
+
+  if (numThreads == 0) {
+    numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  threadPoolPtr_.reset(new ThreadPool(numThreads - 1));
+  batchProblems_.clear();
+  for (size_t i = 0; i < numThreads; i++) {
+    batchProblems_.push_back(problem_);
+  }
 }
 
 /******************************************************************************************************/
@@ -57,6 +69,9 @@ void PythonInterface::reset(TargetTrajectories targetTrajectories) {
   targetTrajectories_ = std::move(targetTrajectories);
   mpcMrtInterface_->resetMpcNode(targetTrajectories_);
   problem_.targetTrajectoriesPtr = &targetTrajectories_;
+  for (auto& problem : batchProblems_) {
+    problem.targetTrajectoriesPtr = &targetTrajectories_;
+  }
 }
 
 /******************************************************************************************************/
@@ -76,6 +91,9 @@ void PythonInterface::setObservation(scalar_t t, Eigen::Ref<const vector_t> x, E
 void PythonInterface::setTargetTrajectories(TargetTrajectories targetTrajectories) {
   targetTrajectories_ = std::move(targetTrajectories);
   problem_.targetTrajectoriesPtr = &targetTrajectories_;
+  for (auto& problem : batchProblems_) {
+    problem.targetTrajectoriesPtr = &targetTrajectories_;
+  }
   mpcMrtInterface_->getReferenceManager().setTargetTrajectories(targetTrajectories_);
 }
 
@@ -124,22 +142,29 @@ VectorFunctionLinearApproximation PythonInterface::flowMapLinearApproximation(sc
 /******************************************************************************************************/
 /******************************************************************************************************/
 scalar_t PythonInterface::cost(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u) {
+  return evaluateCost(problem_, t, x, u);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+scalar_t PythonInterface::evaluateCost(OptimalControlProblem& problem, scalar_t t, const vector_t& x, const vector_t& u) {
   auto request = Request::Cost + Request::Cost + Request::SoftConstraint;
   if (penalty_ != nullptr) {
     request = request + Request::Constraint;
   }
-  auto& preComputation = *problem_.preComputationPtr;
+  auto& preComputation = *problem.preComputationPtr;
   preComputation.request(request, t, x, u);
 
   // get results
-  scalar_t cost = computeCost(problem_, t, x, u);
+  scalar_t cost = computeCost(problem, t, x, u);
 
   if (penalty_ != nullptr) {
-    const auto& targetTrajectories = *problem_.targetTrajectoriesPtr;
-    cost += problem_.equalityLagrangianPtr->getValue(t, x, u, targetTrajectories, preComputation);
-    cost += problem_.stateEqualityLagrangianPtr->getValue(t, x, targetTrajectories, preComputation);
-    cost += problem_.inequalityLagrangianPtr->getValue(t, x, u, targetTrajectories, preComputation);
-    cost += problem_.stateInequalityLagrangianPtr->getValue(t, x, targetTrajectories, preComputation);
+    const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
+    cost += problem.equalityLagrangianPtr->getValue(t, x, u, targetTrajectories, preComputation);
+    cost += problem.stateEqualityLagrangianPtr->getValue(t, x, targetTrajectories, preComputation);
+    cost += problem.inequalityLagrangianPtr->getValue(t, x, u, targetTrajectories, preComputation);
+    cost += problem.stateInequalityLagrangianPtr->getValue(t, x, targetTrajectories, preComputation);
   }
 
   return cost;
@@ -150,36 +175,44 @@ scalar_t PythonInterface::cost(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximation(scalar_t t, Eigen::Ref<const vector_t> x,
                                                                                  Eigen::Ref<const vector_t> u) {
+  return evaluateCostQuadraticApproximation(problem_, t, x, u);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ScalarFunctionQuadraticApproximation PythonInterface::evaluateCostQuadraticApproximation(OptimalControlProblem& problem, scalar_t t,
+                                                                                         const vector_t& x, const vector_t& u) {
   auto request = Request::Cost + Request::Cost + Request::SoftConstraint + Request::Approximation;
   if (penalty_ != nullptr) {
     request = request + Request::Constraint;
   }
-  auto& preComputation = *problem_.preComputationPtr;
+  auto& preComputation = *problem.preComputationPtr;
   preComputation.request(request, t, x, u);
 
   // get results
-  auto cost = approximateCost(problem_, t, x, u);
+  auto cost = approximateCost(problem, t, x, u);
 
   // Lagrangians
   if (penalty_ != nullptr) {
-    const auto& targetTrajectories = *problem_.targetTrajectoriesPtr;
-    if (!problem_.stateEqualityLagrangianPtr->empty()) {
-      auto approx = problem_.stateEqualityLagrangianPtr->getQuadraticApproximation(t, x, targetTrajectories, preComputation);
+    const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
+    if (!problem.stateEqualityLagrangianPtr->empty()) {
+      auto approx = problem.stateEqualityLagrangianPtr->getQuadraticApproximation(t, x, targetTrajectories, preComputation);
       cost.f += approx.f;
       cost.dfdx += approx.dfdx;
       cost.dfdxx += approx.dfdxx;
     }
-    if (!problem_.stateInequalityLagrangianPtr->empty()) {
-      auto approx = problem_.stateInequalityLagrangianPtr->getQuadraticApproximation(t, x, targetTrajectories, preComputation);
+    if (!problem.stateInequalityLagrangianPtr->empty()) {
+      auto approx = problem.stateInequalityLagrangianPtr->getQuadraticApproximation(t, x, targetTrajectories, preComputation);
       cost.f += approx.f;
       cost.dfdx += approx.dfdx;
       cost.dfdxx += approx.dfdxx;
     }
-    if (!problem_.equalityLagrangianPtr->empty()) {
-      cost += problem_.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, targetTrajectories, preComputation);
+    if (!problem.equalityLagrangianPtr->empty()) {
+      cost += problem.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, targetTrajectories, preComputation);
     }
-    if (!problem_.inequalityLagrangianPtr->empty()) {
-      cost += problem_.inequalityLagrangianPtr->getQuadraticApproximation(t, x, u, targetTrajectories, preComputation);
+    if (!problem.inequalityLagrangianPtr->empty()) {
+      cost += problem.inequalityLagrangianPtr->getQuadraticApproximation(t, x, u, targetTrajectories, preComputation);
     }
   }
 
@@ -204,8 +237,16 @@ vector_t PythonInterface::valueFunctionStateDerivative(scalar_t t, Eigen::Ref<co
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t PythonInterface::stateInputEqualityConstraint(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u) {
-  problem_.preComputationPtr->request(Request::Constraint, t, x, u);
-  return problem_.equalityConstraintPtr->getValue(t, x, u, *problem_.preComputationPtr);
+  return evaluateStateInputEqualityConstraint(problem_, t, x, u);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t PythonInterface::evaluateStateInputEqualityConstraint(OptimalControlProblem& problem, scalar_t t, const vector_t& x,
+                                                               const vector_t& u) {
+  problem.preComputationPtr->request(Request::Constraint, t, x, u);
+  return problem.equalityConstraintPtr->getValue(t, x, u, *problem.preComputationPtr);
 }
 
 /******************************************************************************************************/
@@ -213,8 +254,17 @@ vector_t PythonInterface::stateInputEqualityConstraint(scalar_t t, Eigen::Ref<co
 /******************************************************************************************************/
 VectorFunctionLinearApproximation PythonInterface::stateInputEqualityConstraintLinearApproximation(scalar_t t, Eigen::Ref<const vector_t> x,
                                                                                                    Eigen::Ref<const vector_t> u) {
-  problem_.preComputationPtr->request(Request::Constraint + Request::Approximation, t, x, u);
-  return problem_.equalityConstraintPtr->getLinearApproximation(t, x, u, *problem_.preComputationPtr);
+  return evaluateStateInputEqualityConstraintLinearApproximation(problem_, t, x, u);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+VectorFunctionLinearApproximation PythonInterface::evaluateStateInputEqualityConstraintLinearApproximation(OptimalControlProblem& problem,
+                                                                                                           scalar_t t, const vector_t& x,
+                                                                                                           const vector_t& u) {
+  problem.preComputationPtr->request(Request::Constraint + Request::Approximation, t, x, u);
+  return problem.equalityConstraintPtr->getLinearApproximation(t, x, u, *problem.preComputationPtr);
 }
 
 /******************************************************************************************************/
@@ -243,4 +293,151 @@ vector_t PythonInterface::stateInputEqualityConstraintLagrangian(scalar_t t, Eig
   return DmDager.transpose() * (R * DmDager * c - r - B.transpose() * costate);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+batch_matrix_t PythonInterface::flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                             Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  batch_matrix_t dxdt(numSamples, stateDim_);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    dxdt.row(i) = problem.dynamicsPtr->computeFlowMap(t(i), xi, ui).transpose();
+  });
+  return dxdt;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BatchVectorFunctionLinearApproximation PythonInterface::flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                                       Eigen::Ref<const batch_matrix_t> x,
+                                                                                       Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  BatchVectorFunctionLinearApproximation dynamics;
+  dynamics.f.resize(numSamples, stateDim_);
+  dynamics.dfdx.resize(numSamples, stateDim_ * stateDim_);
+  dynamics.dfdu.resize(numSamples, stateDim_ * inputDim_);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    const auto approx = problem.dynamicsPtr->linearApproximation(t(i), xi, ui);
+    dynamics.f.row(i) = approx.f.transpose();
+    Eigen::Map<batch_matrix_t>(dynamics.dfdx.row(i).data(), stateDim_, stateDim_) = approx.dfdx;
+    Eigen::Map<batch_matrix_t>(dynamics.dfdu.row(i).data(), stateDim_, inputDim_) = approx.dfdu;
+  });
+  return dynamics;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t PythonInterface::costBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x, Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  vector_t cost(numSamples);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    cost(i) = evaluateCost(problem, t(i), xi, ui);
+  });
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BatchScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                                          Eigen::Ref<const batch_matrix_t> x,
+                                                                                          Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  BatchScalarFunctionQuadraticApproximation cost;
+  cost.f.resize(numSamples);
+  cost.dfdx.resize(numSamples, stateDim_);
+  cost.dfdu.resize(numSamples, inputDim_);
+  cost.dfdxx.resize(numSamples, stateDim_ * stateDim_);
+  cost.dfdux.resize(numSamples, inputDim_ * stateDim_);
+  cost.dfduu.resize(numSamples, inputDim_ * inputDim_);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    const auto approx = evaluateCostQuadraticApproximation(problem, t(i), xi, ui);
+    cost.f(i) = approx.f;
+    cost.dfdx.row(i) = approx.dfdx.transpose();
+    cost.dfdu.row(i) = approx.dfdu.transpose();
+    Eigen::Map<batch_matrix_t>(cost.dfdxx.row(i).data(), stateDim_, stateDim_) = approx.dfdxx;
+    Eigen::Map<batch_matrix_t>(cost.dfdux.row(i).data(), inputDim_, stateDim_) = approx.dfdux;
+    Eigen::Map<batch_matrix_t>(cost.dfduu.row(i).data(), inputDim_, inputDim_) = approx.dfduu;
+  });
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+batch_matrix_t PythonInterface::stateInputEqualityConstraintBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                                  Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  const int numConstraints = numSamples > 0 ? problem_.equalityConstraintPtr->getNumConstraints(t(0)) : 0;
+  batch_matrix_t constraints(numSamples, numConstraints);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    const vector_t g = evaluateStateInputEqualityConstraint(problem, t(i), xi, ui);
+    if (g.size() != numConstraints) {
+      throw std::runtime_error("[PythonInterface] The number of constraints must be the same for all samples of a batch.");
+    }
+    constraints.row(i) = g.transpose();
+  });
+  return constraints;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BatchVectorFunctionLinearApproximation PythonInterface::stateInputEqualityConstraintLinearApproximationBatch(
+    Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x, Eigen::Ref<const batch_matrix_t> u) {
+  const int numSamples = checkBatchSize(t, x, u);
+  const int numConstraints = numSamples > 0 ? problem_.equalityConstraintPtr->getNumConstraints(t(0)) : 0;
+  BatchVectorFunctionLinearApproximation constraints;
+  constraints.f.resize(numSamples, numConstraints);
+  constraints.dfdx.resize(numSamples, numConstraints * stateDim_);
+  constraints.dfdu.resize(numSamples, numConstraints * inputDim_);
+  parallelForSamples(numSamples, [&](OptimalControlProblem& problem, int i) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+    const auto approx = evaluateStateInputEqualityConstraintLinearApproximation(problem, t(i), xi, ui);
+    if (approx.f.size() != numConstraints) {
+      throw std::runtime_error("[PythonInterface] The number of constraints must be the same for all samples of a batch.");
+    }
+    constraints.f.row(i) = approx.f.transpose();
+    Eigen::Map<batch_matrix_t>(constraints.dfdx.row(i).data(), numConstraints, stateDim_) = approx.dfdx;
+    Eigen::Map<batch_matrix_t>(constraints.dfdu.row(i).data(), numConstraints, inputDim_) = approx.dfdu;
+  });
+  return constraints;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+int PythonInterface::checkBatchSize(const Eigen::Ref<const vector_t>& t, const Eigen::Ref<const batch_matrix_t>& x,
+                                    const Eigen::Ref<const batch_matrix_t>& u) const {
+  if (x.rows() != t.size() || u.rows() != t.size()) {
+    throw std::runtime_error("[PythonInterface] t, x and u must contain the same number of samples.");
+  }
+  if (x.cols() != stateDim_ || u.cols() != inputDim_) {
+    throw std::runtime_error("[PythonInterface] The columns of x and u must match the state and input dimensions.");
+  }
+  return static_cast<int>(t.size());
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PythonInterface::parallelForSamples(int numSamples, const std::function<void(OptimalControlProblem&, int)>& loopBody) {
+  // Keep several samples per chunk, a single evaluation is often too cheap to be scheduled on its own
+  const int grainSize = std::max(numSamples / (8 * static_cast<int>(batchProblems_.size())), 1);
+  threadPoolPtr_->parallelFor(0, numSamples, grainSize, [&](int workerId, int i) { loopBody(batchProblems_[workerId], i); });
+}
+
 }  // namespace ocs2
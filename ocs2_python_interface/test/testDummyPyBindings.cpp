@@ -60,7 +60,9 @@ class DummyPyBindings final : public PythonInterface {
 
   DummyPyBindings() {
     DummyInterface robot;
-    PythonInterface::init(robot, robot.getMpc());
+    PythonInterface::init(robot, robot.getMpc(), 3);
+    stateDim_ = 2;
+    inputDim_ = 1;
   }
 };
 
@@ -70,3 +72,45 @@ class DummyPyBindings final : public PythonInterface {
 TEST(OCS2PyBindingsTest, createDummyPyBindings) {
   ocs2::pybindings_test::DummyPyBindings dummy;
 }
+
+TEST(OCS2PyBindingsTest, batchEvaluation) {
+  using ocs2::batch_matrix_t;
+  using ocs2::vector_t;
+
+  ocs2::pybindings_test::DummyPyBindings dummy;
+  dummy.reset(ocs2::TargetTrajectories({0.0}, {vector_t::Ones(2)}, {vector_t::Zero(1)}));
+
+  const int numSamples = 50;
+  const vector_t t = vector_t::LinSpaced(numSamples, 0.0, 1.0);
+  const batch_matrix_t x = batch_matrix_t::Random(numSamples, 2);
+  const batch_matrix_t u = batch_matrix_t::Random(numSamples, 1);
+
+  const batch_matrix_t dxdt = dummy.flowMapBatch(t, x, u);
+  const auto dynamics = dummy.flowMapLinearApproximationBatch(t, x, u);
+  const vector_t cost = dummy.costBatch(t, x, u);
+  const auto costApproximation = dummy.costQuadraticApproximationBatch(t, x, u);
+
+  for (int i = 0; i < numSamples; i++) {
+    const vector_t xi = x.row(i).transpose();
+    const vector_t ui = u.row(i).transpose();
+
+    EXPECT_TRUE(dxdt.row(i).transpose().isApprox(dummy.flowMap(t(i), xi, ui)));
+
+    const auto dynamics_check = dummy.flowMapLinearApproximation(t(i), xi, ui);
+    EXPECT_TRUE(dynamics.f.row(i).transpose().isApprox(dynamics_check.f));
+    EXPECT_TRUE(Eigen::Map<const batch_matrix_t>(dynamics.dfdx.row(i).data(), 2, 2).isApprox(dynamics_check.dfdx));
+    EXPECT_TRUE(Eigen::Map<const batch_matrix_t>(dynamics.dfdu.row(i).data(), 2, 1).isApprox(dynamics_check.dfdu));
+
+    EXPECT_DOUBLE_EQ(cost(i), dummy.cost(t(i), xi, ui));
+
+    const auto cost_check = dummy.costQuadraticApproximation(t(i), xi, ui);
+    EXPECT_DOUBLE_EQ(costApproximation.f(i), cost_check.f);
+    EXPECT_TRUE(costApproximation.dfdx.row(i).transpose().isApprox(cost_check.dfdx));
+    EXPECT_TRUE(costApproximation.dfdu.row(i).transpose().isApprox(cost_check.dfdu));
+    EXPECT_TRUE(Eigen::Map<const batch_matrix_t>(costApproximation.dfdxx.row(i).data(), 2, 2).isApprox(cost_check.dfdxx));
+    EXPECT_TRUE(Eigen::Map<const batch_matrix_t>(costApproximation.dfduu.row(i).data(), 1, 1).isApprox(cost_check.dfduu));
+  }
+
+  // Inconsistent batch sizes are rejected
+  EXPECT_THROW(dummy.flowMapBatch(t.head(numSamples - 1), x, u), std::runtime_error);
+}
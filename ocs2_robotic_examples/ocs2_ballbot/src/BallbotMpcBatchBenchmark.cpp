@@ -0,0 +1,103 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <ocs2_ddp/GaussNewtonDDP_MPC.h>
+#include <ocs2_mpc/MpcBatch.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_ballbot/BallbotInterface.h"
+#include "ocs2_ballbot/package_path.h"
+
+using namespace ocs2;
+
+/**
+ * Reports the throughput of MpcBatch for the ballbot for 1 to 256 instances.
+ * usage: ballbot_mpc_batch_benchmark [numThreads]
+ */
+int main(int argc, char** argv) {
+  const std::string taskFile = ballbot::getPath() + "/config/mpc/task.info";
+  const std::string libFolder = ballbot::getPath() + "/auto_generated";
+  ballbot::BallbotInterface ballbotInterface(taskFile, libFolder);
+
+  // The instances are solved in parallel, each solver runs single-threaded
+  auto ddpSettings = ballbotInterface.ddpSettings();
+  ddpSettings.nThreads_ = 1;
+  ddpSettings.displayInfo_ = false;
+  ddpSettings.displayShortSummary_ = false;
+  auto mpcSettings = ballbotInterface.mpcSettings();
+  mpcSettings.debugPrint_ = false;
+
+  const vector_t initState = ballbotInterface.getInitialState();
+  const TargetTrajectories targetTrajectories({0.0}, {initState}, {vector_t::Zero(ballbot::INPUT_DIM)});
+
+  // All instances share the models of one interface
+  auto mpcFactory = [&](size_t) {
+    std::unique_ptr<GaussNewtonDDP_MPC> mpcPtr(new GaussNewtonDDP_MPC(mpcSettings, ddpSettings, ballbotInterface.getRollout(),
+                                                                      ballbotInterface.getOptimalControlProblem(),
+                                                                      ballbotInterface.getInitializer()));
+    mpcPtr->getSolverPtr()->setReferenceManager(std::make_shared<ReferenceManager>(targetTrajectories));
+    return std::unique_ptr<MPC_BASE>(std::move(mpcPtr));
+  };
+
+  const size_t numThreads = (argc > 1) ? std::max(std::stoi(argv[1]), 1) : std::max(std::thread::hardware_concurrency(), 1U);
+  const int numRuns = 5;
+  const scalar_t dt = 0.01;
+  for (size_t numInstances = 1; numInstances <= 256; numInstances *= 4) {
+    MpcBatch mpcBatch(numInstances, mpcFactory, numThreads);
+
+    // Perturb the initial state of each instance
+    std::vector<SystemObservation> observations(numInstances);
+    for (auto& observation : observations) {
+      observation.state = initState + 0.1 * vector_t::Random(ballbot::STATE_DIM);
+      observation.input = vector_t::Zero(ballbot::INPUT_DIM);
+    }
+
+    std::vector<PrimalSolution> primalSolutions;
+    size_t numSolves = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < numRuns; run++) {
+      for (auto& observation : observations) {
+        observation.time = run * dt;
+      }
+      numSolves += mpcBatch.run(observations, primalSolutions);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const scalar_t duration = std::chrono::duration<scalar_t>(end - start).count();
+    std::cerr << "[MpcBatchBenchmark] " << numInstances << " instances on " << numThreads << " threads: " << numSolves / duration
+              << " solves per second\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_ddp/GaussNewtonDDP_MPC.h>
+#include <ocs2_mpc/MpcBatch.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include <ocs2_ballbot/BallbotInterface.h>
+#include <ocs2_ballbot/package_path.h>
+
+using namespace ocs2;
+
+TEST(Ballbot, MpcBatchCompareWithSingleInstance) {
+  const std::string taskFile = ballbot::getPath() + "/config/mpc/task.info";
+  const std::string libFolder = ballbot::getPath() + "/auto_generated";
+  ballbot::BallbotInterface ballbotInterface(taskFile, libFolder);
+
+  auto ddpSettings = ballbotInterface.ddpSettings();
+  ddpSettings.nThreads_ = 1;
+  ddpSettings.displayInfo_ = false;
+  ddpSettings.displayShortSummary_ = false;
+  auto mpcSettings = ballbotInterface.mpcSettings();
+  mpcSettings.debugPrint_ = false;
+
+  const vector_t initState = ballbotInterface.getInitialState();
+  const TargetTrajectories targetTrajectories({0.0}, {initState}, {vector_t::Zero(ballbot::INPUT_DIM)});
+
+  auto createMpc = [&]() {
+    std::unique_ptr<GaussNewtonDDP_MPC> mpcPtr(new GaussNewtonDDP_MPC(mpcSettings, ddpSettings, ballbotInterface.getRollout(),
+                                                                      ballbotInterface.getOptimalControlProblem(),
+                                                                      ballbotInterface.getInitializer()));
+    mpcPtr->getSolverPtr()->setReferenceManager(std::make_shared<ReferenceManager>(targetTrajectories));
+    return std::unique_ptr<MPC_BASE>(std::move(mpcPtr));
+  };
+
+  const size_t numInstances = 4;
+  const size_t numThreads = 2;
+  const int numRuns = 3;
+  const scalar_t dt = 0.01;
+  MpcBatch mpcBatch(numInstances, [&](size_t) { return createMpc(); }, numThreads);
+
+  std::vector<SystemObservation> observations(numInstances);
+  for (auto& observation : observations) {
+    observation.state = initState + 0.1 * vector_t::Random(ballbot::STATE_DIM);
+    observation.input = vector_t::Zero(ballbot::INPUT_DIM);
+  }
+
+  std::vector<PrimalSolution> primalSolutions;
+  for (int run = 0; run < numRuns; run++) {
+    for (auto& observation : observations) {
+      observation.time = run * dt;
+    }
+    ASSERT_EQ(mpcBatch.run(observations, primalSolutions), numInstances);
+  }
+
+  // Each instance is solved as if it was run alone
+  const scalar_t finalTime = (numRuns - 1) * dt + mpcSettings.solutionTimeWindow_;
+  for (size_t i = 0; i < numInstances; i++) {
+    auto mpcPtr = createMpc();
+    for (int run = 0; run < numRuns; run++) {
+      ASSERT_TRUE(mpcPtr->run(run * dt, observations[i].state));
+    }
+    PrimalSolution primalSolution;
+    mpcPtr->getSolverPtr()->getPrimalSolution(finalTime, &primalSolution);
+
+    ASSERT_EQ(primalSolutions[i].timeTrajectory_.size(), primalSolution.timeTrajectory_.size());
+    for (size_t k = 0; k < primalSolution.timeTrajectory_.size(); k++) {
+      EXPECT_DOUBLE_EQ(primalSolutions[i].timeTrajectory_[k], primalSolution.timeTrajectory_[k]);
+      EXPECT_TRUE(primalSolutions[i].stateTrajectory_[k].isApprox(primalSolution.stateTrajectory_[k]));
+      EXPECT_TRUE(primalSolutions[i].inputTrajectory_[k].isApprox(primalSolution.inputTrajectory_[k]));
+    }
+  }
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <iostream>
+#include <memory>
+
+#include <ocs2_ddp/ILQR.h>
+#include <ocs2_ddp/SLQ.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_cartpole/CartPoleInterface.h"
+#include "ocs2_cartpole/package_path.h"
+
+using namespace ocs2;
+
+/**
+ * Compares the fixed-size and the dynamic-size Riccati kernels on the cartpole for SLQ and ILQR.
+ * usage: cartpole_riccati_benchmark
+ */
+int main() {
+  const std::string taskFile = cartpole::getPath() + "/config/mpc/task.info";
+  const std::string libFolder = cartpole::getPath() + "/auto_generated";
+  cartpole::CartPoleInterface cartPoleInterface(taskFile, libFolder);
+
+  const vector_t initState = cartPoleInterface.getInitialState();
+  const TargetTrajectories targetTrajectories({0.0}, {cartPoleInterface.getInitialTarget()}, {vector_t::Zero(cartpole::INPUT_DIM)});
+
+  const int numRuns = 20;
+  const scalar_t finalTime = 2.0;
+  for (const auto algorithm : {ddp::Algorithm::SLQ, ddp::Algorithm::ILQR}) {
+    for (const bool useFixedSizeKernels : {true, false}) {
+      auto ddpSettings = cartPoleInterface.ddpSettings();
+      ddpSettings.algorithm_ = algorithm;
+      ddpSettings.useFixedSizeRiccatiKernels_ = useFixedSizeKernels;
+      ddpSettings.displayInfo_ = false;
+      ddpSettings.displayShortSummary_ = false;
+
+      std::unique_ptr<GaussNewtonDDP> solverPtr;
+      if (algorithm == ddp::Algorithm::SLQ) {
+        solverPtr.reset(new SLQ(ddpSettings, cartPoleInterface.getRollout(), cartPoleInterface.getOptimalControlProblem(),
+                                cartPoleInterface.getInitializer()));
+      } else {
+        solverPtr.reset(new ILQR(ddpSettings, cartPoleInterface.getRollout(), cartPoleInterface.getOptimalControlProblem(),
+                                 cartPoleInterface.getInitializer()));
+      }
+      solverPtr->setReferenceManager(std::make_shared<ReferenceManager>(targetTrajectories));
+
+      // The timers accumulate over the runs, each run is warm started from the previous one
+      for (int run = 0; run < numRuns; run++) {
+        solverPtr->run(0.0, initState, finalTime);
+      }
+
+      std::cerr << "\n[CartPoleRiccatiBenchmark] " << ddp::toAlgorithmName(algorithm) << " with "
+                << (useFixedSizeKernels ? "fixed-size" : "dynamic-size") << " Riccati kernels:";
+      std::cerr << solverPtr->getBenchmarkingInfo() << "\n";
+    }
+  }
+
+  return 0;
+}
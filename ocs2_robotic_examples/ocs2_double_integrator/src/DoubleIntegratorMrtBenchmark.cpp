@@ -0,0 +1,143 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/thread_support/ExecuteAndSleep.h>
+#include <ocs2_ddp/GaussNewtonDDP_MPC.h>
+#include <ocs2_mpc/MPC_MRT_Interface.h>
+
+#include "ocs2_double_integrator/DoubleIntegratorInterface.h"
+#include "ocs2_double_integrator/package_path.h"
+
+using namespace ocs2;
+using namespace double_integrator;
+
+/**
+ * Runs the MRT loop at 1 kHz against a free-running MPC thread and reports the latency of updatePolicy() and the jitter of the loop
+ * period.
+ * usage: double_integrator_mrt_benchmark
+ */
+int main() {
+  const std::string taskFile = double_integrator::getPath() + "/config/mpc/task.info";
+  const std::string libFolder = double_integrator::getPath() + "/auto_generated";
+  DoubleIntegratorInterface interface(taskFile, libFolder, false);
+
+  const TargetTrajectories targetTrajectories({0.0}, {interface.getInitialTarget()}, {vector_t::Zero(INPUT_DIM)});
+  interface.getReferenceManagerPtr()->setTargetTrajectories(targetTrajectories);
+
+  GaussNewtonDDP_MPC mpc(interface.mpcSettings(), interface.ddpSettings(), interface.getRollout(), interface.getOptimalControlProblem(),
+                         interface.getInitializer());
+  mpc.getSolverPtr()->setReferenceManager(interface.getReferenceManagerPtr());
+  MPC_MRT_Interface mpcInterface(mpc);
+
+  const scalar_t f_mrt = 1000.0;
+  const size_t numMrtLoops = 5000;
+
+  SystemObservation observation;
+  observation.time = 0.0;
+  observation.state = interface.getInitialState();
+  observation.input.setZero(INPUT_DIM);
+
+  // Wait for the first policy
+  mpcInterface.setCurrentObservation(observation);
+  while (!mpcInterface.initialPolicyReceived()) {
+    mpcInterface.advanceMpc();
+  }
+
+  // Run MPC in a thread as fast as possible
+  std::atomic_bool mpcRunning{true};
+  std::thread mpcThread([&]() {
+    while (mpcRunning) {
+      mpcInterface.advanceMpc();
+    }
+  });
+
+  using clock = std::chrono::steady_clock;
+  benchmark::RepeatedTimer updatePolicyTimer;
+  std::vector<scalar_t> periods;  // [ms]
+  periods.reserve(numMrtLoops);
+  size_t numPolicyUpdates = 0;
+  auto loopStart = clock::now();
+  for (size_t i = 0; i < numMrtLoops; i++) {
+    const auto now = clock::now();
+    if (i > 0) {
+      periods.push_back(std::chrono::duration<scalar_t, std::milli>(now - loopStart).count());
+    }
+    loopStart = now;
+
+    executeAndSleep(
+        [&]() {
+          observation.time += 1.0 / f_mrt;
+
+          updatePolicyTimer.startTimer();
+          if (mpcInterface.updatePolicy()) {
+            ++numPolicyUpdates;
+          }
+          updatePolicyTimer.endTimer();
+
+          mpcInterface.evaluatePolicy(observation.time, vector_t::Zero(STATE_DIM), observation.state, observation.input, observation.mode);
+          mpcInterface.setCurrentObservation(observation);
+        },
+        f_mrt);
+  }
+
+  mpcRunning = false;
+  mpcThread.join();
+
+  // Jitter is the deviation of the loop period from the nominal period
+  const scalar_t nominalPeriod = 1000.0 / f_mrt;
+  scalar_t meanPeriod = 0.0;
+  scalar_t maxJitter = 0.0;
+  for (const auto period : periods) {
+    meanPeriod += period / periods.size();
+    maxJitter = std::max(maxJitter, std::abs(period - nominalPeriod));
+  }
+  scalar_t stdPeriod = 0.0;
+  for (const auto period : periods) {
+    stdPeriod += (period - meanPeriod) * (period - meanPeriod) / periods.size();
+  }
+  stdPeriod = std::sqrt(stdPeriod);
+
+  std::cerr << "\n[DoubleIntegratorMrtBenchmark] " << numMrtLoops << " MRT loops at " << f_mrt << " [Hz], " << numPolicyUpdates
+            << " policy updates\n";
+  std::cerr << "updatePolicy  average: " << 1000.0 * updatePolicyTimer.getAverageInMilliseconds()
+            << " [us], max: " << 1000.0 * updatePolicyTimer.getMaxIntervalInMilliseconds() << " [us]\n";
+  std::cerr << "loop period   average: " << meanPeriod << " [ms], standard deviation: " << 1000.0 * stdPeriod
+            << " [us], max jitter: " << 1000.0 * maxJitter << " [us]\n";
+
+  return 0;
+}
@@ -27,7 +27,11 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  ******************************************************************************/
 
+#include <unistd.h>
+
+#include <chrono>
 #include <cmath>
+#include <limits>
 
 #include <gtest/gtest.h>
 
@@ -37,6 +41,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/thread_support/ExecuteAndSleep.h>
 #include <ocs2_ddp/GaussNewtonDDP_MPC.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
+#include <ocs2_mpc/MPC_SharedMemory_Interface.h>
+#include <ocs2_mpc/MRT_SharedMemory_Interface.h>
 
 using namespace ocs2;
 using namespace double_integrator;
@@ -207,3 +213,138 @@ TEST_F(DoubleIntegratorIntegrationTest, asynchronousTracking) {
 
   ASSERT_NEAR(observation.state(0), goalState(0), tolerance);
 }
+
+TEST_F(DoubleIntegratorIntegrationTest, asynchronousPolicyHandover) {
+  auto mpcPtr = getMpc(true);
+  MPC_MRT_Interface mpcInterface(*mpcPtr);
+
+  const scalar_t f_mrt = 1000;
+  const size_t numMrtLoops = 1000;
+
+  SystemObservation observation;
+  observation.time = initTime;
+  observation.state = initState;
+  observation.input.setZero(INPUT_DIM);
+
+  // Wait for the first policy
+  mpcInterface.setCurrentObservation(observation);
+  while (!mpcInterface.initialPolicyReceived()) {
+    mpcInterface.advanceMpc();
+  }
+
+  // Run MPC in a thread as fast as possible to stress the policy handoff
+  std::atomic_bool mpcRunning{true};
+  auto mpcThread = std::thread([&]() {
+    while (mpcRunning) {
+      try {
+        mpcInterface.advanceMpc();
+      } catch (const std::exception& e) {
+        mpcRunning = false;
+        std::cerr << "EXCEPTION " << e.what() << std::endl;
+        EXPECT_TRUE(false);
+      }
+    }
+  });
+
+  scalar_t latestMpcInitTime = -std::numeric_limits<scalar_t>::infinity();
+  size_t numPolicyUpdates = 0;
+  for (size_t i = 0; i < numMrtLoops; i++) {
+    ocs2::executeAndSleep(
+        [&]() {
+          observation.time += 1.0 / f_mrt;
+
+          if (mpcInterface.updatePolicy()) {
+            ++numPolicyUpdates;
+            const auto& command = mpcInterface.getCommand();
+            const auto& policy = mpcInterface.getPolicy();
+
+            // policies are never handed over out of order
+            EXPECT_GE(command.mpcInitObservation_.time, latestMpcInitTime);
+            latestMpcInitTime = command.mpcInitObservation_.time;
+
+            // the command and the policy belong to the same MPC iteration
+            EXPECT_NEAR(policy.timeTrajectory_.front(), command.mpcInitObservation_.time, 1e-6);
+            EXPECT_TRUE(policy.stateTrajectory_.front().isApprox(command.mpcInitObservation_.state));
+            EXPECT_EQ(policy.timeTrajectory_.size(), policy.stateTrajectory_.size());
+            EXPECT_EQ(policy.timeTrajectory_.size(), policy.inputTrajectory_.size());
+          }
+
+          // Evaluate the policy
+          mpcInterface.evaluatePolicy(observation.time, vector_t::Zero(STATE_DIM), observation.state, observation.input, observation.mode);
+
+          // use optimal state for the next observation:
+          mpcInterface.setCurrentObservation(observation);
+        },
+        f_mrt);
+  }
+
+  mpcRunning = false;
+  if (mpcThread.joinable()) {
+    mpcThread.join();
+  }
+  EXPECT_GT(numPolicyUpdates, 0);
+
+  // a reset drops the published policy, and the in-use policy with the next update
+  mpcInterface.reset();
+  EXPECT_FALSE(mpcInterface.initialPolicyReceived());
+  EXPECT_NO_THROW(mpcInterface.getPolicy());
+  EXPECT_FALSE(mpcInterface.updatePolicy());
+  EXPECT_ANY_THROW(mpcInterface.getPolicy());
+}
+
+TEST_F(DoubleIntegratorIntegrationTest, sharedMemoryTracking) {
+  auto mpcPtr = getMpc(true);
+  const std::string topicPrefix = "double_integrator_test_" + std::to_string(getpid());
+  MPC_SharedMemory_Interface mpcInterface(*mpcPtr, topicPrefix);
+  MRT_SharedMemory_Interface mrtInterface(topicPrefix);
+
+  const scalar_t f_mrt = 100;
+
+  // Run MPC in a thread, in practice it runs in another process
+  auto mpcThread = std::thread([&]() {
+    try {
+      mpcInterface.spin();
+    } catch (const std::exception& e) {
+      std::cerr << "EXCEPTION " << e.what() << std::endl;
+      EXPECT_TRUE(false);
+    }
+  });
+
+  mrtInterface.resetMpcNode(TargetTrajectories({initTime}, {goalState}, {vector_t::Zero(INPUT_DIM)}));
+
+  SystemObservation observation;
+  observation.time = initTime;
+  observation.state = initState;
+  observation.input.setZero(INPUT_DIM);
+
+  // Wait for the first policy
+  mrtInterface.setCurrentObservation(observation);
+  while (!mrtInterface.initialPolicyReceived()) {
+    mrtInterface.spinMRT();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // run MRT
+  while (observation.time < finalTime) {
+    ocs2::executeAndSleep(
+        [&]() {
+          observation.time += 1.0 / f_mrt;
+
+          // Evaluate the policy
+          mrtInterface.spinMRT();
+          mrtInterface.updatePolicy();
+          mrtInterface.evaluatePolicy(observation.time, vector_t::Zero(STATE_DIM), observation.state, observation.input, observation.mode);
+
+          // use optimal state for the next observation:
+          mrtInterface.setCurrentObservation(observation);
+        },
+        f_mrt);
+  }
+
+  mpcInterface.shutdown();
+  if (mpcThread.joinable()) {
+    mpcThread.join();
+  }
+
+  ASSERT_NEAR(observation.state(0), goalState(0), tolerance);
+}
@@ -0,0 +1,53 @@
+# Compares the batch evaluation of the python interface with the per-sample evaluation.
+# This is a benchmark, not run as part of the tests.
+import numpy as np
+import os
+import timeit
+
+import rospkg
+
+from ocs2_double_integrator import mpc_interface
+from ocs2_double_integrator import (
+    scalar_array,
+    vector_array,
+    TargetTrajectories,
+)
+
+
+def main():
+    packageDir = rospkg.RosPack().get_path('ocs2_double_integrator')
+    taskFile = os.path.join(packageDir, 'config/mpc/task.info')
+    libFolder = os.path.join(packageDir, 'auto_generated')
+    mpc = mpc_interface(taskFile, libFolder)
+    stateDim = 2
+    inputDim = 1
+
+    desiredTimeTraj = scalar_array()
+    desiredTimeTraj.push_back(2.0)
+    desiredInputTraj = vector_array()
+    desiredInputTraj.push_back(np.zeros(inputDim))
+    desiredStateTraj = vector_array()
+    desiredStateTraj.push_back(np.zeros(stateDim))
+    mpc.reset(TargetTrajectories(desiredTimeTraj, desiredStateTraj, desiredInputTraj))
+
+    for numSamples in [100, 1000, 10000]:
+        t = np.linspace(0.0, 1.0, numSamples)
+        x = np.random.rand(numSamples, stateDim)
+        u = np.random.rand(numSamples, inputDim)
+
+        def perSample():
+            for i in range(numSamples):
+                mpc.flowMapLinearApproximation(t[i], x[i], u[i])
+                mpc.costQuadraticApproximation(t[i], x[i], u[i])
+
+        def batch():
+            mpc.flowMapLinearApproximationBatch(t, x, u)
+            mpc.costQuadraticApproximationBatch(t, x, u)
+
+        perSampleTime = min(timeit.repeat(perSample, number=1, repeat=3))
+        batchTime = min(timeit.repeat(batch, number=1, repeat=3))
+        print("{} samples: per-sample {:.4f} [s], batch {:.4f} [s]".format(numSamples, perSampleTime, batchTime))
+
+
+if __name__ == "__main__":
+    main()
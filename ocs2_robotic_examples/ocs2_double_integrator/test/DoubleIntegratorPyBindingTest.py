@@ -75,6 +75,35 @@ class double_integrator_python_tests(unittest.TestCase):
         print("dLdx", L.dfdx)
         print("dLdu", L.dfdu)
 
+    def test_batch_evaluation(self):
+        numSamples = 10000
+        t = np.linspace(0.0, 1.0, numSamples)
+        x = np.random.rand(numSamples, self.stateDim)
+        u = np.random.rand(numSamples, self.inputDim)
+
+        desiredTimeTraj = scalar_array()
+        desiredTimeTraj.push_back(2.0)
+        desiredInputTraj = vector_array()
+        desiredInputTraj.push_back(np.zeros(self.inputDim))
+        desiredStateTraj = vector_array()
+        desiredStateTraj.push_back(np.zeros(self.stateDim))
+        self.mpc.reset(TargetTrajectories(desiredTimeTraj, desiredStateTraj, desiredInputTraj))
+
+        print("\n### Comparing the batch evaluation with the per-sample evaluation")
+        dxdt = self.mpc.flowMapBatch(t, x, u)
+        dynamics = self.mpc.flowMapLinearApproximationBatch(t, x, u)
+        cost = self.mpc.costBatch(t, x, u)
+        costApproximation = self.mpc.costQuadraticApproximationBatch(t, x, u)
+        for i in range(0, numSamples, 100):
+            np.testing.assert_allclose(dxdt[i], self.mpc.flowMap(t[i], x[i], u[i]))
+            dynamics_check = self.mpc.flowMapLinearApproximation(t[i], x[i], u[i])
+            np.testing.assert_allclose(dynamics.dfdx[i], dynamics_check.dfdx)
+            np.testing.assert_allclose(dynamics.dfdu[i], dynamics_check.dfdu)
+            self.assertAlmostEqual(cost[i], self.mpc.cost(t[i], x[i], u[i]))
+            costApproximation_check = self.mpc.costQuadraticApproximation(t[i], x[i], u[i])
+            np.testing.assert_allclose(costApproximation.dfdxx[i], costApproximation_check.dfdxx)
+            np.testing.assert_allclose(costApproximation.dfduu[i], costApproximation_check.dfduu)
+
 
 if __name__ == "__main__":
     unittest.main()
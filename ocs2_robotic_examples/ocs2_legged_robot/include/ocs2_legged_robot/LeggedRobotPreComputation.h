@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/PreComputation.h>
 #include <ocs2_pinocchio_interface/PinocchioInterface.h>
+#include <ocs2_pinocchio_interface/PinocchioPreComputation.h>
 
 #include <ocs2_centroidal_model/CentroidalModelPinocchioMapping.h>
 
@@ -44,11 +45,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace legged_robot {
 
-/** Callback for caching and reference update */
-class LeggedRobotPreComputation : public PreComputation {
+/**
+ * Callback for caching and reference update.
+ *
+ * If cacheCentroidalDynamics is set, it also updates the centroidal dynamics in pinocchio::Data once per node on Request::Dynamics, such
+ * that the pinocchio-based terms can read it through getPinocchioInterface():
+ *   updateCentroidalDynamics(interface, info, q)
+ * and additionally on Request::Approximation:
+ *   updateCentroidalDynamicsDerivatives(interface, info, q, v)
+ */
+class LeggedRobotPreComputation : public PinocchioPreComputation {
  public:
   LeggedRobotPreComputation(PinocchioInterface pinocchioInterface, CentroidalModelInfo info,
-                            const SwingTrajectoryPlanner& swingTrajectoryPlanner, ModelSettings settings);
+                            const SwingTrajectoryPlanner& swingTrajectoryPlanner, ModelSettings settings,
+                            bool cacheCentroidalDynamics = false);
   ~LeggedRobotPreComputation() override = default;
 
   LeggedRobotPreComputation* clone() const override;
@@ -57,14 +67,16 @@ class LeggedRobotPreComputation : public PreComputation {
 
   const std::vector<EndEffectorLinearConstraint::Config>& getEeNormalVelocityConstraintConfigs() const { return eeNormalVelConConfigs_; }
 
-  PinocchioInterface& getPinocchioInterface() { return pinocchioInterface_; }
-  const PinocchioInterface& getPinocchioInterface() const { return pinocchioInterface_; }
+  const CentroidalModelInfo& getCentroidalModelInfo() const { return info_; }
+
+ protected:
+  void updatePinocchioData(RequestSet request, const vector_t& x) override;
 
  private:
   LeggedRobotPreComputation(const LeggedRobotPreComputation& other) = default;
 
-  PinocchioInterface pinocchioInterface_;
   CentroidalModelInfo info_;
+  bool cacheCentroidalDynamics_;
   const SwingTrajectoryPlanner* swingTrajectoryPlannerPtr_;
   const ModelSettings settings_;
 
@@ -101,6 +101,11 @@ class FrictionConeConstraint final : public StateInputConstraint {
   VectorFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                  const PreComputation& preComp) const override;
 
+  /** Applies the chain rule of the penalty on the forces of the contact and on the Hessian diagonal shift only. */
+  void accumulatePenaltyQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp,
+                                               const MultidimensionalPenalty& penalty,
+                                               ScalarFunctionQuadraticApproximation& approximation) const override;
+
   /** Sets the estimated terrain normal expressed in the world frame. */
   void setSurfaceNormalInWorld(const vector3_t& surfaceNormalInWorld);
 
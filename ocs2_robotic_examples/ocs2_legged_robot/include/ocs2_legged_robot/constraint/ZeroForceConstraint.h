@@ -55,6 +55,8 @@ class ZeroForceConstraint final : public StateInputConstraint {
   vector_t getValue(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp) const override;
   VectorFunctionLinearApproximation getLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                            const PreComputation& preComp) const override;
+  void fillLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp,
+                               size_t rowOffset, VectorFunctionLinearApproximation& stackedApproximation) const override;
 
  private:
   ZeroForceConstraint(const ZeroForceConstraint& other) = default;
@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_legged_robot/constraint/ZeroForceConstraint.h"
 #include "ocs2_legged_robot/constraint/ZeroVelocityConstraintCppAd.h"
 #include "ocs2_legged_robot/cost/LeggedRobotStateInputQuadraticCost.h"
+#include "ocs2_legged_robot/dynamics/LeggedRobotDynamics.h"
 #include "ocs2_legged_robot/dynamics/LeggedRobotDynamicsAD.h"
 
 // Boost
@@ -133,9 +134,15 @@ void LeggedRobotInterface::setupOptimalConrolProblem(const std::string& taskFile
   // Dynamics
   bool useAnalyticalGradientsDynamics = false;
   loadData::loadCppDataType(taskFile, "legged_robot_interface.useAnalyticalGradientsDynamics", useAnalyticalGradientsDynamics);
+
+  // Pre-computation (the analytical dynamics read the centroidal dynamics from its cache)
+  std::unique_ptr<LeggedRobotPreComputation> preComputationPtr(
+      new LeggedRobotPreComputation(*pinocchioInterfacePtr_, centroidalModelInfo_, *referenceManagerPtr_->getSwingTrajectoryPlanner(),
+                                    modelSettings_, useAnalyticalGradientsDynamics));
+
   std::unique_ptr<SystemDynamicsBase> dynamicsPtr;
   if (useAnalyticalGradientsDynamics) {
-    throw std::runtime_error("[LeggedRobotInterface::setupOptimalConrolProblem] The analytical dynamics class is not yet implemented!");
+    dynamicsPtr.reset(new LeggedRobotDynamics(centroidalModelInfo_, *preComputationPtr));
   } else {
     const std::string modelName = "dynamics";
     dynamicsPtr.reset(new LeggedRobotDynamicsAD(*pinocchioInterfacePtr_, centroidalModelInfo_, modelName, modelSettings_));
@@ -184,8 +191,7 @@ void LeggedRobotInterface::setupOptimalConrolProblem(const std::string& taskFile
   }
 
   // Pre-computation
-  problemPtr_->preComputationPtr.reset(new LeggedRobotPreComputation(*pinocchioInterfacePtr_, centroidalModelInfo_,
-                                                                     *referenceManagerPtr_->getSwingTrajectoryPlanner(), modelSettings_));
+  problemPtr_->preComputationPtr = std::move(preComputationPtr);
 
   // Rollout
   rolloutPtr_.reset(new TimeTriggeredRollout(*problemPtr_->dynamicsPtr, rolloutSettings_));
@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <pinocchio/algorithm/jacobian.hpp>
 #include <pinocchio/algorithm/kinematics.hpp>
 
+#include <ocs2_centroidal_model/ModelHelperFunctions.h>
 #include <ocs2_core/misc/Numerics.h>
 
 #include <ocs2_legged_robot/LeggedRobotPreComputation.h>
@@ -40,13 +41,25 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace legged_robot {
 
+namespace {
+PinocchioPreComputation::Settings centroidalDynamicsSettings() {
+  PinocchioPreComputation::Settings settings;
+  settings.request = Request::Dynamics;
+  settings.jointJacobians = false;
+  settings.centroidalMap = true;
+  return settings;
+}
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 LeggedRobotPreComputation::LeggedRobotPreComputation(PinocchioInterface pinocchioInterface, CentroidalModelInfo info,
-                                                     const SwingTrajectoryPlanner& swingTrajectoryPlanner, ModelSettings settings)
-    : pinocchioInterface_(std::move(pinocchioInterface)),
+                                                     const SwingTrajectoryPlanner& swingTrajectoryPlanner, ModelSettings settings,
+                                                     bool cacheCentroidalDynamics)
+    : PinocchioPreComputation(std::move(pinocchioInterface), CentroidalModelPinocchioMapping(info), centroidalDynamicsSettings()),
       info_(std::move(info)),
+      cacheCentroidalDynamics_(cacheCentroidalDynamics),
       swingTrajectoryPlannerPtr_(&swingTrajectoryPlanner),
       settings_(std::move(settings)) {
   eeNormalVelConConfigs_.resize(info_.numThreeDofContacts);
@@ -63,6 +76,16 @@ LeggedRobotPreComputation* LeggedRobotPreComputation::clone() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void LeggedRobotPreComputation::request(RequestSet request, scalar_t t, const vector_t& x, const vector_t& u) {
+  if (cacheCentroidalDynamics_ && request.contains(Request::Dynamics)) {
+    updatePinocchioData(request, x);
+    if (request.contains(Request::Approximation)) {
+      // the generalized velocities depend on the centroidal momentum matrix of updatePinocchioData()
+      const vector_t q = getPinocchioMapping().getPinocchioJointPosition(x);
+      const vector_t v = getPinocchioMapping().getPinocchioJointVelocity(x, u);
+      updateCentroidalDynamicsDerivatives(getPinocchioInterface(), info_, q, v);
+    }
+  }
+
   if (!request.containsAny(Request::Cost + Request::Constraint + Request::SoftConstraint)) {
     return;
   }
@@ -86,5 +109,15 @@ void LeggedRobotPreComputation::request(RequestSet request, scalar_t t, const ve
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LeggedRobotPreComputation::updatePinocchioData(RequestSet request, const vector_t& x) {
+  if (cacheCentroidalDynamics_) {
+    const vector_t q = getPinocchioMapping().getPinocchioJointPosition(x);
+    updateCentroidalDynamics(getPinocchioInterface(), info_, q);
+  }
+}
+
 }  // namespace legged_robot
 }  // namespace ocs2
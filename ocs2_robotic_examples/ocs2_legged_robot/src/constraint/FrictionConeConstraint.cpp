@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_legged_robot/constraint/FrictionConeConstraint.h"
 
 #include <ocs2_centroidal_model/AccessHelperFunctions.h>
+#include <ocs2_core/penalties/MultidimensionalPenalty.h>
 
 namespace ocs2 {
 namespace legged_robot {
@@ -113,6 +114,35 @@ VectorFunctionQuadraticApproximation FrictionConeConstraint::getQuadraticApproxi
   return quadraticApproximation;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void FrictionConeConstraint::accumulatePenaltyQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                                     const PreComputation& preComp, const MultidimensionalPenalty& penalty,
+                                                                     ScalarFunctionQuadraticApproximation& approximation) const {
+  const vector3_t forcesInWorldFrame = centroidal_model::getContactForces(input, contactPointIndex_, info_);
+  const vector3_t localForce = t_R_w * forcesInWorldFrame;
+
+  const auto localForceDerivatives = computeLocalForceDerivatives(forcesInWorldFrame);
+  const auto coneLocalDerivatives = computeConeLocalDerivatives(localForce);
+  const auto coneDerivatives = computeConeConstraintDerivatives(coneLocalDerivatives, localForceDerivatives);
+
+  scalar_t penaltyValue = 0.0;
+  vector_t penaltyDerivative, penaltySecondDerivative;
+  std::tie(penaltyValue, penaltyDerivative, penaltySecondDerivative) = penalty.getPenaltyValue1stDev2ndDev(time, coneConstraint(localForce));
+
+  // the constraint Jacobian is only nonzero for the forces of the contact, and its Hessian adds the diagonal shift on top
+  const size_t forceIndex = 3 * contactPointIndex_;
+  const scalar_t hessianDiagonalShift = penaltyDerivative(0) * config_.hessianDiagonalShift;
+  approximation.f += penaltyValue;
+  approximation.dfdu.segment<3>(forceIndex).noalias() += penaltyDerivative(0) * coneDerivatives.dCone_du;
+  approximation.dfduu.block<3, 3>(forceIndex, forceIndex).noalias() +=
+      penaltySecondDerivative(0) * coneDerivatives.dCone_du * coneDerivatives.dCone_du.transpose() +
+      penaltyDerivative(0) * coneDerivatives.d2Cone_du2;
+  approximation.dfduu.diagonal().array() -= hessianDiagonalShift;
+  approximation.dfdxx.diagonal().array() -= hessianDiagonalShift;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
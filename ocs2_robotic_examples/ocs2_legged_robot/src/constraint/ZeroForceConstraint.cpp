@@ -71,5 +71,16 @@ VectorFunctionLinearApproximation ZeroForceConstraint::getLinearApproximation(sc
   return approx;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ZeroForceConstraint::fillLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                  const PreComputation& preComp, size_t rowOffset,
+                                                  VectorFunctionLinearApproximation& stackedApproximation) const {
+  // the rows are zero on entry, only the contact force entries of dfdu are set
+  stackedApproximation.f.segment<3>(rowOffset) = getValue(time, state, input, preComp);
+  stackedApproximation.dfdu.block<3, 3>(rowOffset, 3 * contactPointIndex_).diagonal().setOnes();
+}
+
 }  // namespace legged_robot
 }  // namespace ocs2
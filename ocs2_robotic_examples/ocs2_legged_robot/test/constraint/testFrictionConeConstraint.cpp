@@ -32,6 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_centroidal_model/AccessHelperFunctions.h>
 #include <ocs2_core/misc/LinearAlgebra.h>
+#include <ocs2_core/penalties/MultidimensionalPenalty.h>
+#include <ocs2_core/penalties/penalties/RelaxedBarrierPenalty.h>
 
 #include "ocs2_legged_robot/constraint/FrictionConeConstraint.h"
 #include "ocs2_legged_robot/test/AnymalFactoryFunctions.h"
@@ -202,3 +204,34 @@ TEST_F(TestFrictionConeConstraint, negativeDefinite) {
     ASSERT_LT(LinearAlgebra::symmetricEigenvalues(quadraticApproximation.dfduu.front()).maxCoeff(), 0.0);
   }
 }
+
+TEST_F(TestFrictionConeConstraint, penaltyQuadraticApproximation) {
+  const FrictionConeConstraint::Config config;
+  const MultidimensionalPenalty penalty(std::unique_ptr<PenaltyBase>(new RelaxedBarrierPenalty(RelaxedBarrierPenalty::Config(0.1, 5.0))));
+  const auto stateDim = centroidalModelInfo.stateDim;
+  const auto inputDim = centroidalModelInfo.inputDim;
+
+  // evaluation point, with forces inside and outside of the friction cones
+  scalar_t t = 0.0;
+  vector_t x = vector_t::Random(stateDim);
+  vector_t u = 50.0 * vector_t::Random(inputDim);
+
+  for (size_t legNumber = 0; legNumber < centroidalModelInfo.numThreeDofContacts; ++legNumber) {
+    FrictionConeConstraint frictionConeConstraint(*referenceManagerPtr, config, legNumber, centroidalModelInfo);
+
+    // the sparse chain rule matches the penalty of the dense constraint approximation
+    auto expected = ScalarFunctionQuadraticApproximation::Zero(stateDim, inputDim);
+    expected.dfdxx.setIdentity();
+    expected.dfduu.setIdentity();
+    auto accumulated = expected;
+    penalty.accumulateQuadraticApproximation(t, frictionConeConstraint.getQuadraticApproximation(t, x, u, preComputation), expected);
+    frictionConeConstraint.accumulatePenaltyQuadraticApproximation(t, x, u, preComputation, penalty, accumulated);
+
+    EXPECT_DOUBLE_EQ(accumulated.f, expected.f);
+    EXPECT_TRUE(accumulated.dfdx.isApprox(expected.dfdx));
+    EXPECT_TRUE(accumulated.dfdu.isApprox(expected.dfdu));
+    EXPECT_TRUE(accumulated.dfdxx.isApprox(expected.dfdxx));
+    EXPECT_TRUE(accumulated.dfdux.isApprox(expected.dfdux));
+    EXPECT_TRUE(accumulated.dfduu.isApprox(expected.dfduu));
+  }
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ocs2_legged_robot/LeggedRobotPreComputation.h"
+#include "ocs2_legged_robot/common/ModelSettings.h"
+#include "ocs2_legged_robot/dynamics/LeggedRobotDynamics.h"
+#include "ocs2_legged_robot/dynamics/LeggedRobotDynamicsAD.h"
+#include "ocs2_legged_robot/test/AnymalFactoryFunctions.h"
+
+using namespace ocs2;
+using namespace legged_robot;
+
+class TestLeggedRobotDynamics : public ::testing::TestWithParam<CentroidalModelType> {
+ public:
+  TestLeggedRobotDynamics()
+      : centroidalModelInfo(createAnymalCentroidalModelInfo(*pinocchioInterfacePtr, GetParam())),
+        referenceManagerPtr(createReferenceManager(centroidalModelInfo.numThreeDofContacts)),
+        preComputation(*pinocchioInterfacePtr, centroidalModelInfo, *referenceManagerPtr->getSwingTrajectoryPlanner(), modelSettings, true),
+        dynamics(centroidalModelInfo, preComputation),
+        dynamicsAd(*pinocchioInterfacePtr, centroidalModelInfo, "TestLeggedRobotDynamics" + toString(GetParam()), modelSettings) {}
+
+  static constexpr scalar_t tol = 1e-9;
+  const ModelSettings modelSettings;
+  std::unique_ptr<PinocchioInterface> pinocchioInterfacePtr = createAnymalPinocchioInterface();
+  const CentroidalModelInfo centroidalModelInfo;
+  std::shared_ptr<SwitchedModelReferenceManager> referenceManagerPtr;
+  LeggedRobotPreComputation preComputation;
+  LeggedRobotDynamics dynamics;
+  LeggedRobotDynamicsAD dynamicsAd;
+};
+
+constexpr scalar_t TestLeggedRobotDynamics::tol;
+
+TEST_P(TestLeggedRobotDynamics, compareToAD) {
+  for (size_t i = 0; i < 10; i++) {
+    const scalar_t t = 0.0;
+    const vector_t x = vector_t::Random(centroidalModelInfo.stateDim);
+    const vector_t u = 100.0 * vector_t::Random(centroidalModelInfo.inputDim);
+
+    preComputation.request(Request::Dynamics, t, x, u);
+    const vector_t flowMap = dynamics.computeFlowMap(t, x, u, preComputation);
+    preComputation.request(Request::Dynamics + Request::Approximation, t, x, u);
+    const auto approx = dynamics.linearApproximation(t, x, u, preComputation);
+    const auto approxAd = dynamicsAd.linearApproximation(t, x, u, preComputation);
+
+    EXPECT_TRUE(flowMap.isApprox(approxAd.f, tol));
+    EXPECT_TRUE(approx.f.isApprox(approxAd.f, tol));
+    EXPECT_TRUE(approx.dfdx.isApprox(approxAd.dfdx, tol));
+    EXPECT_TRUE(approx.dfdu.isApprox(approxAd.dfdu, tol));
+  }
+}
+
+TEST_P(TestLeggedRobotDynamics, clone) {
+  std::unique_ptr<LeggedRobotDynamics> dynamicsClonePtr(dynamics.clone());
+
+  const scalar_t t = 0.0;
+  const vector_t x = vector_t::Random(centroidalModelInfo.stateDim);
+  const vector_t u = 100.0 * vector_t::Random(centroidalModelInfo.inputDim);
+
+  preComputation.request(Request::Dynamics + Request::Approximation, t, x, u);
+  const auto approx = dynamics.linearApproximation(t, x, u, preComputation);
+  const auto cloneApprox = dynamicsClonePtr->linearApproximation(t, x, u, preComputation);
+
+  EXPECT_TRUE(approx.f.isApprox(cloneApprox.f));
+  EXPECT_TRUE(approx.dfdx.isApprox(cloneApprox.dfdx));
+  EXPECT_TRUE(approx.dfdu.isApprox(cloneApprox.dfdu));
+}
+
+INSTANTIATE_TEST_CASE_P(TestLeggedRobotDynamicsWithParam, TestLeggedRobotDynamics,
+                        testing::ValuesIn({CentroidalModelType::FullCentroidalDynamics, CentroidalModelType::SingleRigidBodyDynamics}),
+                        [](const testing::TestParamInfo<TestLeggedRobotDynamics::ParamType>& info) { return toString(info.param); });
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_msgs/mode_schedule.h>
 #include <ocs2_msgs/mpc_flattened_controller.h>
 #include <ocs2_msgs/mpc_observation.h>
+#include <ocs2_msgs/mpc_serialized_policy.h>
 #include <ocs2_msgs/mpc_target_trajectories.h>
 #include <ocs2_msgs/reset.h>
 
@@ -53,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_mpc/CommandData.h>
 #include <ocs2_mpc/MPC_BASE.h>
+#include <ocs2_mpc/PolicySerialization.h>
 #include <ocs2_mpc/SystemObservation.h>
 #include <ocs2_oc/oc_data/PrimalSolution.h>
 
@@ -62,6 +64,9 @@ namespace ocs2 {
 
 /**
  * This class implements MPC communication interface using ROS.
+ *
+ * The observation callback only stores the latest observation. The MPC runs on a dedicated solver thread, which always solves for the
+ * freshest observation. Observations that arrive while the MPC is running replace each other and only the latest one is solved.
  */
 class MPC_ROS_Interface {
  public:
@@ -70,8 +75,11 @@ class MPC_ROS_Interface {
    *
    * @param [in] mpc: The underlying MPC class to be used.
    * @param [in] topicPrefix: The robot's name.
+   * @param [in] solverThreadPriority: The priority of the solver thread from 0 (default) to 99 (highest).
+   * @param [in] solverThreadCpus: The CPUs the solver thread may run on. If empty, it may run on all CPUs.
    */
-  explicit MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix = "anonymousRobot");
+  explicit MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix = "anonymousRobot", int solverThreadPriority = 0,
+                             const std::vector<int>& solverThreadCpus = {});
 
   /**
    * Destructor.
@@ -97,7 +105,8 @@ class MPC_ROS_Interface {
 
   /**
    * This is the main routine which launches all the nodes required for MPC to run which includes:
-   * (1) The MPC policy publisher (either feedback or feedforward policy).
+   * (1) The MPC policy publishers (either feedback or feedforward policy). The policy is published in the binary format of
+   *     PolicySerializer on "topicPrefix_mpc_serialized_policy", and as a flattened controller on "topicPrefix_mpc_policy".
    * (2) The observation subscriber which gets the current measured state to invoke the MPC run routine.
    */
   void launchNodes(ros::NodeHandle& nodeHandle);
@@ -122,6 +131,15 @@ class MPC_ROS_Interface {
   static ocs2_msgs::mpc_flattened_controller createMpcPolicyMsg(const PrimalSolution& primalSolution, const CommandData& commandData,
                                                                 const PerformanceIndex& performanceIndices);
 
+  /**
+   * Publishes the MPC policy on the policy topics that have subscribers.
+   *
+   * @param [in] primalSolution: The policy data of the MPC.
+   * @param [in] commandData: The command data of the MPC.
+   * @param [in] performanceIndices: The performance indices data of the solver.
+   */
+  void publishPolicy(const PrimalSolution& primalSolution, const CommandData& commandData, const PerformanceIndex& performanceIndices);
+
   /**
    * Handles ROS publishing thread.
    */
@@ -135,13 +153,24 @@ class MPC_ROS_Interface {
   void copyToBuffer(const SystemObservation& mpcInitObservation);
 
   /**
-   * The callback method which receives the current observation, invokes the MPC algorithm,
-   * and finally publishes the optimized policy.
+   * The callback method which receives the current observation and hands it to the solver thread.
    *
    * @param [in] msg: The observation message.
    */
   void mpcObservationCallback(const ocs2_msgs::mpc_observation::ConstPtr& msg);
 
+  /**
+   * Handles the solver thread. It waits for a new observation and runs the MPC for the latest one.
+   */
+  void solverWorker();
+
+  /**
+   * Invokes the MPC algorithm for an observation and finally publishes the optimized policy.
+   *
+   * @param [in] currentObservation: The observation to run the MPC for.
+   */
+  void runMpc(const SystemObservation& currentObservation);
+
  protected:
   /*
    * Variables
@@ -156,6 +185,7 @@ class MPC_ROS_Interface {
   ::ros::Subscriber mpcObservationSubscriber_;
   ::ros::Subscriber mpcTargetTrajectoriesSubscriber_;
   ::ros::Publisher mpcPolicyPublisher_;
+  ::ros::Publisher mpcSerializedPolicyPublisher_;
   ::ros::ServiceServer mpcResetServiceServer_;
 
   std::unique_ptr<CommandData> bufferCommandPtr_;
@@ -167,6 +197,10 @@ class MPC_ROS_Interface {
 
   mutable std::mutex bufferMutex_;  // for policy variables with prefix (buffer*)
 
+  // binary policy message, reused for every publication
+  PolicySerializer policySerializer_;
+  ocs2_msgs::mpc_serialized_policy serializedPolicyMsg_;
+
   // multi-threading for publishers
   std::atomic_bool terminateThread_{false};
   std::atomic_bool readyToPublish_{false};
@@ -174,6 +208,17 @@ class MPC_ROS_Interface {
   std::mutex publisherMutex_;
   std::condition_variable msgReady_;
 
+  // latest observation, handed from the observation callback to the solver thread
+  std::thread solverWorker_;
+  std::mutex observationMutex_;
+  std::condition_variable observationReady_;
+  SystemObservation latestObservation_;
+  bool newObservation_ = false;
+  // number of observations which were replaced by a newer one before the MPC ran for them
+  size_t numCoalescedObservations_ = 0;
+  // time from receiving an observation to starting the MPC for it
+  benchmark::RepeatedTimer observationAgeTimer_;
+
   benchmark::RepeatedTimer mpcTimer_;
 
   // MPC reset
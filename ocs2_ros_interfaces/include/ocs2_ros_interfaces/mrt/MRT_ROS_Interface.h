@@ -43,9 +43,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // MPC messages
 #include <ocs2_msgs/mpc_flattened_controller.h>
+#include <ocs2_msgs/mpc_serialized_policy.h>
 #include <ocs2_msgs/reset.h>
 
 #include <ocs2_mpc/MRT_BASE.h>
+#include <ocs2_mpc/PolicySerialization.h>
 
 #include "ocs2_ros_interfaces/common/RosMsgConversions.h"
 
@@ -62,11 +64,15 @@ class MRT_ROS_Interface : public MRT_BASE {
    * Constructor
    *
    * @param [in] topicPrefix: The prefix defines the names for: observation's publishing topic "topicPrefix_mpc_observation",
-   * policy's receiving topic "topicPrefix_mpc_policy", and MPC reset service "topicPrefix_mpc_reset".
+   * policy's receiving topic "topicPrefix_mpc_serialized_policy" or "topicPrefix_mpc_policy", and MPC reset service
+   * "topicPrefix_mpc_reset".
    * @param [in] mrtTransportHints: ROS transmission protocol.
+   * @param [in] useSerializedPolicy: Whether to receive the serialized policy, see PolicySerializer, or the flattened controller
+   * message of MPC nodes which do not publish the serialized policy.
    */
   explicit MRT_ROS_Interface(std::string topicPrefix = "anonymousRobot",
-                             ::ros::TransportHints mrtTransportHints = ::ros::TransportHints().tcpNoDelay());
+                             ::ros::TransportHints mrtTransportHints = ::ros::TransportHints().tcpNoDelay(),
+                             bool useSerializedPolicy = true);
 
   /**
    * Destructor
@@ -101,11 +107,18 @@ class MRT_ROS_Interface : public MRT_BASE {
  private:
   /**
    * Callback method to receive the MPC policy as well as the mode sequence.
-   * It only updates the policy variables with suffix (*Buffer_) variables.
+   * It only updates the policy variables with suffix (*Buffer_) variables. Malformed messages are dropped.
    *
    * @param [in] msg: A constant pointer to the message
    */
-  void mpcPolicyCallback(const ocs2_msgs::mpc_flattened_controller::ConstPtr& msg);
+  void mpcPolicyCallback(const ocs2_msgs::mpc_serialized_policy::ConstPtr& msg);
+
+  /**
+   * Callback method to receive the MPC policy as a flattened controller message, see mpcPolicyCallback().
+   *
+   * @param [in] msg: A constant pointer to the message
+   */
+  void mpcFlattenedPolicyCallback(const ocs2_msgs::mpc_flattened_controller::ConstPtr& msg);
 
   /**
    * Helper function to read a MPC policy message.
@@ -125,6 +138,7 @@ class MRT_ROS_Interface : public MRT_BASE {
 
  private:
   std::string topicPrefix_;
+  bool useSerializedPolicy_;
 
   // Publishers and subscribers
   ::ros::Publisher mpcObservationPublisher_;
@@ -135,6 +149,8 @@ class MRT_ROS_Interface : public MRT_BASE {
   ocs2_msgs::mpc_observation mpcObservationMsg_;
   ocs2_msgs::mpc_observation mpcObservationMsgBuffer_;
 
+  PolicyDeserializer policyDeserializer_;
+
   ::ros::CallbackQueue mrtCallbackQueue_;
   ::ros::TransportHints mrtTransportHints_;
 
@@ -128,6 +128,7 @@ ocs2_msgs::mpc_performance_indices createPerformanceIndicesMsg(scalar_t initTime
   performanceIndicesMsg.cost = performanceIndices.cost;
   performanceIndicesMsg.dynamicsViolationSSE = performanceIndices.dynamicsViolationSSE;
   performanceIndicesMsg.equalityConstraintsSSE = performanceIndices.equalityConstraintsSSE;
+  performanceIndicesMsg.inequalityConstraintsSSE = performanceIndices.inequalityConstraintsSSE;
   performanceIndicesMsg.equalityLagrangian = performanceIndices.equalityLagrangian;
   performanceIndicesMsg.inequalityLagrangian = performanceIndices.inequalityLagrangian;
 
@@ -144,6 +145,7 @@ PerformanceIndex readPerformanceIndicesMsg(const ocs2_msgs::mpc_performance_indi
   performanceIndices.cost = performanceIndicesMsg.cost;
   performanceIndices.dynamicsViolationSSE = performanceIndicesMsg.dynamicsViolationSSE;
   performanceIndices.equalityConstraintsSSE = performanceIndicesMsg.equalityConstraintsSSE;
+  performanceIndices.inequalityConstraintsSSE = performanceIndicesMsg.inequalityConstraintsSSE;
   performanceIndices.equalityLagrangian = performanceIndicesMsg.equalityLagrangian;
   performanceIndices.inequalityLagrangian = performanceIndicesMsg.inequalityLagrangian;
 
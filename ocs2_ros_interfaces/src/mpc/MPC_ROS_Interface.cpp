@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_ros_interfaces/mpc/MPC_ROS_Interface.h"
 
+#include <ocs2_core/thread_support/SetThreadPriority.h>
+
 #include "ocs2_ros_interfaces/common/RosMsgConversions.h"
 
 namespace ocs2 {
@@ -36,7 +38,8 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix)
+MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix, int solverThreadPriority,
+                                     const std::vector<int>& solverThreadCpus)
     : mpc_(mpc),
       topicPrefix_(std::move(topicPrefix)),
       bufferPrimalSolutionPtr_(new PrimalSolution()),
@@ -49,6 +52,11 @@ MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix)
 #ifdef PUBLISH_THREAD
   publisherWorker_ = std::thread(&MPC_ROS_Interface::publisherWorker, this);
 #endif
+
+  // start thread for solving
+  solverWorker_ = std::thread(&MPC_ROS_Interface::solverWorker, this);
+  setThreadPriority(solverThreadPriority, solverWorker_);
+  setThreadAffinity(solverThreadCpus, solverWorker_);
 }
 
 /******************************************************************************************************/
@@ -66,6 +74,12 @@ void MPC_ROS_Interface::resetMpcNode(TargetTrajectories&& initTargetTrajectories
   mpc_.reset();
   mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
   mpcTimer_.reset();
+  {
+    std::lock_guard<std::mutex> observationLock(observationMutex_);
+    newObservation_ = false;
+    numCoalescedObservations_ = 0;
+    observationAgeTimer_.reset();
+  }
   resetRequestedEver_ = true;
   terminateThread_ = false;
   readyToPublish_ = false;
@@ -177,6 +191,22 @@ ocs2_msgs::mpc_flattened_controller MPC_ROS_Interface::createMpcPolicyMsg(const
   return mpcPolicyMsg;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::publishPolicy(const PrimalSolution& primalSolution, const CommandData& commandData,
+                                      const PerformanceIndex& performanceIndices) {
+  if (mpcSerializedPolicyPublisher_.getNumSubscribers() > 0) {
+    policySerializer_.serialize(commandData, primalSolution, performanceIndices, serializedPolicyMsg_.data);
+    mpcSerializedPolicyPublisher_.publish(serializedPolicyMsg_);
+  }
+
+  // the flattened controller is only built for other subscribers, e.g. for plotting
+  if (mpcPolicyPublisher_.getNumSubscribers() > 0) {
+    mpcPolicyPublisher_.publish(createMpcPolicyMsg(primalSolution, commandData, performanceIndices));
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -197,11 +227,8 @@ void MPC_ROS_Interface::publisherWorker() {
       publisherPerformanceIndicesPtr_.swap(bufferPerformanceIndicesPtr_);
     }
 
-    ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
-        createMpcPolicyMsg(*publisherPrimalSolutionPtr_, *publisherCommandPtr_, *publisherPerformanceIndicesPtr_);
-
-    // publish the message
-    mpcPolicyPublisher_.publish(mpcPolicyMsg);
+    // publish the messages
+    publishPolicy(*publisherPrimalSolutionPtr_, *publisherCommandPtr_, *publisherPerformanceIndicesPtr_);
 
     readyToPublish_ = false;
     lk.unlock();
@@ -235,16 +262,55 @@ void MPC_ROS_Interface::copyToBuffer(const SystemObservation& mpcInitObservation
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation::ConstPtr& msg) {
-  std::lock_guard<std::mutex> resetLock(resetMutex_);
-
   if (!resetRequestedEver_.load()) {
     ROS_WARN_STREAM("MPC should be reset first. Either call MPC_ROS_Interface::reset() or use the reset service.");
     return;
   }
 
   // current time, state, input, and subsystem
-  const auto currentObservation = ros_msg_conversions::readObservationMsg(*msg);
+  auto currentObservation = ros_msg_conversions::readObservationMsg(*msg);
+
+  // replace the observation which is not yet taken by the solver thread
+  std::unique_lock<std::mutex> lk(observationMutex_);
+  if (newObservation_) {
+    numCoalescedObservations_++;
+  }
+  latestObservation_ = std::move(currentObservation);
+  newObservation_ = true;
+  observationAgeTimer_.startTimer();
+  lk.unlock();
+  observationReady_.notify_one();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::solverWorker() {
+  SystemObservation currentObservation;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lk(observationMutex_);
+      observationReady_.wait(lk, [&] { return (newObservation_ || terminateThread_); });
+
+      if (terminateThread_) {
+        break;
+      }
+
+      std::swap(currentObservation, latestObservation_);
+      newObservation_ = false;
+      observationAgeTimer_.endTimer();
+    }
 
+    std::lock_guard<std::mutex> resetLock(resetMutex_);
+    runMpc(currentObservation);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::runMpc(const SystemObservation& currentObservation) {
   // measure the delay in running MPC
   mpcTimer_.startTimer();
 
@@ -273,7 +339,11 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
     std::cerr << "\n### MPC_ROS Benchmarking";
     std::cerr << "\n###   Maximum : " << mpcTimer_.getMaxIntervalInMilliseconds() << "[ms].";
     std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
-    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
+    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms].";
+    std::lock_guard<std::mutex> observationLock(observationMutex_);
+    std::cerr << "\n###   Observation age maximum : " << observationAgeTimer_.getMaxIntervalInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Observation age average : " << observationAgeTimer_.getAverageInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Coalesced observations  : " << numCoalescedObservations_ << std::endl;
   }
 
 #ifdef PUBLISH_THREAD
@@ -283,9 +353,7 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
   msgReady_.notify_one();
 
 #else
-  ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
-      createMpcPolicyMsg(*bufferPrimalSolutionPtr_, *bufferCommandPtr_, *bufferPerformanceIndicesPtr_);
-  mpcPolicyPublisher_.publish(mpcPolicyMsg);
+  publishPolicy(*bufferPrimalSolutionPtr_, *bufferCommandPtr_, *bufferPerformanceIndicesPtr_);
 #endif
 }
 
@@ -293,9 +361,19 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MPC_ROS_Interface::shutdownNode() {
-#ifdef PUBLISH_THREAD
   ROS_INFO_STREAM("Shutting down workers ...");
 
+  std::unique_lock<std::mutex> observationLock(observationMutex_);
+  terminateThread_ = true;
+  observationLock.unlock();
+
+  observationReady_.notify_all();
+
+  if (solverWorker_.joinable()) {
+    solverWorker_.join();
+  }
+
+#ifdef PUBLISH_THREAD
   std::unique_lock<std::mutex> lk(publisherMutex_);
   terminateThread_ = true;
   lk.unlock();
@@ -305,12 +383,13 @@ void MPC_ROS_Interface::shutdownNode() {
   if (publisherWorker_.joinable()) {
     publisherWorker_.join();
   }
+#endif
 
   ROS_INFO_STREAM("All workers are shut down.");
-#endif
 
   // shutdown publishers
   mpcPolicyPublisher_.shutdown();
+  mpcSerializedPolicyPublisher_.shutdown();
 }
 
 /******************************************************************************************************/
@@ -336,6 +415,7 @@ void MPC_ROS_Interface::launchNodes(ros::NodeHandle& nodeHandle) {
 
   // MPC publisher
   mpcPolicyPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_flattened_controller>(topicPrefix_ + "_mpc_policy", 1, true);
+  mpcSerializedPolicyPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_serialized_policy>(topicPrefix_ + "_mpc_serialized_policy", 1, true);
 
   // MPC reset service server
   mpcResetServiceServer_ = nodeHandle.advertiseService(topicPrefix_ + "_mpc_reset", &MPC_ROS_Interface::resetMpcCallback, this);
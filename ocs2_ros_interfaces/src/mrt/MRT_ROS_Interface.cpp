@@ -37,8 +37,8 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-MRT_ROS_Interface::MRT_ROS_Interface(std::string topicPrefix, ros::TransportHints mrtTransportHints)
-    : topicPrefix_(std::move(topicPrefix)), mrtTransportHints_(mrtTransportHints) {
+MRT_ROS_Interface::MRT_ROS_Interface(std::string topicPrefix, ros::TransportHints mrtTransportHints, bool useSerializedPolicy)
+    : topicPrefix_(std::move(topicPrefix)), useSerializedPolicy_(useSerializedPolicy), mrtTransportHints_(mrtTransportHints) {
 // Start thread for publishing
 #ifdef PUBLISH_THREAD
   // Close old thread if it is already running
@@ -188,14 +188,33 @@ void MRT_ROS_Interface::readPolicyMsg(const ocs2_msgs::mpc_flattened_controller&
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void MRT_ROS_Interface::mpcPolicyCallback(const ocs2_msgs::mpc_flattened_controller::ConstPtr& msg) {
-  // read new policy and command from msg
-  std::unique_ptr<CommandData> commandPtr(new CommandData);
-  std::unique_ptr<PrimalSolution> primalSolutionPtr(new PrimalSolution);
-  std::unique_ptr<PerformanceIndex> performanceIndicesPtr(new PerformanceIndex);
-  readPolicyMsg(*msg, *commandPtr, *primalSolutionPtr, *performanceIndicesPtr);
+void MRT_ROS_Interface::mpcPolicyCallback(const ocs2_msgs::mpc_serialized_policy::ConstPtr& msg) {
+  // read new policy and command from msg into the recycled buffer
+  auto& buffer = this->getBufferToFill();
+  try {
+    if (policyDeserializer_.deserialize(msg->data.data(), msg->data.size(), buffer.command, buffer.primalSolution,
+                                        buffer.performanceIndices)) {
+      this->publishBuffer();
+    }
+  } catch (const std::exception& error) {
+    // the buffer is not published, and the next policy has to be complete
+    policyDeserializer_.reset();
+    ROS_ERROR_STREAM("[MRT_ROS_Interface::mpcPolicyCallback] Dropping a malformed policy message: " << error.what());
+  }
+}
 
-  this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_ROS_Interface::mpcFlattenedPolicyCallback(const ocs2_msgs::mpc_flattened_controller::ConstPtr& msg) {
+  // read new policy and command from msg into the recycled buffer
+  auto& buffer = this->getBufferToFill();
+  try {
+    readPolicyMsg(*msg, buffer.command, buffer.primalSolution, buffer.performanceIndices);
+    this->publishBuffer();
+  } catch (const std::exception& error) {
+    ROS_ERROR_STREAM("[MRT_ROS_Interface::mpcFlattenedPolicyCallback] Dropping a malformed policy message: " << error.what());
+  }
 }
 
 /******************************************************************************************************/
@@ -253,15 +272,27 @@ void MRT_ROS_Interface::launchNodes(ros::NodeHandle& nodeHandle) {
   mpcObservationPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_observation>(topicPrefix_ + "_mpc_observation", 1);
 
   // policy subscriber
-  auto ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_flattened_controller>(
-      topicPrefix_ + "_mpc_policy",                                                       // topic name
-      1,                                                                                  // queue length
-      boost::bind(&MRT_ROS_Interface::mpcPolicyCallback, this, boost::placeholders::_1),  // callback
-      ros::VoidConstPtr(),                                                                // tracked object
-      &mrtCallbackQueue_                                                                  // pointer to callback queue object
-  );
-  ops.transport_hints = mrtTransportHints_;
-  mpcPolicySubscriber_ = nodeHandle.subscribe(ops);
+  if (useSerializedPolicy_) {
+    auto ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_serialized_policy>(
+        topicPrefix_ + "_mpc_serialized_policy",                                            // topic name
+        1,                                                                                  // queue length
+        boost::bind(&MRT_ROS_Interface::mpcPolicyCallback, this, boost::placeholders::_1),  // callback
+        ros::VoidConstPtr(),                                                                // tracked object
+        &mrtCallbackQueue_                                                                  // pointer to callback queue object
+    );
+    ops.transport_hints = mrtTransportHints_;
+    mpcPolicySubscriber_ = nodeHandle.subscribe(ops);
+  } else {
+    auto ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_flattened_controller>(
+        topicPrefix_ + "_mpc_policy",                                                                // topic name
+        1,                                                                                           // queue length
+        boost::bind(&MRT_ROS_Interface::mpcFlattenedPolicyCallback, this, boost::placeholders::_1),  // callback
+        ros::VoidConstPtr(),                                                                         // tracked object
+        &mrtCallbackQueue_                                                                           // pointer to callback queue object
+    );
+    ops.transport_hints = mrtTransportHints_;
+    mpcPolicySubscriber_ = nodeHandle.subscribe(ops);
+  }
 
   // MPC reset service client
   mpcResetServiceClient_ = nodeHandle.serviceClient<ocs2_msgs::reset>(topicPrefix_ + "_mpc_reset");
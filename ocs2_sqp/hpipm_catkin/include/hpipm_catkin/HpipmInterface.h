@@ -45,11 +45,17 @@ namespace ocs2 {
 /**
  * This class implements the interface between Linear Quadratic optimal control problems defined in OCS2 and the HPIPM solver.
  * If the problem dimensions change, resize needs to be called to re-initialize HPIPM.
+ *
+ * With Settings::partialCondensingBlockSize > 1, the QP is partially condensed before it is passed to the interior point method and the
+ * solution is expanded afterwards. The Riccati quantities of the original stages are then recomputed from the problem data, which must be
+ * left unchanged between solve() and the getRiccati*() calls. If the problem has constraints, the first getRiccati*() call after a solve
+ * solves the uncondensed QP once more, since the constraints enter the Riccati factors through the interior point method.
  */
 class HpipmInterface {
  public:
   using OcpSize = hpipm_interface::OcpSize;
   using Settings = hpipm_interface::Settings;
+  using InequalityPartition = hpipm_interface::InequalityPartition;
 
   /**
    * Construct the Hpipm interface with given size and settings.
@@ -63,6 +69,15 @@ class HpipmInterface {
   /** Resize the problem */
   void resize(OcpSize ocpSize);
 
+  /**
+   * Resize the problem with inequality constraints.
+   *
+   * @param ocpSize : Size of the problem, see hpipm_interface::extractSizesFromProblem.
+   * @param ineqPartitions : Partition of the inequality constraints of each node into box and general constraints, see
+   * hpipm_interface::updateInequalityPartition. Without a partition, it is taken from the inequality constraints of the first solve.
+   */
+  void resize(OcpSize ocpSize, std::vector<InequalityPartition> ineqPartitions);
+
   /**
    * Solves a discrete linear quadratic optimal control problem. The interface needs to be resized to a consistent OcpSize before calling
    * this function
@@ -87,6 +102,42 @@ class HpipmInterface {
                      std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
                      vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose = false);
 
+  /**
+   * Solves a discrete linear quadratic optimal control problem with inequality constraints. The interface needs to be resized to a
+   * consistent OcpSize before calling this function, see hpipm_interface::extractSizesFromProblem.
+   *
+   * @param x0 : Initial state (deviation).
+   * @param dynamics : Linearized approximation of the discrete dynamics.
+   * @param cost : Quadratic approximation of the cost.
+   * @param constraints : Linearized approximation of equality constraints, mapped to inequality constraints with lg = ug in HPIPM.
+   * @param ineqConstraints : Linearized approximation of inequality constraints h >= 0. They are mapped to HPIPM box and general constraints
+   * according to the partition passed to resize(), unbounded sides are masked out. The constraints are softened if the OcpSize contains
+   * slacks. Throws if the bounds of a hard box constraint are inconsistent.
+   * @param [out] stateTrajectory : Solution state (deviation) trajectory.
+   * @param [out] inputTrajectory : Solution input (deviation) trajectory.
+   * @param verbose : Prints the HPIPM iteration statistics if true.
+   * @return HPIPM returned flag, see above.
+   */
+  hpipm_status solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                     std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
+                     std::vector<VectorFunctionLinearApproximation>* ineqConstraints, vector_array_t& stateTrajectory,
+                     vector_array_t& inputTrajectory, bool verbose = false);
+
+  /**
+   * Shifts the stored solution used for warm starting (Settings::warm_start = 2) by a number of stages, e.g. when the MPC horizon moved.
+   * Stages at the end of the horizon, or whose constraint structure changed, are initialized without warm start. With partial condensing,
+   * the stored solution is removed if the shift is not a multiple of Settings::partialCondensingBlockSize.
+   *
+   * @param numStages : Number of stages the start of the horizon moved forward.
+   */
+  void shiftWarmStart(int numStages);
+
+  /** Removes the stored solution used for warm starting */
+  void resetWarmStart();
+
+  /** Returns the number of interior point iterations of the previous solve */
+  int getNumIterations() const;
+
   /**
    * Return the Riccati cost-to-go for the previously solved problem.
    * Extra information about the initial stage is needed to complete calculation.
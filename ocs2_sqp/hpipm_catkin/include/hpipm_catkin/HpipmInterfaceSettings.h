@@ -51,9 +51,17 @@ struct Settings {
   scalar_t tol_ineq = 1e-8;  // res_d_max
   scalar_t tol_comp = 1e-8;  // res_m_max
   scalar_t reg_prim = 1e-12;
-  int warm_start = 0;
+  int warm_start = 0;  // 0: cold start, 1: primal warm start, 2: primal-dual warm start from the previous (shifted) solution
   int pred_corr = 1;
   int ric_alg = 0;  // square root ricatti recursion
+
+  // Number of stages condensed into a single stage before solving, 1 = no condensing. Trades the number of stages in the Riccati recursion
+  // against the size of each stage, which pays off for short dense stages (few states, many inputs or a fine time discretization).
+  int partialCondensingBlockSize = 1;
+
+  // Penalty on the slacks of softened inequality constraints: 0.5 * slackQuadraticWeight * s^2 + slackLinearWeight * s, with s >= 0
+  scalar_t slackQuadraticWeight = 1e2;
+  scalar_t slackLinearWeight = 1e2;
 };
 
 std::ostream& operator<<(std::ostream& stream, const Settings& settings);
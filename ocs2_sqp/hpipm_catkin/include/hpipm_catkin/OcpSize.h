@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <ocs2_core/Types.h>
@@ -76,17 +77,76 @@ struct OcpSize {
 
 bool operator==(const OcpSize& lhs, const OcpSize& rhs) noexcept;
 
+/**
+ * Partition of the rows of a linearized inequality constraint h(x, u) = f + dfdx * dx + dfdu * du >= 0 at a single node.
+ *
+ * A row with a single structurally nonzero coefficient bounds one decision variable and is mapped to an HPIPM box constraint. Multiple rows
+ * bounding the same variable are merged into a single box constraint. All other rows are mapped to general polytopic constraints. Rows
+ * without any nonzero coefficient can not be influenced by the QP and are ignored.
+ *
+ * The partition describes the structure of the constraint and should be kept over the iterations of a solver, see
+ * updateInequalityPartition. It should not follow coefficients that happen to vanish at a particular linearization.
+ */
+struct InequalityPartition {
+  int numRows = 0;                                // Number of rows of the partitioned constraint
+  std::vector<int> inputBoxIndices;               // Box constrained inputs, in increasing order
+  std::vector<int> stateBoxIndices;               // Box constrained states, in increasing order
+  std::vector<std::pair<int, int>> inputBoxRows;  // Pairs of (row, input index) for rows mapped to input box constraints
+  std::vector<std::pair<int, int>> stateBoxRows;  // Pairs of (row, state index) for rows mapped to state box constraints
+  std::vector<int> generalRows;                   // Rows mapped to general constraints
+};
+
+/**
+ * Partitions the rows of a linearized inequality constraint into box and general constraints, based on the nonzero coefficients.
+ *
+ * @param ineqConstraint : Linearized approximation of the inequality constraint h >= 0.
+ * @param withStates : Whether the state is a decision variable. False for the initial node, where the state contribution is a constant.
+ * @return Row partition
+ */
+InequalityPartition partitionInequalityConstraint(const VectorFunctionLinearApproximation& ineqConstraint, bool withStates = true);
+
+/**
+ * Extends a partition with the nonzero coefficients of a new linearization of the same constraint. Rows only move from being ignored to
+ * box constraints to general constraints, such that the partition converges to the sparsity structure of the constraint. The partition is
+ * recomputed if the number of rows changed.
+ *
+ * @param ineqConstraint : Linearized approximation of the inequality constraint h >= 0.
+ * @param [in, out] partition : Row partition of previous linearizations of the constraint.
+ * @param withStates : Whether the state is a decision variable. False for the initial node, where the state contribution is a constant.
+ */
+void updateInequalityPartition(const VectorFunctionLinearApproximation& ineqConstraint, InequalityPartition& partition,
+                               bool withStates = true);
+
 /**
  * Extract sizes based on the problem data
  *
  * @param dynamics : Linearized approximation of the discrete dynamics.
  * @param cost : Quadratic approximation of the cost.
  * @param constraints : Linearized approximation of constraints, all constraints are mapped to inequality constraints in HPIPM.
+ * @param ineqConstraints : Linearized approximation of inequality constraints h >= 0, mapped to box and general constraints in HPIPM.
+ * @param softenIneqConstraints : Adds a slack variable to each inequality constraint (equality constraints remain hard).
+ * @return Derived sizes
+ */
+OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                                const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                const std::vector<VectorFunctionLinearApproximation>* ineqConstraints = nullptr,
+                                bool softenIneqConstraints = false);
+
+/**
+ * Extract sizes based on the problem data and a given partition of the inequality constraints
+ *
+ * @param dynamics : Linearized approximation of the discrete dynamics.
+ * @param cost : Quadratic approximation of the cost.
+ * @param constraints : Linearized approximation of constraints, all constraints are mapped to inequality constraints in HPIPM.
+ * @param ineqPartitions : Partition of the inequality constraints of each node into box and general constraints. Empty if there are none.
+ * @param softenIneqConstraints : Adds a slack variable to each inequality constraint (equality constraints remain hard).
  * @return Derived sizes
  */
 OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
                                 const std::vector<ScalarFunctionQuadraticApproximation>& cost,
-                                const std::vector<VectorFunctionLinearApproximation>* constraints);
+                                const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                const std::vector<InequalityPartition>& ineqPartitions, bool softenIneqConstraints);
 
 }  // namespace hpipm_interface
 }  // namespace ocs2
\ No newline at end of file
@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "hpipm_catkin/HpipmInterface.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <ocs2_core/misc/LinearAlgebra.h>
 
 extern "C" {
@@ -36,6 +39,7 @@ extern "C" {
 #include <hpipm_d_ocp_qp_dim.h>
 #include <hpipm_d_ocp_qp_ipm.h>
 #include <hpipm_d_ocp_qp_sol.h>
+#include <hpipm_d_part_cond.h>
 #include <hpipm_timing.h>
 }
 
@@ -116,36 +120,96 @@ class HpipmInterface::Impl {
     qpSolMem_.reserve(qp_sol_size);
     d_ocp_qp_sol_create(&dim_, &qpSol_, qpSolMem_.get());
 
-    const int ipm_arg_size = d_ocp_qp_ipm_arg_memsize(&dim_);
+    hasConstraints_ = false;
+    for (int k = 0; k <= ocpSize_.numStages; k++) {
+      hasConstraints_ = hasConstraints_ || ocpSize_.numInputBoxConstraints[k] > 0 || ocpSize_.numStateBoxConstraints[k] > 0 ||
+                        ocpSize_.numIneqConstraints[k] > 0;
+    }
+
+    initializeCondensing();
+    uncondensedIpmInitialized_ = false;
+
+    const int ipm_arg_size = d_ocp_qp_ipm_arg_memsize(&ipmDim());
     ipmArgMem_.reserve(ipm_arg_size);
-    d_ocp_qp_ipm_arg_create(&dim_, &arg_, ipmArgMem_.get());
+    d_ocp_qp_ipm_arg_create(&ipmDim(), &arg_, ipmArgMem_.get());
 
-    applySettings(settings_);
+    applySettings(settings_, arg_);
 
     // Setup workspace after applying the settings
-    const int ipm_size = d_ocp_qp_ipm_ws_memsize(&dim_, &arg_);
+    const int ipm_size = d_ocp_qp_ipm_ws_memsize(&ipmDim(), &arg_);
     ipmMem_.reserve(ipm_size);
-    d_ocp_qp_ipm_ws_create(&dim_, &arg_, &workspace_, ipmMem_.get());
+    d_ocp_qp_ipm_ws_create(&ipmDim(), &arg_, &workspace_, ipmMem_.get());
   }
 
-  void applySettings(Settings& settings) {
-    d_ocp_qp_ipm_arg_set_default(settings.hpipmMode, &arg_);
-    d_ocp_qp_ipm_arg_set_iter_max(&settings.iter_max, &arg_);
-    d_ocp_qp_ipm_arg_set_alpha_min(&settings.alpha_min, &arg_);
-    d_ocp_qp_ipm_arg_set_mu0(&settings.mu0, &arg_);
-    d_ocp_qp_ipm_arg_set_tol_stat(&settings.tol_stat, &arg_);
-    d_ocp_qp_ipm_arg_set_tol_eq(&settings.tol_eq, &arg_);
-    d_ocp_qp_ipm_arg_set_tol_ineq(&settings.tol_ineq, &arg_);
-    d_ocp_qp_ipm_arg_set_tol_comp(&settings.tol_comp, &arg_);
-    d_ocp_qp_ipm_arg_set_reg_prim(&settings.reg_prim, &arg_);
-    d_ocp_qp_ipm_arg_set_warm_start(&settings.warm_start, &arg_);
-    d_ocp_qp_ipm_arg_set_pred_corr(&settings.pred_corr, &arg_);
-    d_ocp_qp_ipm_arg_set_ric_alg(&settings.ric_alg, &arg_);
+  /**
+   * Sets up the partially condensed QP if requested: blocks of Settings::partialCondensingBlockSize stages are condensed into a single
+   * stage, which the IPM solves instead of the original QP.
+   */
+  void initializeCondensing() {
+    const int N = ocpSize_.numStages;
+    const int stagesPerBlock = std::max(settings_.partialCondensingBlockSize, 1);
+    const int numBlocks = (N + stagesPerBlock - 1) / stagesPerBlock;
+    useCondensing_ = numBlocks < N;
+    if (!useCondensing_) {
+      return;
+    }
+
+    // Distributes the stages over the blocks, block sizes differ by at most one stage.
+    blockSize_.assign(numBlocks + 1, 0);
+    d_part_cond_qp_compute_block_size(N, numBlocks, blockSize_.data());
+
+    const int dim_size = d_ocp_qp_dim_memsize(numBlocks);
+    condensedDimMem_.reserve(dim_size);
+    d_ocp_qp_dim_create(numBlocks, &condensedDim_, condensedDimMem_.get());
+    d_part_cond_qp_compute_dim(&dim_, blockSize_.data(), &condensedDim_);
+
+    const int arg_size = d_part_cond_qp_arg_memsize(numBlocks);
+    condensingArgMem_.reserve(arg_size);
+    d_part_cond_qp_arg_create(numBlocks, &condensingArg_, condensingArgMem_.get());
+    d_part_cond_qp_arg_set_default(&condensingArg_);
+    d_part_cond_qp_arg_set_ric_alg(settings_.ric_alg, &condensingArg_);
+
+    const int ws_size = d_part_cond_qp_ws_memsize(&dim_, blockSize_.data(), &condensedDim_, &condensingArg_);
+    condensingMem_.reserve(ws_size);
+    d_part_cond_qp_ws_create(&dim_, blockSize_.data(), &condensedDim_, &condensingArg_, &condensingWorkspace_, condensingMem_.get());
+
+    const int qp_size = d_ocp_qp_memsize(&condensedDim_);
+    condensedQpMem_.reserve(qp_size);
+    d_ocp_qp_create(&condensedDim_, &condensedQp_, condensedQpMem_.get());
+
+    const int qp_sol_size = d_ocp_qp_sol_memsize(&condensedDim_);
+    condensedQpSolMem_.reserve(qp_sol_size);
+    d_ocp_qp_sol_create(&condensedDim_, &condensedQpSol_, condensedQpSolMem_.get());
+  }
+
+  /** The dimensions, problem and solution of the QP that is solved by the IPM, i.e. the condensed one if condensing is active. */
+  d_ocp_qp_dim& ipmDim() { return useCondensing_ ? condensedDim_ : dim_; }
+  d_ocp_qp& ipmQp() { return useCondensing_ ? condensedQp_ : qp_; }
+  d_ocp_qp_sol& ipmSol() { return useCondensing_ ? condensedQpSol_ : qpSol_; }
+
+  /** The arguments and workspace of the IPM that factorized the uncondensed QP, see solveUncondensedQp(). */
+  d_ocp_qp_ipm_arg& uncondensedArg() { return useCondensing_ ? uncondensedArg_ : arg_; }
+  d_ocp_qp_ipm_ws& uncondensedWorkspace() { return useCondensing_ ? uncondensedWorkspace_ : workspace_; }
+
+  void applySettings(Settings& settings, d_ocp_qp_ipm_arg& arg) {
+    d_ocp_qp_ipm_arg_set_default(settings.hpipmMode, &arg);
+    d_ocp_qp_ipm_arg_set_iter_max(&settings.iter_max, &arg);
+    d_ocp_qp_ipm_arg_set_alpha_min(&settings.alpha_min, &arg);
+    d_ocp_qp_ipm_arg_set_mu0(&settings.mu0, &arg);
+    d_ocp_qp_ipm_arg_set_tol_stat(&settings.tol_stat, &arg);
+    d_ocp_qp_ipm_arg_set_tol_eq(&settings.tol_eq, &arg);
+    d_ocp_qp_ipm_arg_set_tol_ineq(&settings.tol_ineq, &arg);
+    d_ocp_qp_ipm_arg_set_tol_comp(&settings.tol_comp, &arg);
+    d_ocp_qp_ipm_arg_set_reg_prim(&settings.reg_prim, &arg);
+    d_ocp_qp_ipm_arg_set_warm_start(&settings.warm_start, &arg);
+    d_ocp_qp_ipm_arg_set_pred_corr(&settings.pred_corr, &arg);
+    d_ocp_qp_ipm_arg_set_ric_alg(&settings.ric_alg, &arg);
   }
 
   void verifySizes(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                    std::vector<ScalarFunctionQuadraticApproximation>& cost,
-                   std::vector<VectorFunctionLinearApproximation>* constraints) const {
+                   std::vector<VectorFunctionLinearApproximation>* constraints,
+                   std::vector<VectorFunctionLinearApproximation>* ineqConstraints) const {
     if (dynamics.size() != ocpSize_.numStages) {
       throw std::runtime_error("[HpipmInterface] Inconsistent size of dynamics: " + std::to_string(dynamics.size()) + " with " +
                                std::to_string(ocpSize_.numStages) + " number of stages.");
@@ -160,19 +224,30 @@ class HpipmInterface::Impl {
                                  std::to_string(ocpSize_.numStages + 1) + " nodes.");
       }
     }
+    if (ineqConstraints != nullptr) {
+      if (ineqConstraints->size() != static_cast<size_t>(ocpSize_.numStages + 1)) {
+        throw std::runtime_error("[HpipmInterface] Inconsistent size of inequality constraints: " +
+                                 std::to_string(ineqConstraints->size()) + " with " + std::to_string(ocpSize_.numStages + 1) + " nodes.");
+      }
+    }
     // TODO: expand with state-input size checks
   }
 
   hpipm_status solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                      std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
-                     vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose) {
+                     std::vector<VectorFunctionLinearApproximation>* ineqConstraints, vector_array_t& stateTrajectory,
+                     vector_array_t& inputTrajectory, bool verbose) {
     const int N = ocpSize_.numStages;
-    verifySizes(x0, dynamics, cost, constraints);
+    verifySizes(x0, dynamics, cost, constraints, ineqConstraints);
+
+    // Pointer arrays and derived data are members, such that their memory is reused across solves.
+    qpPointers_.reset(N);
+    riccatiUpToDate_ = false;
 
     // === Dynamics ===
-    std::vector<scalar_t*> AA(N, nullptr);
-    std::vector<scalar_t*> BB(N, nullptr);
-    std::vector<scalar_t*> bb(N, nullptr);
+    auto& AA = qpPointers_.A;
+    auto& BB = qpPointers_.B;
+    auto& bb = qpPointers_.b;
 
     // k = 0. Absorb initial state into dynamics
     // The initial state is removed from the decision variables
@@ -181,7 +256,8 @@ class HpipmInterface::Impl {
     //         = B[0]*u[0] + (b[0] + A[0]*x[0])
     //         = B[0]*u[0] + \tilde{b}[0]
     // numState[0] = 0 --> No need to specify A[0] here
-    vector_t b0 = dynamics[0].f;
+    vector_t& b0 = b0_;
+    b0 = dynamics[0].f;
     b0.noalias() += dynamics[0].dfdx * x0;
     BB[0] = dynamics[0].dfdu.data();
     bb[0] = b0.data();
@@ -194,16 +270,17 @@ class HpipmInterface::Impl {
     }
 
     // === Costs ===
-    std::vector<scalar_t*> QQ(N + 1, nullptr);
-    std::vector<scalar_t*> RR(N + 1, nullptr);
-    std::vector<scalar_t*> SS(N + 1, nullptr);
-    std::vector<scalar_t*> qq(N + 1, nullptr);
-    std::vector<scalar_t*> rr(N + 1, nullptr);
+    auto& QQ = qpPointers_.Q;
+    auto& RR = qpPointers_.R;
+    auto& SS = qpPointers_.S;
+    auto& qq = qpPointers_.q;
+    auto& rr = qpPointers_.r;
 
     // k = 0. Elimination of initial state requires cost adaptation
     // numState[0] = 0 --> No need to specify Q[0], S[0], q[0] here
-    vector_t r0 = cost[0].dfdu;
-    r0 += cost[0].dfdux * x0;
+    vector_t& r0 = r0_;
+    r0 = cost[0].dfdu;
+    r0.noalias() += cost[0].dfdux * x0;
     RR[0] = cost[0].dfduu.data();
     rr[0] = r0.data();
 
@@ -223,11 +300,11 @@ class HpipmInterface::Impl {
     // === Constraints ===
     // for ocs2 --> C*dx + D*du + e = 0
     // for hpipm --> ug >= C*dx + D*du >= lg
-    std::vector<scalar_t*> CC(N + 1, nullptr);
-    std::vector<scalar_t*> DD(N + 1, nullptr);
-    std::vector<scalar_t*> llg(N + 1, nullptr);
-    std::vector<scalar_t*> uug(N + 1, nullptr);
-    std::vector<ocs2::vector_t> boundData;  // Declare at this scope to keep the data alive while HPIPM has the pointers
+    auto& CC = qpPointers_.C;
+    auto& DD = qpPointers_.D;
+    auto& llg = qpPointers_.lg;
+    auto& uug = qpPointers_.ug;
+    auto& boundData = boundData_;  // Member to keep the data alive while HPIPM has the pointers
 
     if (constraints != nullptr) {
       auto& constr = *constraints;
@@ -263,25 +340,95 @@ class HpipmInterface::Impl {
       }
     }
 
-    // === Unused ===
-    int** hidxbx = nullptr;
-    scalar_t** hlbx = nullptr;
-    scalar_t** hubx = nullptr;
-    int** hidxbu = nullptr;
-    scalar_t** hlbu = nullptr;
-    scalar_t** hubu = nullptr;
-    scalar_t** hZl = nullptr;
-    scalar_t** hZu = nullptr;
-    scalar_t** hzl = nullptr;
-    scalar_t** hzu = nullptr;
-    int** hidxs = nullptr;
-    scalar_t** hlls = nullptr;
-    scalar_t** hlus = nullptr;
+    // === Inequality constraints ===
+    // for ocs2 --> H*dx + G*du + h >= 0
+    // for hpipm --> ubx >= dx[idxbx] >= lbx and ubu >= du[idxbu] >= lbu for rows acting on a single variable
+    //               ug >= C*dx + D*du >= lg for all other rows, stacked below the equality constraints
+    auto& hidxbx = qpPointers_.idxbx;
+    auto& hlbx = qpPointers_.lbx;
+    auto& hubx = qpPointers_.ubx;
+    auto& hidxbu = qpPointers_.idxbu;
+    auto& hlbu = qpPointers_.lbu;
+    auto& hubu = qpPointers_.ubu;
+    auto& hZ = qpPointers_.Z;
+    auto& hz = qpPointers_.z;
+    auto& hidxs = qpPointers_.idxs;
+    auto& hls = qpPointers_.ls;
+    auto& ineqData = ineqData_;  // Member to keep the data alive while HPIPM has the pointers
+
+    if (ineqConstraints != nullptr) {
+      // Without a partition from resize(), the structure is taken from the first problem
+      if (ineqPartitions_.size() != static_cast<size_t>(N + 1)) {
+        ineqPartitions_.clear();
+        for (int k = 0; k <= N; k++) {
+          ineqPartitions_.push_back(hpipm_interface::partitionInequalityConstraint((*ineqConstraints)[k], k > 0));
+        }
+      }
+
+      ineqData.resize(N + 1);
+      for (int k = 0; k <= N; k++) {
+        auto& data = ineqData[k];
+        const auto* equalities = (constraints != nullptr && (*constraints)[k].f.size() > 0) ? &(*constraints)[k] : nullptr;
+        setupInequalities(k, x0, (*ineqConstraints)[k], ineqPartitions_[k], equalities, data);
+
+        if (!data.idxbu.empty()) {
+          hidxbu[k] = data.idxbu.data();
+          hlbu[k] = data.lbu.data();
+          hubu[k] = data.ubu.data();
+        }
+        if (!data.idxbx.empty()) {
+          hidxbx[k] = data.idxbx.data();
+          hlbx[k] = data.lbx.data();
+          hubx[k] = data.ubx.data();
+        }
+        if (data.lg.size() > 0) {  // General inequalities present, replaces the equality only data
+          CC[k] = (k > 0) ? data.C.data() : nullptr;
+          DD[k] = (k < N) ? data.D.data() : nullptr;
+          llg[k] = data.lg.data();
+          uug[k] = data.ug.data();
+        }
+        if (!data.idxs.empty()) {
+          hZ[k] = data.Z.data();
+          hz[k] = data.z.data();
+          hidxs[k] = data.idxs.data();
+          hls[k] = data.ls.data();
+        }
+      }
+    }
 
     // === Set and solve ===
-    d_ocp_qp_set_all(AA.data(), BB.data(), bb.data(), QQ.data(), SS.data(), RR.data(), qq.data(), rr.data(), hidxbx, hlbx, hubx, hidxbu,
-                     hlbu, hubu, CC.data(), DD.data(), llg.data(), uug.data(), hZl, hZu, hzl, hzu, hidxs, hlls, hlus, &qp_);
-    d_ocp_qp_ipm_solve(&qp_, &qpSol_, &arg_, &workspace_);
+    // Slacks are penalized symmetrically, and bounded below by zero: Zl = Zu, zl = zu, ls = us = 0
+    d_ocp_qp_set_all(AA.data(), BB.data(), bb.data(), QQ.data(), SS.data(), RR.data(), qq.data(), rr.data(), hidxbx.data(), hlbx.data(),
+                     hubx.data(), hidxbu.data(), hlbu.data(), hubu.data(), CC.data(), DD.data(), llg.data(), uug.data(), hZ.data(),
+                     hZ.data(), hz.data(), hz.data(), hidxs.data(), hls.data(), hls.data(), &qp_);
+    if (ineqConstraints != nullptr) {
+      // Unbounded sides of the inequality constraints are masked out
+      for (int k = 0; k <= N; k++) {
+        auto& data = ineqData[k];
+        if (!data.idxbu.empty()) {
+          d_ocp_qp_set_lbu_mask(k, data.lbuMask.data(), &qp_);
+          d_ocp_qp_set_ubu_mask(k, data.ubuMask.data(), &qp_);
+        }
+        if (!data.idxbx.empty()) {
+          d_ocp_qp_set_lbx_mask(k, data.lbxMask.data(), &qp_);
+          d_ocp_qp_set_ubx_mask(k, data.ubxMask.data(), &qp_);
+        }
+        if (data.lgMask.size() > 0) {
+          d_ocp_qp_set_lg_mask(k, data.lgMask.data(), &qp_);
+          d_ocp_qp_set_ug_mask(k, data.ugMask.data(), &qp_);
+        }
+      }
+    }
+    if (useCondensing_) {
+      d_part_cond_qp_cond(&qp_, &condensedQp_, &condensingArg_, &condensingWorkspace_);
+    }
+    if (settings_.warm_start == 2) {
+      loadWarmStart();
+    }
+    d_ocp_qp_ipm_solve(&ipmQp(), &ipmSol(), &arg_, &workspace_);
+    if (useCondensing_) {
+      d_part_cond_qp_expand_sol(&qp_, &condensedQp_, &condensedQpSol_, &qpSol_, &condensingArg_, &condensingWorkspace_);
+    }
 
     if (verbose) {
       printStatus();
@@ -297,9 +444,347 @@ class HpipmInterface::Impl {
     // Return solver status
     int hpipmStatus = -1;
     d_ocp_qp_ipm_get_status(&workspace_, &hpipmStatus);
+    if (settings_.warm_start == 2 && hpipmStatus == hpipm_status::SUCCESS) {
+      storeWarmStart();
+    }
     return hpipm_status(hpipmStatus);
   }
 
+  void shiftWarmStart(int numStages) {
+    if (useCondensing_) {
+      // The stored solution is of the condensed blocks, it can only be shifted by complete blocks.
+      const int stagesPerBlock = std::max(blockSize_.front(), 1);
+      if (numStages % stagesPerBlock != 0) {
+        resetWarmStart();
+        return;
+      }
+      numStages /= stagesPerBlock;
+    }
+    const auto numErase = std::min(static_cast<size_t>(std::max(numStages, 0)), warmStart_.size());
+    warmStart_.erase(warmStart_.begin(), warmStart_.begin() + numErase);
+  }
+
+  void resetWarmStart() { warmStart_.clear(); }
+
+  int getNumIterations() {
+    int iter = 0;
+    d_ocp_qp_ipm_get_iter(&workspace_, &iter);
+    return iter;
+  }
+
+  void setInequalityPartitions(std::vector<InequalityPartition> ineqPartitions) { ineqPartitions_ = std::move(ineqPartitions); }
+
+  /**
+   * Box, general and slack data of the inequality constraints at a single node. Owns the memory HPIPM points to. A bound is only active
+   * if its mask is one, the masked value is ignored by HPIPM.
+   */
+  struct NodeInequalities {
+    std::vector<int> idxbu;
+    vector_t lbu;
+    vector_t ubu;
+    vector_t lbuMask;
+    vector_t ubuMask;
+    std::vector<int> idxbx;
+    vector_t lbx;
+    vector_t ubx;
+    vector_t lbxMask;
+    vector_t ubxMask;
+    matrix_t C;
+    matrix_t D;
+    vector_t lg;
+    vector_t ug;
+    vector_t lgMask;
+    vector_t ugMask;
+    std::vector<int> idxs;
+    vector_t Z;
+    vector_t z;
+    vector_t ls;
+  };
+
+  /**
+   * Maps the linearized inequality constraints h >= 0 of node k to HPIPM box and general constraints according to the given partition. If
+   * general constraints are present, they are stacked below the equality constraints of the same node.
+   */
+  void setupInequalities(int k, const vector_t& x0, const VectorFunctionLinearApproximation& ineqConstraint,
+                         const InequalityPartition& partition, const VectorFunctionLinearApproximation* equalities,
+                         NodeInequalities& data) const {
+    const int numEqualities = (equalities != nullptr) ? equalities->f.size() : 0;
+    const int numBoxInputs = partition.inputBoxIndices.size();
+    const int numBoxStates = partition.stateBoxIndices.size();
+    const int numGeneral = partition.generalRows.size();
+    if (partition.numRows != ineqConstraint.f.size() || numBoxInputs != ocpSize_.numInputBoxConstraints[k] ||
+        numBoxStates != ocpSize_.numStateBoxConstraints[k] || numEqualities + numGeneral != ocpSize_.numIneqConstraints[k]) {
+      throw std::runtime_error("[HpipmInterface] Inconsistent structure of the inequality constraints at node " + std::to_string(k) +
+                               ". Was the interface resized with the current problem?");
+    }
+    const int numSlacks = ocpSize_.numInputBoxSlack[k] + ocpSize_.numStateBoxSlack[k] + ocpSize_.numIneqSlack[k];
+
+    // k = 0, eliminate initial state
+    vector_t h = ineqConstraint.f;
+    if (k == 0 && h.size() > 0) {
+      h.noalias() += ineqConstraint.dfdx * x0;
+    }
+
+    // A box row acts on at most one decision variable
+    auto isBoxRow = [&](int row) {
+      auto numNonZeros = (ineqConstraint.dfdu.row(row).array() != 0.0).count();
+      if (k > 0) {
+        numNonZeros += (ineqConstraint.dfdx.row(row).array() != 0.0).count();
+      }
+      return numNonZeros <= 1;
+    };
+
+    // Box constraints, merging multiple bounds on the same variable: a * dv + h >= 0
+    auto setBounds = [&](const std::vector<int>& indices, const std::vector<std::pair<int, int>>& rows, const matrix_t& jacobian,
+                         vector_t& lb, vector_t& ub, vector_t& lbMask, vector_t& ubMask) {
+      lb.setZero(indices.size());
+      ub.setZero(indices.size());
+      lbMask.setZero(indices.size());
+      ubMask.setZero(indices.size());
+      for (const auto& rowAndIndex : rows) {
+        const int row = rowAndIndex.first;
+        if (!isBoxRow(row)) {
+          throw std::runtime_error("[HpipmInterface] Row " + std::to_string(row) + " of the inequality constraints at node " +
+                                   std::to_string(k) + " does not match its box partition. Update the partition with the new nonzeros.");
+        }
+        const int box = std::lower_bound(indices.begin(), indices.end(), rowAndIndex.second) - indices.begin();
+        const scalar_t a = jacobian(row, rowAndIndex.second);
+        if (a == 0.0) {  // Does not bound the variable at this linearization
+          continue;
+        }
+        const scalar_t bound = -h(row) / a;
+        if (a > 0.0) {
+          lb(box) = (lbMask(box) > 0.0) ? std::max(lb(box), bound) : bound;
+          lbMask(box) = 1.0;
+        } else {
+          ub(box) = (ubMask(box) > 0.0) ? std::min(ub(box), bound) : bound;
+          ubMask(box) = 1.0;
+        }
+      }
+      for (int box = 0; box < static_cast<int>(indices.size()); box++) {
+        if (numSlacks == 0 && lbMask(box) > 0.0 && ubMask(box) > 0.0 && lb(box) > ub(box)) {
+          throw std::runtime_error("[HpipmInterface] Infeasible box constraint at node " + std::to_string(k) + ": lower bound " +
+                                   std::to_string(lb(box)) + " exceeds upper bound " + std::to_string(ub(box)) + ".");
+        }
+      }
+    };
+    data.idxbu = partition.inputBoxIndices;
+    setBounds(data.idxbu, partition.inputBoxRows, ineqConstraint.dfdu, data.lbu, data.ubu, data.lbuMask, data.ubuMask);
+    data.idxbx = partition.stateBoxIndices;
+    setBounds(data.idxbx, partition.stateBoxRows, ineqConstraint.dfdx, data.lbx, data.ubx, data.lbxMask, data.ubxMask);
+
+    // General constraints, one-sided: G*du + H*dx >= -h
+    const int numConstraints = numEqualities + numGeneral;
+    data.lgMask.setOnes(numConstraints);
+    data.ugMask.setOnes(numConstraints);
+    if (numGeneral > 0) {
+      const int numStates = ocpSize_.numStates[k];
+      const int numInputs = ocpSize_.numInputs[k];
+      data.C.resize(numConstraints, numStates);
+      data.D.resize(numConstraints, numInputs);
+      data.lg.resize(numConstraints);
+      data.ug.resize(numConstraints);
+      if (numEqualities > 0) {
+        if (numStates > 0) {
+          data.C.topRows(numEqualities) = equalities->dfdx;
+        }
+        if (numInputs > 0) {
+          data.D.topRows(numEqualities) = equalities->dfdu;
+        }
+        data.lg.head(numEqualities) = -equalities->f;
+        if (k == 0) {
+          data.lg.head(numEqualities).noalias() -= equalities->dfdx * x0;
+        }
+        data.ug.head(numEqualities) = data.lg.head(numEqualities);
+      }
+      for (int i = 0; i < numGeneral; i++) {
+        const int row = partition.generalRows[i];
+        if (numStates > 0) {
+          data.C.row(numEqualities + i) = ineqConstraint.dfdx.row(row);
+        }
+        if (numInputs > 0) {
+          data.D.row(numEqualities + i) = ineqConstraint.dfdu.row(row);
+        }
+        data.lg(numEqualities + i) = -h(row);
+      }
+      data.ug.tail(numGeneral).setZero();
+      data.ugMask.tail(numGeneral).setZero();
+    }
+
+    // Slacks, all inequalities are softened or none: HPIPM indexes soft constraints in the stacked [box inputs, box states, general] vector
+    if (numSlacks > 0) {
+      if (numSlacks != numBoxInputs + numBoxStates + numGeneral) {
+        throw std::runtime_error("[HpipmInterface] Only softening all inequality constraints of a node is supported, at node " +
+                                 std::to_string(k) + ".");
+      }
+      data.idxs.clear();
+      data.idxs.reserve(numSlacks);
+      for (int i = 0; i < numBoxInputs + numBoxStates; i++) {
+        data.idxs.push_back(i);
+      }
+      for (int i = 0; i < numGeneral; i++) {
+        data.idxs.push_back(numBoxInputs + numBoxStates + numEqualities + i);
+      }
+      data.Z.setConstant(numSlacks, settings_.slackQuadraticWeight);
+      data.z.setConstant(numSlacks, settings_.slackLinearWeight);
+      data.ls.setZero(numSlacks);
+    }
+  }
+
+  /** Stores the dual solution of each stage of the QP solved by the IPM, together with the dimensions that determine its layout. */
+  void storeWarmStart() {
+    const auto& dim = ipmDim();
+    const auto& sol = ipmSol();
+    warmStart_.resize(dim.N + 1);
+    for (int k = 0; k <= dim.N; k++) {
+      auto& node = warmStart_[k];
+      node.numInputBox = dim.nbu[k];
+      node.numStateBox = dim.nbx[k];
+      node.numGeneral = dim.ng[k];
+      node.numSlack = dim.ns[k];
+      const int numDuals = 2 * (node.numInputBox + node.numStateBox + node.numGeneral + node.numSlack);
+      node.lam = Eigen::Map<const vector_t>(sol.lam[k].pa, numDuals);
+      node.t = Eigen::Map<const vector_t>(sol.t[k].pa, numDuals);
+      if (k < dim.N) {
+        node.pi = Eigen::Map<const vector_t>(sol.pi[k].pa, dim.nx[k + 1]);
+      }
+    }
+  }
+
+  /**
+   * Sets the initial guess of HPIPM from the stored (shifted) dual solution. The primal guess is zero: the problem is formulated in
+   * deviations from the linearization point, which already contains the previous primal solution. Stages whose constraint structure
+   * changed fall back to a centered initial guess.
+   */
+  void loadWarmStart() {
+    const auto& dim = ipmDim();
+    auto& sol = ipmSol();
+    const scalar_t centered = std::sqrt(settings_.mu0);
+    for (int k = 0; k <= dim.N; k++) {
+      const int numDuals = 2 * (dim.nbu[k] + dim.nbx[k] + dim.ng[k] + dim.ns[k]);
+      const bool hasNode = k < static_cast<int>(warmStart_.size());
+
+      Eigen::Map<vector_t>(sol.ux[k].pa, dim.nu[k] + dim.nx[k] + 2 * dim.ns[k]).setZero();
+
+      Eigen::Map<vector_t> lam(sol.lam[k].pa, numDuals);
+      Eigen::Map<vector_t> t(sol.t[k].pa, numDuals);
+      if (hasNode && warmStart_[k].numInputBox == dim.nbu[k] && warmStart_[k].numStateBox == dim.nbx[k] &&
+          warmStart_[k].numGeneral == dim.ng[k] && warmStart_[k].numSlack == dim.ns[k]) {
+        lam = warmStart_[k].lam;
+        t = warmStart_[k].t;
+      } else {
+        lam.setConstant(centered);
+        t.setConstant(centered);
+      }
+
+      if (k < dim.N) {
+        Eigen::Map<vector_t> pi(sol.pi[k].pa, dim.nx[k + 1]);
+        if (hasNode && warmStart_[k].pi.size() == pi.size()) {
+          pi = warmStart_[k].pi;
+        } else {
+          pi.setZero();
+        }
+      }
+    }
+  }
+
+  /**
+   * Backward Riccati recursion on the dynamics and cost of the last solved problem. Used with partial condensing, where HPIPM only holds
+   * the factorization of the condensed blocks. Constraints are not taken into account, it is therefore only used for problems without
+   * constraints (see solveUncondensedQp() otherwise). The stages k > 0 are read through the pointers passed to HPIPM, this data must be
+   * unchanged since the solve.
+   */
+  void updateRiccatiRecursion(const VectorFunctionLinearApproximation& dynamics0, const ScalarFunctionQuadraticApproximation& cost0) {
+    if (riccatiUpToDate_) {
+      return;
+    }
+    riccatiUpToDate_ = true;
+
+    using MatrixMap = Eigen::Map<const matrix_t>;
+    using VectorMap = Eigen::Map<const vector_t>;
+    const int N = ocpSize_.numStages;
+    const auto& nx = ocpSize_.numStates;
+    const auto& nu = ocpSize_.numInputs;
+    const auto& p = qpPointers_;
+
+    riccatiCostToGo_.resize(N + 1);
+    riccatiFeedback_.resize(N);
+    riccatiFeedforward_.resize(N);
+
+    // k = N
+    riccatiCostToGo_[N].f = 0.0;
+    riccatiCostToGo_[N].dfdxx = MatrixMap(p.Q[N], nx[N], nx[N]);
+    riccatiCostToGo_[N].dfdx = VectorMap(p.q[N], nx[N]);
+
+    // k = N-1 -> 1
+    for (int k = N - 1; k > 0; k--) {
+      riccatiStep(k, MatrixMap(p.A[k], nx[k + 1], nx[k]), MatrixMap(p.B[k], nx[k + 1], nu[k]), VectorMap(p.b[k], nx[k + 1]),
+                  MatrixMap(p.Q[k], nx[k], nx[k]), MatrixMap(p.S[k], nu[k], nx[k]), MatrixMap(p.R[k], nu[k], nu[k]),
+                  VectorMap(p.q[k], nx[k]), VectorMap(p.r[k], nu[k]));
+    }
+
+    // k = 0, the initial state is not a decision variable in HPIPM. Use the original stage instead.
+    riccatiStep(0, dynamics0.dfdx, dynamics0.dfdu, dynamics0.f, cost0.dfdxx, cost0.dfdux, cost0.dfduu, cost0.dfdx, cost0.dfdu);
+  }
+
+  /**
+   * Solves the uncondensed QP of the last solve once more, such that HPIPM holds the factorization of the original stages. Used with
+   * partial condensing when the problem has constraints, since their contribution to the Riccati factors at the solution is only known
+   * to the interior point method.
+   */
+  void solveUncondensedQp() {
+    if (riccatiUpToDate_) {
+      return;
+    }
+    riccatiUpToDate_ = true;
+
+    if (!uncondensedIpmInitialized_) {
+      uncondensedIpmInitialized_ = true;
+      const int ipm_arg_size = d_ocp_qp_ipm_arg_memsize(&dim_);
+      uncondensedArgMem_.reserve(ipm_arg_size);
+      d_ocp_qp_ipm_arg_create(&dim_, &uncondensedArg_, uncondensedArgMem_.get());
+      applySettings(settings_, uncondensedArg_);
+
+      const int ipm_size = d_ocp_qp_ipm_ws_memsize(&dim_, &uncondensedArg_);
+      uncondensedIpmMem_.reserve(ipm_size);
+      d_ocp_qp_ipm_ws_create(&dim_, &uncondensedArg_, &uncondensedWorkspace_, uncondensedIpmMem_.get());
+    }
+
+    d_ocp_qp_ipm_solve(&qp_, &qpSol_, &uncondensedArg_, &uncondensedWorkspace_);
+  }
+
+  /** Computes the feedback, feedforward and cost-to-go of stage k from the cost-to-go of stage k + 1 */
+  void riccatiStep(int k, const Eigen::Ref<const matrix_t>& A, const Eigen::Ref<const matrix_t>& B, const Eigen::Ref<const vector_t>& b,
+                   const Eigen::Ref<const matrix_t>& Q, const Eigen::Ref<const matrix_t>& S, const Eigen::Ref<const matrix_t>& R,
+                   const Eigen::Ref<const vector_t>& q, const Eigen::Ref<const vector_t>& r) {
+    const matrix_t& Sm = riccatiCostToGo_[k + 1].dfdxx;
+    const vector_t& sv = riccatiCostToGo_[k + 1].dfdx;
+
+    const matrix_t SmA = Sm * A;
+    vector_t svNext = sv;
+    svNext.noalias() += Sm * b;
+
+    auto& costToGo = riccatiCostToGo_[k];
+    costToGo.f = 0.0;
+    costToGo.dfdxx = Q;
+    costToGo.dfdxx.noalias() += A.transpose() * SmA;
+    costToGo.dfdx = q;
+    costToGo.dfdx.noalias() += A.transpose() * svNext;
+
+    // u = K * x + k, with K = -inv(H) * G and k = -inv(H) * g
+    matrix_t H = R;
+    H.noalias() += B.transpose() * Sm * B;
+    matrix_t G = S;
+    G.noalias() += B.transpose() * SmA;
+    vector_t g = r;
+    g.noalias() += B.transpose() * svNext;
+    const Eigen::LLT<matrix_t> HLlt(H);
+    riccatiFeedback_[k] = -HLlt.solve(G);
+    riccatiFeedforward_[k] = -HLlt.solve(g);
+    costToGo.dfdxx.noalias() += G.transpose() * riccatiFeedback_[k];
+    costToGo.dfdx.noalias() += G.transpose() * riccatiFeedforward_[k];
+  }
+
   bool getStateSolution(const vector_t& x0, vector_array_t& stateTrajectory) {
     stateTrajectory.resize(ocpSize_.numStages + 1);
     stateTrajectory.front() = x0;
@@ -328,15 +813,22 @@ class HpipmInterface::Impl {
   }
 
   matrix_array_t getRiccatiFeedback(const VectorFunctionLinearApproximation& dynamics0, const ScalarFunctionQuadraticApproximation& cost0) {
+    if (useCondensing_) {
+      if (!hasConstraints_) {
+        updateRiccatiRecursion(dynamics0, cost0);
+        return riccatiFeedback_;
+      }
+      solveUncondensedQp();
+    }
     const int N = ocpSize_.numStages;
     matrix_array_t RiccatiFeedback(N);
 
     // k = 0, state is not a decision variable. Reconstruct backward pass from k = 1
     matrix_t P1(ocpSize_.numStates[1], ocpSize_.numStates[1]);
-    d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, 1, P1.data());
+    d_ocp_qp_ipm_get_ric_P(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 1, P1.data());
 
     matrix_t Lr(ocpSize_.numInputs[0], ocpSize_.numInputs[0]);
-    d_ocp_qp_ipm_get_ric_Lr(&qp_, &arg_, &workspace_, 0, Lr.data());  // Lr matrix is lower triangular
+    d_ocp_qp_ipm_get_ric_Lr(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 0, Lr.data());  // Lr matrix is lower triangular
     LinearAlgebra::setTriangularMinimumEigenvalues(Lr);
 
     // RiccatiFeedback[0] = - (inv(Lr)^T * inv(Lr)) * (S0 + B0^T * P1 * A0)
@@ -353,11 +845,11 @@ class HpipmInterface::Impl {
       if (numInput > 0) {
         // RiccatiFeedback[k] = -(Ls * Lr.inverse()).transpose();
         Lr.resize(numInput, numInput);
-        d_ocp_qp_ipm_get_ric_Lr(&qp_, &arg_, &workspace_, k, Lr.data());  // Lr matrix is lower triangular
+        d_ocp_qp_ipm_get_ric_Lr(&qp_, &uncondensedArg(), &uncondensedWorkspace(), k, Lr.data());  // Lr matrix is lower triangular
         LinearAlgebra::setTriangularMinimumEigenvalues(Lr);
 
         Ls.resize(ocpSize_.numStates[k], numInput);
-        d_ocp_qp_ipm_get_ric_Ls(&qp_, &arg_, &workspace_, k, Ls.data());
+        d_ocp_qp_ipm_get_ric_Ls(&qp_, &uncondensedArg(), &uncondensedWorkspace(), k, Ls.data());
         RiccatiFeedback[k].noalias() = -Lr.triangularView<Eigen::Lower>().transpose().solve(Ls.transpose());
       }
     }
@@ -367,19 +859,26 @@ class HpipmInterface::Impl {
 
   vector_array_t getRiccatiFeedforward(const VectorFunctionLinearApproximation& dynamics0,
                                        const ScalarFunctionQuadraticApproximation& cost0) {
+    if (useCondensing_) {
+      if (!hasConstraints_) {
+        updateRiccatiRecursion(dynamics0, cost0);
+        return riccatiFeedforward_;
+      }
+      solveUncondensedQp();
+    }
     const int N = ocpSize_.numStages;
     vector_array_t RiccatiFeedforward(N);
 
     // k = 0, state is not a decision variable. Reconstruct backward pass from k = 1
     matrix_t P1(ocpSize_.numStates[1], ocpSize_.numStates[1]);
-    d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, 1, P1.data());
+    d_ocp_qp_ipm_get_ric_P(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 1, P1.data());
 
     matrix_t Lr(ocpSize_.numInputs[0], ocpSize_.numInputs[0]);
-    d_ocp_qp_ipm_get_ric_Lr(&qp_, &arg_, &workspace_, 0, Lr.data());
+    d_ocp_qp_ipm_get_ric_Lr(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 0, Lr.data());
     LinearAlgebra::setTriangularMinimumEigenvalues(Lr);
 
     vector_t p1(ocpSize_.numStates[1]);
-    d_ocp_qp_ipm_get_ric_p(&qp_, &arg_, &workspace_, 1, p1.data());
+    d_ocp_qp_ipm_get_ric_p(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 1, p1.data());
 
     // RiccatiFeedforward[0] = -(inv(Lr)^T * inv(Lr)) * (r0 + B0.transpose() * p1 + B0.transpose() * P1 * b0);
     RiccatiFeedforward[0] = -cost0.dfdu;
@@ -391,7 +890,7 @@ class HpipmInterface::Impl {
     // k > 0
     for (int k = 1; k < N; ++k) {
       RiccatiFeedforward[k].resize(ocpSize_.numInputs[k]);
-      d_ocp_qp_ipm_get_ric_k(&qp_, &arg_, &workspace_, k, RiccatiFeedforward[k].data());
+      d_ocp_qp_ipm_get_ric_k(&qp_, &uncondensedArg(), &uncondensedWorkspace(), k, RiccatiFeedforward[k].data());
     }
 
     return RiccatiFeedforward;
@@ -399,6 +898,13 @@ class HpipmInterface::Impl {
 
   std::vector<ScalarFunctionQuadraticApproximation> getRiccatiCostToGo(const VectorFunctionLinearApproximation& dynamics0,
                                                                        const ScalarFunctionQuadraticApproximation& cost0) {
+    if (useCondensing_) {
+      if (!hasConstraints_) {
+        updateRiccatiRecursion(dynamics0, cost0);
+        return riccatiCostToGo_;
+      }
+      solveUncondensedQp();
+    }
     /*
      * Note on notation: HPIPM uses P, p for the cost-to-go, where we use Sm, sv
      */
@@ -409,13 +915,13 @@ class HpipmInterface::Impl {
     for (int k = 1; k <= N; k++) {
       RiccatiCostToGo[k].dfdxx.resize(ocpSize_.numStates[k], ocpSize_.numStates[k]);
       RiccatiCostToGo[k].dfdx.resize(ocpSize_.numStates[k]);
-      d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, k, RiccatiCostToGo[k].dfdxx.data());
-      d_ocp_qp_ipm_get_ric_p(&qp_, &arg_, &workspace_, k, RiccatiCostToGo[k].dfdx.data());
+      d_ocp_qp_ipm_get_ric_P(&qp_, &uncondensedArg(), &uncondensedWorkspace(), k, RiccatiCostToGo[k].dfdxx.data());
+      d_ocp_qp_ipm_get_ric_p(&qp_, &uncondensedArg(), &uncondensedWorkspace(), k, RiccatiCostToGo[k].dfdx.data());
     }
 
     // k = 0
     matrix_t Lr0(ocpSize_.numInputs[0], ocpSize_.numInputs[0]);
-    d_ocp_qp_ipm_get_ric_Lr(&qp_, &arg_, &workspace_, 0, Lr0.data());
+    d_ocp_qp_ipm_get_ric_Lr(&qp_, &uncondensedArg(), &uncondensedWorkspace(), 0, Lr0.data());
     LinearAlgebra::setTriangularMinimumEigenvalues(Lr0);
 
     // Shorthand notation
@@ -503,9 +1009,49 @@ class HpipmInterface::Impl {
   }
 
  private:
+  /** Pointers to the problem data passed to HPIPM */
+  struct QpPointers {
+    std::vector<scalar_t*> A, B, b;
+    std::vector<scalar_t*> Q, S, R, q, r;
+    std::vector<scalar_t*> C, D, lg, ug;
+    std::vector<int*> idxbx, idxbu;
+    std::vector<scalar_t*> lbx, ubx, lbu, ubu;
+    std::vector<int*> idxs;
+    std::vector<scalar_t*> Z, z, ls;
+
+    /** Sets N + 1 nullptr's in all arrays, keeps the allocated memory */
+    void reset(int N) {
+      for (auto* pointers : {&A, &B, &b, &Q, &S, &R, &q, &r, &C, &D, &lg, &ug, &lbx, &ubx, &lbu, &ubu, &Z, &z, &ls}) {
+        pointers->assign(N + 1, nullptr);
+      }
+      for (auto* pointers : {&idxbx, &idxbu, &idxs}) {
+        pointers->assign(N + 1, nullptr);
+      }
+    }
+  };
+
+  /** Dual solution of a node, used to warm start the next solve */
+  struct NodeWarmStart {
+    int numInputBox = 0;
+    int numStateBox = 0;
+    int numGeneral = 0;
+    int numSlack = 0;
+    vector_t lam;  // Multipliers of all inequalities
+    vector_t t;    // Slacks of all inequalities
+    vector_t pi;   // Multipliers of the dynamics
+  };
+
   Settings settings_;
   OcpSize ocpSize_;
 
+  QpPointers qpPointers_;
+  vector_t b0_;
+  vector_t r0_;
+  std::vector<vector_t> boundData_;
+  std::vector<InequalityPartition> ineqPartitions_;
+  std::vector<NodeInequalities> ineqData_;
+  std::vector<NodeWarmStart> warmStart_;
+
   MemoryBlock dimMem_;
   d_ocp_qp_dim dim_;
 
@@ -520,6 +1066,41 @@ class HpipmInterface::Impl {
 
   MemoryBlock ipmMem_;
   d_ocp_qp_ipm_ws workspace_;
+
+  // Partial condensing
+  bool useCondensing_ = false;
+  std::vector<int> blockSize_;
+
+  MemoryBlock condensedDimMem_;
+  d_ocp_qp_dim condensedDim_;
+
+  MemoryBlock condensedQpMem_;
+  d_ocp_qp condensedQp_;
+
+  MemoryBlock condensedQpSolMem_;
+  d_ocp_qp_sol condensedQpSol_;
+
+  MemoryBlock condensingArgMem_;
+  d_part_cond_qp_arg condensingArg_;
+
+  MemoryBlock condensingMem_;
+  d_part_cond_qp_ws condensingWorkspace_;
+
+  // IPM of the uncondensed QP, only used for the Riccati quantities of constrained problems when condensing
+  bool hasConstraints_ = false;
+  bool uncondensedIpmInitialized_ = false;
+
+  MemoryBlock uncondensedArgMem_;
+  d_ocp_qp_ipm_arg uncondensedArg_;
+
+  MemoryBlock uncondensedIpmMem_;
+  d_ocp_qp_ipm_ws uncondensedWorkspace_;
+
+  // Riccati recursion of the uncondensed problem, only computed when condensing a problem without constraints
+  bool riccatiUpToDate_ = false;
+  matrix_array_t riccatiFeedback_;
+  vector_array_t riccatiFeedforward_;
+  std::vector<ScalarFunctionQuadraticApproximation> riccatiCostToGo_;
 };
 
 HpipmInterface::HpipmInterface(OcpSize ocpSize, const Settings& settings)
@@ -529,13 +1110,39 @@ HpipmInterface::~HpipmInterface() = default;
 
 void HpipmInterface::resize(OcpSize ocpSize) {
   pImpl_->initializeMemory(std::move(ocpSize));
+  pImpl_->setInequalityPartitions({});
+}
+
+void HpipmInterface::resize(OcpSize ocpSize, std::vector<InequalityPartition> ineqPartitions) {
+  pImpl_->initializeMemory(std::move(ocpSize));
+  pImpl_->setInequalityPartitions(std::move(ineqPartitions));
 }
 
 hpipm_status HpipmInterface::solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                                    std::vector<ScalarFunctionQuadraticApproximation>& cost,
                                    std::vector<VectorFunctionLinearApproximation>* constraints, vector_array_t& stateTrajectory,
                                    vector_array_t& inputTrajectory, bool verbose) {
-  return pImpl_->solve(x0, dynamics, cost, constraints, stateTrajectory, inputTrajectory, verbose);
+  return pImpl_->solve(x0, dynamics, cost, constraints, nullptr, stateTrajectory, inputTrajectory, verbose);
+}
+
+hpipm_status HpipmInterface::solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                   std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                                   std::vector<VectorFunctionLinearApproximation>* constraints,
+                                   std::vector<VectorFunctionLinearApproximation>* ineqConstraints, vector_array_t& stateTrajectory,
+                                   vector_array_t& inputTrajectory, bool verbose) {
+  return pImpl_->solve(x0, dynamics, cost, constraints, ineqConstraints, stateTrajectory, inputTrajectory, verbose);
+}
+
+void HpipmInterface::shiftWarmStart(int numStages) {
+  pImpl_->shiftWarmStart(numStages);
+}
+
+void HpipmInterface::resetWarmStart() {
+  pImpl_->resetWarmStart();
+}
+
+int HpipmInterface::getNumIterations() const {
+  return pImpl_->getNumIterations();
 }
 
 std::vector<ScalarFunctionQuadraticApproximation> HpipmInterface::getRiccatiCostToGo(const VectorFunctionLinearApproximation& dynamics0,
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "hpipm_catkin/OcpSize.h"
 
+#include <algorithm>
+
 namespace ocs2 {
 namespace hpipm_interface {
 
@@ -46,9 +48,122 @@ bool operator==(const OcpSize& lhs, const OcpSize& rhs) noexcept {
   return same;
 }
 
+namespace {
+/** Row types of an inequality constraint. Box rows are encoded by their variable: the input index, or the number of inputs + state index */
+constexpr int emptyRow = -1;
+constexpr int generalRow = -2;
+
+std::vector<int> getRowTypes(const VectorFunctionLinearApproximation& ineqConstraint, bool withStates) {
+  const int numRows = ineqConstraint.f.size();
+  const int numInputs = ineqConstraint.dfdu.cols();
+  const int numStates = withStates ? ineqConstraint.dfdx.cols() : 0;
+
+  std::vector<int> rowTypes(numRows, emptyRow);
+  for (int row = 0; row < numRows; row++) {
+    int numNonZeros = 0;
+    for (int j = 0; j < numInputs && numNonZeros < 2; j++) {
+      if (ineqConstraint.dfdu(row, j) != 0.0) {
+        ++numNonZeros;
+        rowTypes[row] = j;
+      }
+    }
+    for (int j = 0; j < numStates && numNonZeros < 2; j++) {
+      if (ineqConstraint.dfdx(row, j) != 0.0) {
+        ++numNonZeros;
+        rowTypes[row] = numInputs + j;
+      }
+    }
+    if (numNonZeros > 1) {
+      rowTypes[row] = generalRow;
+    }
+  }
+  return rowTypes;
+}
+
+std::vector<int> getRowTypes(const InequalityPartition& partition, int numInputs) {
+  std::vector<int> rowTypes(partition.numRows, emptyRow);
+  for (const auto& rowAndIndex : partition.inputBoxRows) {
+    rowTypes[rowAndIndex.first] = rowAndIndex.second;
+  }
+  for (const auto& rowAndIndex : partition.stateBoxRows) {
+    rowTypes[rowAndIndex.first] = numInputs + rowAndIndex.second;
+  }
+  for (const auto row : partition.generalRows) {
+    rowTypes[row] = generalRow;
+  }
+  return rowTypes;
+}
+
+InequalityPartition getPartition(const std::vector<int>& rowTypes, int numInputs) {
+  InequalityPartition partition;
+  partition.numRows = rowTypes.size();
+  for (int row = 0; row < partition.numRows; row++) {
+    const int rowType = rowTypes[row];
+    if (rowType == generalRow) {
+      partition.generalRows.push_back(row);
+    } else if (rowType >= numInputs) {
+      partition.stateBoxRows.emplace_back(row, rowType - numInputs);
+      partition.stateBoxIndices.push_back(rowType - numInputs);
+    } else if (rowType >= 0) {
+      partition.inputBoxRows.emplace_back(row, rowType);
+      partition.inputBoxIndices.push_back(rowType);
+    }
+  }
+
+  // Merge bounds on the same variable
+  auto sortUnique = [](std::vector<int>& indices) {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  };
+  sortUnique(partition.inputBoxIndices);
+  sortUnique(partition.stateBoxIndices);
+
+  return partition;
+}
+}  // namespace
+
+InequalityPartition partitionInequalityConstraint(const VectorFunctionLinearApproximation& ineqConstraint, bool withStates) {
+  return getPartition(getRowTypes(ineqConstraint, withStates), ineqConstraint.dfdu.cols());
+}
+
+void updateInequalityPartition(const VectorFunctionLinearApproximation& ineqConstraint, InequalityPartition& partition, bool withStates) {
+  const int numInputs = ineqConstraint.dfdu.cols();
+  auto rowTypes = getRowTypes(ineqConstraint, withStates);
+  if (static_cast<int>(rowTypes.size()) == partition.numRows) {
+    // A row only moves from empty to box to general, a coefficient that vanishes does not change the structure
+    const auto previousRowTypes = getRowTypes(partition, numInputs);
+    for (int row = 0; row < partition.numRows; row++) {
+      if (rowTypes[row] == emptyRow) {
+        rowTypes[row] = previousRowTypes[row];
+      } else if (previousRowTypes[row] != emptyRow && previousRowTypes[row] != rowTypes[row]) {
+        rowTypes[row] = generalRow;
+      }
+    }
+  }
+  partition = getPartition(rowTypes, numInputs);
+}
+
+OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                                const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                const std::vector<VectorFunctionLinearApproximation>* ineqConstraints, bool softenIneqConstraints) {
+  if (ineqConstraints == nullptr) {
+    return extractSizesFromProblem(dynamics, cost, constraints, std::vector<InequalityPartition>(), softenIneqConstraints);
+  }
+
+  // The initial state is not a decision variable
+  std::vector<InequalityPartition> ineqPartitions;
+  ineqPartitions.reserve(ineqConstraints->size());
+  for (size_t k = 0; k < ineqConstraints->size(); k++) {
+    ineqPartitions.push_back(partitionInequalityConstraint((*ineqConstraints)[k], k > 0));
+  }
+  return extractSizesFromProblem(dynamics, cost, constraints, ineqPartitions, softenIneqConstraints);
+}
+
 OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
                                 const std::vector<ScalarFunctionQuadraticApproximation>& cost,
-                                const std::vector<VectorFunctionLinearApproximation>* constraints) {
+                                const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                const std::vector<InequalityPartition>& ineqPartitions, bool softenIneqConstraints) {
   const int numStages = dynamics.size();
 
   OcpSize problemSize(dynamics.size());
@@ -68,6 +183,19 @@ OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximat
     }
   }
 
+  // Inequality constraints
+  for (size_t k = 0; k < ineqPartitions.size(); k++) {
+    const auto& partition = ineqPartitions[k];
+    problemSize.numInputBoxConstraints[k] = partition.inputBoxIndices.size();
+    problemSize.numStateBoxConstraints[k] = partition.stateBoxIndices.size();
+    problemSize.numIneqConstraints[k] += partition.generalRows.size();
+    if (softenIneqConstraints) {
+      problemSize.numInputBoxSlack[k] = partition.inputBoxIndices.size();
+      problemSize.numStateBoxSlack[k] = partition.stateBoxIndices.size();
+      problemSize.numIneqSlack[k] = partition.generalRows.size();
+    }
+  }
+
   return problemSize;
 }
 
@@ -56,7 +56,7 @@ TEST(test_hpiphm_interface, solve_and_check_dynamic) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Initial condition
@@ -93,11 +93,11 @@ TEST(test_hpiphm_interface, solve_after_resize) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, false);
 
   // Solve again!
   hpipmInterface.resize(ocpSize);
-  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Initial condition
@@ -143,7 +143,7 @@ TEST(test_hpiphm_interface, knownSolution) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  const auto status = hpipmInterface.solve(xSolGiven[0], system, cost, nullptr, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(xSolGiven[0], system, cost, nullptr, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Check!
@@ -186,7 +186,7 @@ TEST(test_hpiphm_interface, with_constraints) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  const auto status = hpipmInterface.solve(x0, system, cost, &constraints, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(x0, system, cost, &constraints, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Initial condition
@@ -247,7 +247,7 @@ TEST(test_hpiphm_interface, noInputs) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  const auto status = hpipmInterface.solve(xSolGiven.front(), system, cost, nullptr, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(xSolGiven.front(), system, cost, nullptr, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Check!
@@ -310,7 +310,7 @@ TEST(test_hpiphm_interface, retrieveRiccati) {
   // Solve!
   std::vector<ocs2::vector_t> xSol;
   std::vector<ocs2::vector_t> uSol;
-  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  const auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, false);
   ASSERT_EQ(status, hpipm_status::SUCCESS);
 
   // Get Riccati info from hpipm interface
@@ -338,3 +338,386 @@ TEST(test_hpiphm_interface, retrieveRiccati) {
     ASSERT_TRUE(uSol[k].isApprox(KSol[k] * xSol[k] + kSol[k]));
   }
 }
+
+TEST(test_hpiphm_interface, partitionInequalityConstraint) {
+  int nx = 2;
+  int nu = 2;
+
+  // Rows: u0 >= -1, u0 <= 1, x1 >= -1, u0 + u1 >= 0, x0 + u1 >= 0, constant row
+  auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(6, nx, nu);
+  ineq.dfdu(0, 0) = 1.0;
+  ineq.dfdu(1, 0) = -1.0;
+  ineq.dfdx(2, 1) = 1.0;
+  ineq.dfdu(3, 0) = 1.0;
+  ineq.dfdu(3, 1) = 1.0;
+  ineq.dfdx(4, 0) = 1.0;
+  ineq.dfdu(4, 1) = 1.0;
+
+  const auto partition = ocs2::hpipm_interface::partitionInequalityConstraint(ineq);
+  ASSERT_EQ(partition.inputBoxIndices, std::vector<int>({0}));
+  ASSERT_EQ(partition.stateBoxIndices, std::vector<int>({1}));
+  ASSERT_EQ(partition.inputBoxRows.size(), 2);
+  ASSERT_EQ(partition.stateBoxRows.size(), 1);
+  ASSERT_EQ(partition.generalRows, std::vector<int>({3, 4}));
+
+  // Without states, the state dependency is constant
+  const auto partitionWithoutStates = ocs2::hpipm_interface::partitionInequalityConstraint(ineq, false);
+  ASSERT_EQ(partitionWithoutStates.inputBoxIndices, std::vector<int>({0, 1}));
+  ASSERT_TRUE(partitionWithoutStates.stateBoxIndices.empty());
+  ASSERT_EQ(partitionWithoutStates.generalRows, std::vector<int>({3}));
+}
+
+TEST(test_hpiphm_interface, updateInequalityPartition) {
+  int nx = 2;
+  int nu = 2;
+
+  // Rows: u0 >= -1, x1 >= -1, u0 + u1 >= 0, constant row
+  auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(4, nx, nu);
+  ineq.dfdu(0, 0) = 1.0;
+  ineq.dfdx(1, 1) = 1.0;
+  ineq.dfdu(2, 0) = 1.0;
+  ineq.dfdu(2, 1) = 1.0;
+  auto partition = ocs2::hpipm_interface::partitionInequalityConstraint(ineq);
+
+  // Vanishing coefficients do not change the partition
+  auto ineqVanishing = ineq;
+  ineqVanishing.dfdu(0, 0) = 0.0;
+  ineqVanishing.dfdu(2, 1) = 0.0;
+  ocs2::hpipm_interface::updateInequalityPartition(ineqVanishing, partition);
+  ASSERT_EQ(partition.numRows, 4);
+  ASSERT_EQ(partition.inputBoxIndices, std::vector<int>({0}));
+  ASSERT_EQ(partition.stateBoxIndices, std::vector<int>({1}));
+  ASSERT_EQ(partition.generalRows, std::vector<int>({2}));
+
+  // New nonzero coefficients move rows from ignored to box and from box to general
+  auto ineqDense = ineq;
+  ineqDense.dfdx(1, 0) = 1.0;
+  ineqDense.dfdu(3, 1) = 1.0;
+  ocs2::hpipm_interface::updateInequalityPartition(ineqDense, partition);
+  ASSERT_EQ(partition.inputBoxIndices, std::vector<int>({0, 1}));
+  ASSERT_TRUE(partition.stateBoxIndices.empty());
+  ASSERT_EQ(partition.generalRows, std::vector<int>({1, 2}));
+
+  // A box row acting on another variable becomes general, it is not moved back
+  auto ineqOtherVariable = ineq;
+  ineqOtherVariable.dfdu(0, 0) = 0.0;
+  ineqOtherVariable.dfdu(0, 1) = 1.0;
+  ocs2::hpipm_interface::updateInequalityPartition(ineqOtherVariable, partition);
+  ocs2::hpipm_interface::updateInequalityPartition(ineq, partition);
+  ASSERT_EQ(partition.inputBoxIndices, std::vector<int>({1}));
+  ASSERT_EQ(partition.generalRows, std::vector<int>({0, 1, 2}));
+
+  // Changing the number of rows starts a new partition
+  ocs2::hpipm_interface::updateInequalityPartition(ocs2::VectorFunctionLinearApproximation::Zero(1, nx, nu), partition);
+  ASSERT_EQ(partition.numRows, 1);
+  ASSERT_TRUE(partition.inputBoxRows.empty());
+  ASSERT_TRUE(partition.stateBoxRows.empty());
+  ASSERT_TRUE(partition.generalRows.empty());
+}
+
+TEST(test_hpiphm_interface, with_inequality_constraints) {
+  int nx = 3;
+  int nu = 2;
+  int N = 5;
+  const ocs2::scalar_t inputBound = 0.1;
+
+  // Problem setup
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> ineqConstraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    cost.back().dfdu.setConstant(10.0);  // Push the unconstrained solution against the bounds
+
+    // |u_i| <= inputBound, u_0 + u_1 >= -inputBound, x_0 <= 100
+    auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(2 * nu + 2, nx, nu);
+    for (int i = 0; i < nu; i++) {
+      ineq.dfdu(2 * i, i) = 1.0;
+      ineq.dfdu(2 * i + 1, i) = -1.0;
+      ineq.f.segment(2 * i, 2).setConstant(inputBound);
+    }
+    ineq.dfdu.row(2 * nu).setOnes();
+    ineq.f(2 * nu) = inputBound;
+    ineq.dfdx(2 * nu + 1, 0) = -1.0;
+    ineq.f(2 * nu + 1) = 100.0;
+    ineqConstraints.push_back(std::move(ineq));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ineqConstraints.emplace_back(ocs2::VectorFunctionLinearApproximation::Zero(0, nx, 0));
+
+  // Check hard and soft constraints
+  for (bool soft : {false, true}) {
+    ocs2::HpipmInterface hpipmInterface;
+    const auto ocpSize = ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, &ineqConstraints, soft);
+    ASSERT_EQ(ocpSize.numInputBoxConstraints[1], nu);
+    ASSERT_EQ(ocpSize.numStateBoxConstraints[1], 1);
+    ASSERT_EQ(ocpSize.numIneqConstraints[1], 1);
+    ASSERT_EQ(ocpSize.numIneqSlack[1], soft ? 1 : 0);
+    hpipmInterface.resize(ocpSize);
+
+    // Solve!
+    std::vector<ocs2::vector_t> xSol;
+    std::vector<ocs2::vector_t> uSol;
+    const auto status = hpipmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol, false);
+    ASSERT_EQ(status, hpipm_status::SUCCESS);
+
+    // Initial condition
+    ASSERT_TRUE(xSol[0].isApprox(x0));
+
+    // Check dynamic feasibility
+    for (int k = 0; k < N; k++) {
+      ASSERT_TRUE(xSol[k + 1].isApprox(system[k].dfdx * xSol[k] + system[k].dfdu * uSol[k] + system[k].f, 1e-9));
+    }
+
+    // Check inequality constraints, slacks may only relax them for the soft case
+    const ocs2::scalar_t tol = soft ? inputBound : 1e-6;
+    for (int k = 0; k < N; k++) {
+      const ocs2::vector_t h = ineqConstraints[k].f + ineqConstraints[k].dfdx * xSol[k] + ineqConstraints[k].dfdu * uSol[k];
+      ASSERT_GE(h.minCoeff(), -tol);
+    }
+  }
+}
+
+TEST(test_hpiphm_interface, boxConstraintBounds) {
+  int nx = 2;
+  int nu = 1;
+  int N = 3;
+
+  // Problem setup with u >= -0.1 and u <= 0.1
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> ineqConstraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(2, nx, nu);
+    ineq.dfdu << 1.0, -1.0;
+    ineq.f.setConstant(0.1);
+    ineqConstraints.push_back(std::move(ineq));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ineqConstraints.emplace_back(ocs2::VectorFunctionLinearApproximation::Zero(0, nx, 0));
+
+  std::vector<ocs2::HpipmInterface::InequalityPartition> partitions;
+  for (int k = 0; k <= N; k++) {
+    partitions.push_back(ocs2::hpipm_interface::partitionInequalityConstraint(ineqConstraints[k], k > 0));
+  }
+  ocs2::HpipmInterface hpipmInterface;
+  hpipmInterface.resize(ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, partitions, false), partitions);
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+
+  // The upper bound vanishes at this linearization, only the lower bound remains
+  cost[1].dfdu.setConstant(100.0);
+  ineqConstraints[1].dfdu(1, 0) = 0.0;
+  ASSERT_EQ(hpipmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol, false), hpipm_status::SUCCESS);
+  ASSERT_NEAR(uSol[1](0), -0.1, 1e-6);
+
+  // Inconsistent bounds are rejected for hard constraints
+  ineqConstraints[1].dfdu(1, 0) = -1.0;
+  ineqConstraints[1].f(1) = -1.0;
+  ASSERT_THROW(hpipmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol, false), std::runtime_error);
+
+  // and relaxed by the slacks of soft constraints
+  hpipmInterface.resize(ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, partitions, true), partitions);
+  ASSERT_EQ(hpipmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol, false), hpipm_status::SUCCESS);
+}
+
+TEST(test_hpiphm_interface, warmStart) {
+  int nx = 3;
+  int nu = 2;
+  int N = 5;
+
+  // Problem setup with input bounds
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> ineqConstraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(nu, nx, nu);
+    ineq.dfdu.setIdentity();
+    ineq.f.setConstant(0.1);
+    ineqConstraints.push_back(std::move(ineq));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ineqConstraints.emplace_back(ocs2::VectorFunctionLinearApproximation::Zero(0, nx, 0));
+  const auto ocpSize = ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, &ineqConstraints);
+
+  // Cold start reference
+  ocs2::HpipmInterface coldInterface(ocpSize);
+  std::vector<ocs2::vector_t> xSolCold;
+  std::vector<ocs2::vector_t> uSolCold;
+  ASSERT_EQ(coldInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSolCold, uSolCold), hpipm_status::SUCCESS);
+
+  // Warm start from itself, from a shifted solution, and after a reset
+  ocs2::HpipmInterface::Settings settings;
+  settings.warm_start = 2;
+  ocs2::HpipmInterface warmInterface(ocpSize, settings);
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+  for (int shift : {0, 0, 1, -1}) {
+    if (shift < 0) {
+      warmInterface.resetWarmStart();
+    } else {
+      warmInterface.shiftWarmStart(shift);
+    }
+    ASSERT_EQ(warmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol), hpipm_status::SUCCESS);
+    ASSERT_TRUE(ocs2::isEqual(xSolCold, xSol, 1e-6));
+    ASSERT_TRUE(ocs2::isEqual(uSolCold, uSol, 1e-6));
+  }
+}
+
+TEST(test_hpiphm_interface, warmStartIterations) {
+  int nx = 3;
+  int nu = 2;
+  int N = 10;
+
+  // Problem setup with input bounds
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> ineqConstraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(nu, nx, nu);
+    ineq.dfdu.setIdentity();
+    ineq.f.setConstant(0.1);
+    ineqConstraints.push_back(std::move(ineq));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ineqConstraints.emplace_back(ocs2::VectorFunctionLinearApproximation::Zero(0, nx, 0));
+  const auto ocpSize = ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, &ineqConstraints);
+
+  ocs2::HpipmInterface::Settings settings;
+  settings.warm_start = 2;
+  ocs2::HpipmInterface warmInterface(ocpSize, settings);
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+  ASSERT_EQ(warmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol), hpipm_status::SUCCESS);
+
+  // Pose the QP in deviations from its solution, as the next SQP iteration does. Its solution is zero.
+  for (int k = 0; k < N; k++) {
+    system[k].f += system[k].dfdx * xSol[k] + system[k].dfdu * uSol[k] - xSol[k + 1];
+    cost[k].dfdx += cost[k].dfdxx * xSol[k] + cost[k].dfdux.transpose() * uSol[k];
+    cost[k].dfdu += cost[k].dfduu * uSol[k] + cost[k].dfdux * xSol[k];
+    ineqConstraints[k].f += ineqConstraints[k].dfdx * xSol[k] + ineqConstraints[k].dfdu * uSol[k];
+  }
+  cost[N].dfdx += cost[N].dfdxx * xSol[N];
+  const ocs2::vector_t dx0 = ocs2::vector_t::Zero(nx);
+
+  // Cold start reference
+  ocs2::HpipmInterface coldInterface(ocpSize);
+  std::vector<ocs2::vector_t> xSolCold;
+  std::vector<ocs2::vector_t> uSolCold;
+  ASSERT_EQ(coldInterface.solve(dx0, system, cost, nullptr, &ineqConstraints, xSolCold, uSolCold), hpipm_status::SUCCESS);
+
+  // The warm start from the previous dual solution needs fewer iterations
+  ASSERT_EQ(warmInterface.solve(dx0, system, cost, nullptr, &ineqConstraints, xSol, uSol), hpipm_status::SUCCESS);
+  ASSERT_TRUE(ocs2::isEqual(xSolCold, xSol, 1e-6));
+  ASSERT_TRUE(ocs2::isEqual(uSolCold, uSol, 1e-6));
+  EXPECT_LT(warmInterface.getNumIterations(), coldInterface.getNumIterations());
+}
+
+TEST(test_hpiphm_interface, partialCondensing) {
+  int nx = 3;
+  int nu = 2;
+  int N = 10;
+
+  // Problem setup
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ocs2::HpipmInterface::OcpSize ocpSize(N, nx, nu);
+
+  // Reference without condensing
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+  std::vector<ocs2::vector_t> xSolGiven;
+  std::vector<ocs2::vector_t> uSolGiven;
+  ASSERT_EQ(hpipmInterface.solve(x0, system, cost, nullptr, xSolGiven, uSolGiven), hpipm_status::SUCCESS);
+  const auto KSolGiven = hpipmInterface.getRiccatiFeedback(system[0], cost[0]);
+  const auto kSolGiven = hpipmInterface.getRiccatiFeedforward(system[0], cost[0]);
+  const auto costToGoGiven = hpipmInterface.getRiccatiCostToGo(system[0], cost[0]);
+
+  // Block sizes that divide the horizon, that don't, and that condense everything
+  for (int blockSize : {2, 3, 10}) {
+    ocs2::HpipmInterface::Settings settings;
+    settings.partialCondensingBlockSize = blockSize;
+    ocs2::HpipmInterface condensedInterface(ocpSize, settings);
+    std::vector<ocs2::vector_t> xSol;
+    std::vector<ocs2::vector_t> uSol;
+    ASSERT_EQ(condensedInterface.solve(x0, system, cost, nullptr, xSol, uSol), hpipm_status::SUCCESS);
+    ASSERT_TRUE(ocs2::isEqual(xSolGiven, xSol, 1e-9));
+    ASSERT_TRUE(ocs2::isEqual(uSolGiven, uSol, 1e-9));
+
+    ASSERT_TRUE(ocs2::isEqual(KSolGiven, condensedInterface.getRiccatiFeedback(system[0], cost[0]), 1e-9));
+    ASSERT_TRUE(ocs2::isEqual(kSolGiven, condensedInterface.getRiccatiFeedforward(system[0], cost[0]), 1e-9));
+    const auto costToGo = condensedInterface.getRiccatiCostToGo(system[0], cost[0]);
+    for (int k = 0; k <= N; k++) {
+      ASSERT_TRUE(costToGoGiven[k].dfdxx.isApprox(costToGo[k].dfdxx, 1e-9));
+      ASSERT_TRUE(costToGoGiven[k].dfdx.isApprox(costToGo[k].dfdx, 1e-9));
+    }
+  }
+}
+
+TEST(test_hpiphm_interface, partialCondensingWithConstraints) {
+  int nx = 3;
+  int nu = 2;
+  int N = 10;
+
+  // Problem setup with input bounds that are active in part of the horizon
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> ineqConstraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    auto ineq = ocs2::VectorFunctionLinearApproximation::Zero(nu, nx, nu);
+    ineq.dfdu.setIdentity();
+    ineq.f.setConstant(0.1);
+    ineqConstraints.push_back(std::move(ineq));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  ineqConstraints.emplace_back(ocs2::VectorFunctionLinearApproximation::Zero(0, nx, 0));
+  const auto ocpSize = ocs2::hpipm_interface::extractSizesFromProblem(system, cost, nullptr, &ineqConstraints);
+
+  // Reference without condensing
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+  std::vector<ocs2::vector_t> xSolGiven;
+  std::vector<ocs2::vector_t> uSolGiven;
+  ASSERT_EQ(hpipmInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSolGiven, uSolGiven), hpipm_status::SUCCESS);
+  const auto KSolGiven = hpipmInterface.getRiccatiFeedback(system[0], cost[0]);
+  const auto kSolGiven = hpipmInterface.getRiccatiFeedforward(system[0], cost[0]);
+  const auto costToGoGiven = hpipmInterface.getRiccatiCostToGo(system[0], cost[0]);
+
+  for (int blockSize : {2, 3}) {
+    ocs2::HpipmInterface::Settings settings;
+    settings.partialCondensingBlockSize = blockSize;
+    ocs2::HpipmInterface condensedInterface(ocpSize, settings);
+    std::vector<ocs2::vector_t> xSol;
+    std::vector<ocs2::vector_t> uSol;
+    ASSERT_EQ(condensedInterface.solve(x0, system, cost, nullptr, &ineqConstraints, xSol, uSol), hpipm_status::SUCCESS);
+    ASSERT_TRUE(ocs2::isEqual(xSolGiven, xSol, 1e-6));
+    ASSERT_TRUE(ocs2::isEqual(uSolGiven, uSol, 1e-6));
+
+    // The feedback accounts for the constraints, as without condensing
+    ASSERT_TRUE(ocs2::isEqual(KSolGiven, condensedInterface.getRiccatiFeedback(system[0], cost[0]), 1e-9));
+    ASSERT_TRUE(ocs2::isEqual(kSolGiven, condensedInterface.getRiccatiFeedforward(system[0], cost[0]), 1e-9));
+    const auto costToGo = condensedInterface.getRiccatiCostToGo(system[0], cost[0]);
+    for (int k = 0; k <= N; k++) {
+      ASSERT_TRUE(costToGoGiven[k].dfdxx.isApprox(costToGo[k].dfdxx, 1e-9));
+      ASSERT_TRUE(costToGoGiven[k].dfdx.isApprox(costToGo[k].dfdx, 1e-9));
+    }
+  }
+}
@@ -59,4 +59,14 @@ VectorFunctionLinearApproximation qrConstraintProjection(const VectorFunctionLin
  */
 VectorFunctionLinearApproximation luConstraintProjection(const VectorFunctionLinearApproximation& constraint);
 
+/**
+ * In-place version of luConstraintProjection. The decomposition and the projection reuse their memory when the sizes do not change.
+ *
+ * @param constraint : C = dfdx, D = dfdu, e = f;
+ * @param lu : Storage for the LU decomposition of D.
+ * @param [out] projection : Px = dfdx, Pu = dfdu, Pe = f;
+ */
+void luConstraintProjection(const VectorFunctionLinearApproximation& constraint, Eigen::FullPivLU<matrix_t>& lu,
+                            VectorFunctionLinearApproximation& projection);
+
 }  // namespace ocs2
\ No newline at end of file
@@ -64,6 +64,13 @@ class MultipleShootingMpc final : public MPC_BASE {
     solverPtr_->run(initTime, initState, finalTime);
   }
 
+  void prepareController(scalar_t initTime, scalar_t finalTime) override {
+    // A cold start discards the previous solution the preparation is based on.
+    if (!settings().coldStart_) {
+      solverPtr_->prepare(initTime, finalTime);
+    }
+  }
+
  private:
   std::unique_ptr<MultipleShootingSolver> solverPtr_;
 };
@@ -43,9 +43,13 @@ struct Settings {
   scalar_t deltaTol = 1e-6;  // Termination condition : RMS update of x(t) and u(t) are both below this value
   scalar_t costTol = 1e-4;   // Termination condition : (cost{i+1} - (cost{i}) < costTol AND constraints{i+1} < g_min
 
+  // Real-time iteration: a single full SQP step per run, linearized in MultipleShootingSolver::prepare() before the state is known.
+  bool realTimeIteration = false;
+
   // Linesearch - step size rules
-  scalar_t alpha_decay = 0.5;  // multiply the step size by this factor every time a linesearch step is rejected.
-  scalar_t alpha_min = 1e-4;   // terminate linesearch if the attempted step size is below this threshold
+  scalar_t alpha_decay = 0.5;      // multiply the step size by this factor every time a linesearch step is rejected.
+  scalar_t alpha_min = 1e-4;       // terminate linesearch if the attempted step size is below this threshold
+  size_t linesearchBatchSize = 1;  // number of consecutive step sizes evaluated concurrently, the first acceptable one is taken
 
   // Linesearch - step acceptance criteria with c = costs, g = the norm of constraint violation, and w = [x; u]
   scalar_t g_max = 1e6;          // (1): IF g{i+1} > g_max REQUIRE g{i+1} < (1-gamma_c) * g{i}
@@ -68,6 +72,7 @@ struct Settings {
   scalar_t inequalityConstraintMu = 0.0;
   scalar_t inequalityConstraintDelta = 1e-6;
   bool projectStateInputEqualityConstraints = true;  // Use a projection method to resolve the state-input constraint Cx+Du+e
+  bool softInequalityConstraints = false;  // Add slacks to the inequality constraints, penalized with the hpipmSettings slack weights
 
   // Printing
   bool printSolverStatus = false;      // Print HPIPM status after solving the QP subproblem
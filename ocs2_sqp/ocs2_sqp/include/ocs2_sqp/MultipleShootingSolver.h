@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/MultipleShootingSettings.h"
 #include "ocs2_sqp/MultipleShootingSolverStatus.h"
+#include "ocs2_sqp/MultipleShootingTranscription.h"
 #include "ocs2_sqp/TimeDiscretization.h"
 
 namespace ocs2 {
@@ -82,6 +83,17 @@ class MultipleShootingSolver : public SolverBase {
     throw std::runtime_error("[MultipleShootingSolver] getStateInputEqualityConstraintLagrangian() not available yet.");
   }
 
+  /**
+   * Preparation phase of a real-time iteration (Settings::realTimeIteration). Linearizes the problem around the previous solution shifted
+   * to initTime, before the state at that time is known. The next run() at the same initTime then only solves the QP for the measured
+   * state (feedback phase). The references are the ones of the previous run. Does nothing without a previous solution, in which case the
+   * next run() does both phases.
+   *
+   * @param [in] initTime: Initial time of the next run.
+   * @param [in] finalTime: Final time of the next run.
+   */
+  void prepare(scalar_t initTime, scalar_t finalTime);
+
  private:
   void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override;
 
@@ -103,8 +115,17 @@ class MultipleShootingSolver : public SolverBase {
     runImpl(initTime, initState, finalTime);
   }
 
-  /** Run a task in parallel with settings.nThreads */
-  void runParallel(std::function<void(int)> taskFunction);
+  /** Linearizes the problem around the (shifted) previous solution for a real-time iteration */
+  void prepareRealTimeIteration(const std::vector<AnnotatedTime>& timeDiscretization, const vector_t& initState);
+
+  /** Solves the prepared QP for the given initial state, takes a full step and updates the primal solution */
+  void feedbackRealTimeIteration(const vector_t& initState);
+
+  /** Shifts the QP warm start to the new initial time, based on the time discretization of the previous solution */
+  void shiftQpWarmStart(scalar_t initTime);
+
+  /** Run loopBody(workerId, i) for all i in [0, N) in parallel with settings.nThreads */
+  void parallelFor(int N, std::function<void(int, int)> loopBody);
 
   /** Get profiling information as a string */
   std::string getBenchmarkingInformation() const;
@@ -117,9 +138,9 @@ class MultipleShootingSolver : public SolverBase {
   PerformanceIndex setupQuadraticSubproblem(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
                                             const vector_array_t& u);
 
-  /** Computes only the performance metrics at the current {t, x(t), u(t)} */
-  PerformanceIndex computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
-                                      const vector_array_t& u);
+  /** Computes the performance metrics of a single node */
+  PerformanceIndex computeNodePerformance(OptimalControlProblem& ocpDefinition, const std::vector<AnnotatedTime>& time, int i,
+                                          const vector_array_t& x, const vector_array_t& u);
 
   /** Returns solution of the QP subproblem in delta coordinates: */
   struct OcpSubproblemSolution {
@@ -135,6 +156,15 @@ class MultipleShootingSolver : public SolverBase {
   /** Set up the primal solution based on the optimized state and input trajectories */
   void setPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u);
 
+  /**
+   * Computes the candidate trajectories {x(t) + a*dx(t), u(t) + a*du(t)} for all given step sizes a in candidateStates_ and
+   * candidateInputs_, and evaluates them concurrently. Returns the performance of each candidate.
+   */
+  const std::vector<PerformanceIndex>& computeStepPerformances(const std::vector<scalar_t>& stepSizes,
+                                                               const std::vector<AnnotatedTime>& time, const vector_t& initState,
+                                                               const vector_array_t& x, const vector_array_t& u,
+                                                               const OcpSubproblemSolution& subproblemSolution);
+
   /** Compute 2-norm of the trajectory: sqrt(sum_i v[i]^2)  */
   static scalar_t trajectoryNorm(const vector_array_t& v);
 
@@ -150,11 +180,18 @@ class MultipleShootingSolver : public SolverBase {
   multiple_shooting::Convergence checkConvergence(int iteration, const PerformanceIndex& baseline,
                                                   const multiple_shooting::StepInfo& stepInfo) const;
 
+  /**
+   * Predicts the duration of an iteration followed by the computation of the controller from the benchmarking timers.
+   * @return The predicted duration in milliseconds.
+   */
+  scalar_t predictIterationDuration() const;
+
   // Problem definition
   Settings settings_;
   DynamicsDiscretizer discretizer_;
-  DynamicsSensitivityDiscretizer sensitivityDiscretizer_;
+  DynamicsSensitivityDiscretizerInPlace sensitivityDiscretizer_;
   std::vector<OptimalControlProblem> ocpDefinitions_;
+  std::vector<multiple_shooting::TranscriptionWorkspace> transcriptionWorkspaces_;
   std::unique_ptr<Initializer> initializerPtr_;
 
   // Threading
@@ -174,6 +211,24 @@ class MultipleShootingSolver : public SolverBase {
   std::vector<ScalarFunctionQuadraticApproximation> cost_;
   std::vector<VectorFunctionLinearApproximation> constraints_;
   std::vector<VectorFunctionLinearApproximation> constraintsProjection_;
+  std::vector<VectorFunctionLinearApproximation> inequalityConstraints_;
+  std::vector<hpipm_interface::InequalityPartition> inequalityPartitions_;  // Box and general rows of the inequality constraints
+
+  // Real-time iteration, linearization prepared for the next run
+  struct RealTimeIterationData {
+    bool isPrepared = false;
+    std::vector<AnnotatedTime> timeDiscretization;
+    vector_array_t x;
+    vector_array_t u;
+    PerformanceIndex performance;
+  };
+  RealTimeIterationData realTimeIteration_;
+
+  // Linesearch candidates
+  std::vector<vector_array_t> candidateStates_;
+  std::vector<vector_array_t> candidateInputs_;
+  std::vector<PerformanceIndex> nodePerformances_;
+  std::vector<PerformanceIndex> stepPerformances_;
 
   // Iteration performance log
   std::vector<PerformanceIndex> performanceIndeces_;
@@ -46,6 +46,7 @@ struct Transcription {
   ScalarFunctionQuadraticApproximation cost;
   VectorFunctionLinearApproximation constraints;
   VectorFunctionLinearApproximation constraintsProjection;
+  VectorFunctionLinearApproximation inequalityConstraints;
 };
 
 /**
@@ -65,6 +66,44 @@ Transcription setupIntermediateNode(const OptimalControlProblem& optimalControlP
                                     DynamicsSensitivityDiscretizer& sensitivityDiscretizer, bool projectStateInputEqualityConstraints,
                                     scalar_t t, scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u);
 
+/**
+ * Memory used during the transcription of an intermediate node. One workspace per worker is reused across nodes and iterations.
+ */
+struct TranscriptionWorkspace {
+  SensitivityDiscretizationWorkspace sensitivityDiscretization;
+  VectorFunctionLinearApproximation equalityConstraints;
+  Eigen::FullPivLU<matrix_t> constraintDecomposition;
+};
+
+/**
+ * In-place version of setupIntermediateNode. The results are written into the given approximations, whose memory is reused when the
+ * sizes do not change. Approximations that do not apply to this node are cleared.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param sensitivityDiscretizer : In-place integrator to use for creating the discrete dynamics.
+ * @param projectStateInputEqualityConstraints
+ * @param t : Start of the discrete interval
+ * @param dt : Duration of the interval
+ * @param x : State at start of the interval
+ * @param x_next : State at the end of the interval
+ * @param u : Input, taken to be constant across the interval.
+ * @param workspace : Memory for intermediate results.
+ * @param [out] dynamics : Linearized discrete dynamics.
+ * @param [out] cost : Quadratic approximation of the cost.
+ * @param [out] constraints : Linearized equality constraints, empty if they are projected.
+ * @param [out] constraintsProjection : Projection of the equality constraints, empty if they are not projected.
+ * @param [out] inequalityConstraints : Linearized inequality constraints.
+ * @return performance index of this node.
+ */
+PerformanceIndex setupIntermediateNode(const OptimalControlProblem& optimalControlProblem,
+                                       DynamicsSensitivityDiscretizerInPlace& sensitivityDiscretizer,
+                                       bool projectStateInputEqualityConstraints, scalar_t t, scalar_t dt, const vector_t& x,
+                                       const vector_t& x_next, const vector_t& u, TranscriptionWorkspace& workspace,
+                                       VectorFunctionLinearApproximation& dynamics, ScalarFunctionQuadraticApproximation& cost,
+                                       VectorFunctionLinearApproximation& constraints,
+                                       VectorFunctionLinearApproximation& constraintsProjection,
+                                       VectorFunctionLinearApproximation& inequalityConstraints);
+
 /**
  * Compute only the performance index for a single intermediate node.
  * Corresponds to the performance index returned by "setupIntermediateNode"
@@ -91,6 +130,20 @@ struct TerminalTranscription {
  */
 TerminalTranscription setupTerminalNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x);
 
+/**
+ * In-place version of setupTerminalNode. The results are written into the given approximations, whose memory is reused when the sizes
+ * do not change.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the terminal node
+ * @param x : Terminal state
+ * @param [out] cost : Quadratic approximation of the final cost.
+ * @param [out] constraints : Linearized terminal constraints.
+ * @return performance index of the terminal node.
+ */
+PerformanceIndex setupTerminalNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x,
+                                   ScalarFunctionQuadraticApproximation& cost, VectorFunctionLinearApproximation& constraints);
+
 /**
  * Compute only the performance index for the terminal node.
  * Corresponds to the performance index returned by "setTerminalNode"
@@ -119,6 +172,23 @@ struct EventTranscription {
 EventTranscription setupEventNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x,
                                   const vector_t& x_next);
 
+/**
+ * In-place version of setupEventNode. The results are written into the given approximations, whose memory is reused when the sizes do
+ * not change.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the event node
+ * @param x : Pre-event state
+ * @param x_next : Post-event state
+ * @param [out] dynamics : Linearized jump map.
+ * @param [out] cost : Quadratic approximation of the pre-jump cost.
+ * @param [out] constraints : Linearized event constraints.
+ * @return performance index of the event node.
+ */
+PerformanceIndex setupEventNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next,
+                                VectorFunctionLinearApproximation& dynamics, ScalarFunctionQuadraticApproximation& cost,
+                                VectorFunctionLinearApproximation& constraints);
+
 /**
  * Compute only the performance index for the event node.
  * Corresponds to the performance index returned by "setupEventNode"
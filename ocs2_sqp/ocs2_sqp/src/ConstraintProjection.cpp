@@ -53,15 +53,20 @@ VectorFunctionLinearApproximation qrConstraintProjection(const VectorFunctionLin
 }
 
 VectorFunctionLinearApproximation luConstraintProjection(const VectorFunctionLinearApproximation& constraint) {
-  // Constraint Projectors are based on the LU decomposition
-  const Eigen::FullPivLU<matrix_t> lu(constraint.dfdu);
-
+  Eigen::FullPivLU<matrix_t> lu;
   VectorFunctionLinearApproximation projectionTerms;
-  projectionTerms.dfdu = lu.kernel();
-  projectionTerms.dfdx.noalias() = -lu.solve(constraint.dfdx);
-  projectionTerms.f.noalias() = -lu.solve(constraint.f);
-
+  luConstraintProjection(constraint, lu, projectionTerms);
   return projectionTerms;
 }
 
+void luConstraintProjection(const VectorFunctionLinearApproximation& constraint, Eigen::FullPivLU<matrix_t>& lu,
+                            VectorFunctionLinearApproximation& projection) {
+  // Constraint Projectors are based on the LU decomposition
+  lu.compute(constraint.dfdu);
+
+  projection.dfdu = lu.kernel();
+  projection.dfdx.noalias() = -lu.solve(constraint.dfdx);
+  projection.f.noalias() = -lu.solve(constraint.f);
+}
+
 }  // namespace ocs2
\ No newline at end of file
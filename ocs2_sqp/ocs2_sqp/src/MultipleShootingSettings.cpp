@@ -52,11 +52,13 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.deltaTol, fieldName + ".deltaTol", verbose);
   loadData::loadPtreeValue(pt, settings.alpha_decay, fieldName + ".alpha_decay", verbose);
   loadData::loadPtreeValue(pt, settings.alpha_min, fieldName + ".alpha_min", verbose);
+  loadData::loadPtreeValue(pt, settings.linesearchBatchSize, fieldName + ".linesearchBatchSize", verbose);
   loadData::loadPtreeValue(pt, settings.gamma_c, fieldName + ".gamma_c", verbose);
   loadData::loadPtreeValue(pt, settings.g_max, fieldName + ".g_max", verbose);
   loadData::loadPtreeValue(pt, settings.g_min, fieldName + ".g_min", verbose);
   loadData::loadPtreeValue(pt, settings.armijoFactor, fieldName + ".armijoFactor", verbose);
   loadData::loadPtreeValue(pt, settings.costTol, fieldName + ".costTol", verbose);
+  loadData::loadPtreeValue(pt, settings.realTimeIteration, fieldName + ".realTimeIteration", verbose);
   loadData::loadPtreeValue(pt, settings.dt, fieldName + ".dt", verbose);
   loadData::loadPtreeValue(pt, settings.useFeedbackPolicy, fieldName + ".useFeedbackPolicy", verbose);
   loadData::loadPtreeValue(pt, settings.createValueFunction, fieldName + ".createValueFunction", verbose);
@@ -66,6 +68,7 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.inequalityConstraintMu, fieldName + ".inequalityConstraintMu", verbose);
   loadData::loadPtreeValue(pt, settings.inequalityConstraintDelta, fieldName + ".inequalityConstraintDelta", verbose);
   loadData::loadPtreeValue(pt, settings.projectStateInputEqualityConstraints, fieldName + ".projectStateInputEqualityConstraints", verbose);
+  loadData::loadPtreeValue(pt, settings.softInequalityConstraints, fieldName + ".softInequalityConstraints", verbose);
   loadData::loadPtreeValue(pt, settings.printSolverStatus, fieldName + ".printSolverStatus", verbose);
   loadData::loadPtreeValue(pt, settings.printSolverStatistics, fieldName + ".printSolverStatistics", verbose);
   loadData::loadPtreeValue(pt, settings.printLinesearch, fieldName + ".printLinesearch", verbose);
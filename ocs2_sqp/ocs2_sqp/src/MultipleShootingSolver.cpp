@@ -29,7 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/MultipleShootingSolver.h"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 
 #include <ocs2_core/control/FeedforwardController.h>
@@ -52,12 +54,13 @@ MultipleShootingSolver::MultipleShootingSolver(Settings settings, const OptimalC
 
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings.integratorType);
-  sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings.integratorType);
+  sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretizationInPlace(settings.integratorType);
 
   // Clone objects to have one for each worker
   for (int w = 0; w < settings.nThreads; w++) {
     ocpDefinitions_.push_back(optimalControlProblem);
   }
+  transcriptionWorkspaces_.resize(settings.nThreads);
 
   // Operating points
   initializerPtr_.reset(initializer.clone());
@@ -86,6 +89,11 @@ void MultipleShootingSolver::reset() {
   solveQpTimer_.reset();
   linesearchTimer_.reset();
   computeControllerTimer_.reset();
+
+  // clear warm start of the QP solver
+  hpipmInterface_.resetWarmStart();
+  inequalityPartitions_.clear();
+  realTimeIteration_ = RealTimeIterationData();
 }
 
 std::string MultipleShootingSolver::getBenchmarkingInformation() const {
@@ -154,10 +162,33 @@ void MultipleShootingSolver::runImpl(scalar_t initTime, const vector_t& initStat
   const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
   const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
 
+  if (settings_.realTimeIteration) {
+    // The prepared linearization can only be used if the horizon and the events did not change since the preparation.
+    const auto& prepared = realTimeIteration_.timeDiscretization;
+    const bool matchesPreparation =
+        realTimeIteration_.isPrepared && timeDiscretization.size() == prepared.size() &&
+        std::equal(timeDiscretization.begin(), timeDiscretization.end(), prepared.begin(),
+                   [](const AnnotatedTime& lhs, const AnnotatedTime& rhs) { return lhs.time == rhs.time && lhs.event == rhs.event; });
+    if (!matchesPreparation) {
+      prepareRealTimeIteration(timeDiscretization, initState);
+    }
+    feedbackRealTimeIteration(initState);
+
+    if (settings_.printSolverStatus || settings_.printLinesearch) {
+      std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++";
+      std::cerr << "\n+++++++++++++ SQP solver has terminated ++++++++++++++";
+      std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
+    }
+    return;
+  }
+
   // Initialize the state and input
   vector_array_t x, u;
   initializeStateInputTrajectories(initState, timeDiscretization, x, u);
 
+  // Align the warm start of the QP solver with the shifted horizon
+  shiftQpWarmStart(initTime);
+
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
     const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
@@ -213,8 +244,84 @@ void MultipleShootingSolver::runImpl(scalar_t initTime, const vector_t& initStat
   }
 }
 
-void MultipleShootingSolver::runParallel(std::function<void(int)> taskFunction) {
-  threadPool_.runParallel(std::move(taskFunction), settings_.nThreads);
+void MultipleShootingSolver::prepare(scalar_t initTime, scalar_t finalTime) {
+  realTimeIteration_.isPrepared = false;
+  if (!settings_.realTimeIteration || primalSolution_.timeTrajectory_.empty()) {
+    return;
+  }
+
+  // The state at initTime is not known yet, the previous solution provides the linearization point.
+  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
+  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
+  const vector_t initStateGuess =
+      LinearInterpolation::interpolate(initTime, primalSolution_.timeTrajectory_, primalSolution_.stateTrajectory_);
+  prepareRealTimeIteration(timeDiscretization, initStateGuess);
+}
+
+void MultipleShootingSolver::prepareRealTimeIteration(const std::vector<AnnotatedTime>& timeDiscretization, const vector_t& initState) {
+  auto& data = realTimeIteration_;
+  data.timeDiscretization = timeDiscretization;
+  initializeStateInputTrajectories(initState, timeDiscretization, data.x, data.u);
+
+  // Initialize references
+  for (auto& ocpDefinition : ocpDefinitions_) {
+    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
+    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+  }
+
+  // Make QP approximation
+  linearQuadraticApproximationTimer_.startTimer();
+  data.performance = setupQuadraticSubproblem(timeDiscretization, initState, data.x, data.u);
+  linearQuadraticApproximationTimer_.endTimer();
+  data.isPrepared = true;
+}
+
+void MultipleShootingSolver::feedbackRealTimeIteration(const vector_t& initState) {
+  auto& data = realTimeIteration_;
+
+  // Solve QP, only the initial state changed since the preparation
+  solveQpTimer_.startTimer();
+  shiftQpWarmStart(data.timeDiscretization.front().time);
+  const vector_t delta_x0 = initState - data.x[0];
+  const auto deltaSolution = getOCPSolution(delta_x0);
+  extractValueFunction(data.timeDiscretization, data.x);
+  solveQpTimer_.endTimer();
+
+  // Full step, without linesearch. Log the performance at the linearization point, the new point is not evaluated.
+  linesearchTimer_.startTimer();
+  for (int i = 0; i < data.u.size(); i++) {
+    if (deltaSolution.deltaUSol[i].size() > 0) {  // account for absence of inputs at events.
+      data.u[i] += deltaSolution.deltaUSol[i];
+    }
+  }
+  for (int i = 0; i < data.x.size(); i++) {
+    data.x[i] += deltaSolution.deltaXSol[i];
+  }
+  performanceIndeces_.clear();
+  performanceIndeces_.push_back(data.performance);
+  linesearchTimer_.endTimer();
+  ++totalNumIterations_;
+
+  computeControllerTimer_.startTimer();
+  setPrimalSolution(data.timeDiscretization, std::move(data.x), std::move(data.u));
+  computeControllerTimer_.endTimer();
+
+  ++numProblems_;
+  data.isPrepared = false;
+}
+
+void MultipleShootingSolver::shiftQpWarmStart(scalar_t initTime) {
+  if (settings_.hpipmSettings.warm_start == 2 && !primalSolution_.timeTrajectory_.empty()) {
+    const auto& previousTime = primalSolution_.timeTrajectory_;
+    const auto firstNodeAfterInitTime = std::upper_bound(previousTime.begin(), previousTime.end(), initTime);
+    const int numShiftedStages = static_cast<int>(std::distance(previousTime.begin(), firstNodeAfterInitTime)) - 1;
+    hpipmInterface_.shiftWarmStart(std::max(numShiftedStages, 0));
+  }
+}
+
+void MultipleShootingSolver::parallelFor(int N, std::function<void(int, int)> loopBody) {
+  constexpr int grainSize = 1;
+  threadPool_.parallelFor(0, N, grainSize, loopBody);
 }
 
 void MultipleShootingSolver::initializeStateInputTrajectories(const vector_t& initState,
@@ -270,15 +377,25 @@ MultipleShootingSolver::OcpSubproblemSolution MultipleShootingSolver::getOCPSolu
   OcpSubproblemSolution solution;
   auto& deltaXSol = solution.deltaXSol;
   auto& deltaUSol = solution.deltaUSol;
-  hpipm_status status;
   const bool hasStateInputConstraints = !ocpDefinitions_.front().equalityConstraintPtr->empty();
-  if (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) {
-    hpipmInterface_.resize(hpipm_interface::extractSizesFromProblem(dynamics_, cost_, &constraints_));
-    status = hpipmInterface_.solve(delta_x0, dynamics_, cost_, &constraints_, deltaXSol, deltaUSol, settings_.printSolverStatus);
-  } else {  // without constraints, or when using projection, we have an unconstrained QP.
-    hpipmInterface_.resize(hpipm_interface::extractSizesFromProblem(dynamics_, cost_, nullptr));
-    status = hpipmInterface_.solve(delta_x0, dynamics_, cost_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
+  const bool hasInequalityConstraints = !ocpDefinitions_.front().inequalityConstraintPtr->empty();
+  // without equality constraints, or when using projection, the equality constraints do not enter the QP.
+  auto* constraintsPtr = (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) ? &constraints_ : nullptr;
+  auto* inequalityConstraintsPtr = hasInequalityConstraints ? &inequalityConstraints_ : nullptr;
+  if (hasInequalityConstraints) {
+    // The partition into box and general constraints is kept over the iterations, it only grows with the nonzero coefficients
+    inequalityPartitions_.resize(inequalityConstraints_.size());
+    for (size_t i = 0; i < inequalityConstraints_.size(); i++) {
+      hpipm_interface::updateInequalityPartition(inequalityConstraints_[i], inequalityPartitions_[i], i > 0);
+    }
+    hpipmInterface_.resize(hpipm_interface::extractSizesFromProblem(dynamics_, cost_, constraintsPtr, inequalityPartitions_,
+                                                                    settings_.softInequalityConstraints),
+                           inequalityPartitions_);
+  } else {
+    hpipmInterface_.resize(hpipm_interface::extractSizesFromProblem(dynamics_, cost_, constraintsPtr));
   }
+  const auto status = hpipmInterface_.solve(delta_x0, dynamics_, cost_, constraintsPtr, inequalityConstraintsPtr, deltaXSol, deltaUSol,
+                                            settings_.printSolverStatus);
 
   if (status != hpipm_status::SUCCESS) {
     throw std::runtime_error("[MultipleShootingSolver] Failed to solve QP");
@@ -387,111 +504,120 @@ PerformanceIndex MultipleShootingSolver::setupQuadraticSubproblem(const std::vec
   // Problem horizon
   const int N = static_cast<int>(time.size()) - 1;
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
+  std::vector<PerformanceIndex> performance(N + 1, PerformanceIndex());
   dynamics_.resize(N);
   cost_.resize(N + 1);
   constraints_.resize(N + 1);
   constraintsProjection_.resize(N);
+  inequalityConstraints_.resize(N + 1);
 
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  const bool projection = settings_.projectStateInputEqualityConstraints;
+  parallelFor(N + 1, [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
-    PerformanceIndex workerPerformance;  // Accumulate performance in local variable
-    const bool projection = settings_.projectStateInputEqualityConstraints;
-
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        workerPerformance += result.performance;
-        dynamics_[i] = std::move(result.dynamics);
-        cost_[i] = std::move(result.cost);
-        constraints_[i] = std::move(result.constraints);
-        constraintsProjection_[i] = VectorFunctionLinearApproximation::Zero(0, x[i].size(), 0);
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        auto result =
-            multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, projection, ti, dt, x[i], x[i + 1], u[i]);
-        workerPerformance += result.performance;
-        dynamics_[i] = std::move(result.dynamics);
-        cost_[i] = std::move(result.cost);
-        constraints_[i] = std::move(result.constraints);
-        constraintsProjection_[i] = std::move(result.constraintsProjection);
-      }
 
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
-      auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
-      workerPerformance += result.performance;
-      cost_[i] = std::move(result.cost);
-      constraints_[i] = std::move(result.constraints);
+      performance[i] = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N], cost_[i], constraints_[i]);
+      inequalityConstraints_[i].setZero(0, x[i].size(), 0);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      performance[i] =
+          multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1], dynamics_[i], cost_[i], constraints_[i]);
+      constraintsProjection_[i].setZero(0, x[i].size(), 0);
+      inequalityConstraints_[i].setZero(0, x[i].size(), 0);
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      // Writes into the approximations of the previous iteration to reuse their memory
+      performance[i] = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, projection, ti, dt, x[i], x[i + 1],
+                                                                u[i], transcriptionWorkspaces_[workerId], dynamics_[i], cost_[i],
+                                                                constraints_[i], constraintsProjection_[i], inequalityConstraints_[i]);
     }
-
-    // Accumulate! Same worker might run multiple tasks
-    performance[workerId] += workerPerformance;
-  };
-  runParallel(std::move(parallelTask));
+  });
 
   // Account for init state in performance
   performance.front().dynamicsViolationSSE += (initState - x.front()).squaredNorm();
 
-  // Sum performance of the threads
+  // Sum performance of the nodes in order, such that the result does not depend on the number of threads
   PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
   totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.inequalityLagrangian;
   return totalPerformance;
 }
 
-PerformanceIndex MultipleShootingSolver::computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState,
-                                                            const vector_array_t& x, const vector_array_t& u) {
-  // Problem horizon
+PerformanceIndex MultipleShootingSolver::computeNodePerformance(OptimalControlProblem& ocpDefinition,
+                                                                const std::vector<AnnotatedTime>& time, int i, const vector_array_t& x,
+                                                                const vector_array_t& u) {
   const int N = static_cast<int>(time.size()) - 1;
+  if (i == N) {
+    // Terminal node
+    const scalar_t tN = getIntervalStart(time[N]);
+    return multiple_shooting::computeTerminalPerformance(ocpDefinition, tN, x[N]);
+  } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+    // Event node
+    return multiple_shooting::computeEventPerformance(ocpDefinition, time[i].time, x[i], x[i + 1]);
+  } else {
+    // Normal, intermediate node
+    const scalar_t ti = getIntervalStart(time[i]);
+    const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+    return multiple_shooting::computeIntermediatePerformance(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
+  }
+}
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
-    // Get worker specific resources
-    OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
-    PerformanceIndex workerPerformance;  // Accumulate performance in local variable
+const std::vector<PerformanceIndex>& MultipleShootingSolver::computeStepPerformances(const std::vector<scalar_t>& stepSizes,
+                                                                                     const std::vector<AnnotatedTime>& time,
+                                                                                     const vector_t& initState, const vector_array_t& x,
+                                                                                     const vector_array_t& u,
+                                                                                     const OcpSubproblemSolution& subproblemSolution) {
+  const int N = static_cast<int>(time.size()) - 1;
+  const int numCandidates = static_cast<int>(stepSizes.size());
+  const auto& dx = subproblemSolution.deltaXSol;
+  const auto& du = subproblemSolution.deltaUSol;
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        workerPerformance += multiple_shooting::computeEventPerformance(ocpDefinition, time[i].time, x[i], x[i + 1]);
+  // Candidate trajectories, the buffers are kept across iterations to reuse their memory
+  if (candidateStates_.size() < numCandidates) {
+    candidateStates_.resize(numCandidates);
+    candidateInputs_.resize(numCandidates);
+  }
+  parallelFor(numCandidates, [&](int workerId, int j) {
+    auto& xNew = candidateStates_[j];
+    auto& uNew = candidateInputs_[j];
+    xNew.resize(x.size());
+    uNew.resize(u.size());
+    for (int i = 0; i < u.size(); i++) {
+      if (du[i].size() > 0) {  // account for absence of inputs at events.
+        uNew[i] = u[i] + stepSizes[j] * du[i];
       } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        workerPerformance += multiple_shooting::computeIntermediatePerformance(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
+        uNew[i].resize(0);
       }
-
-      i = timeIndex++;
     }
-
-    if (i == N) {  // Only one worker will execute this
-      const scalar_t tN = getIntervalStart(time[N]);
-      workerPerformance += multiple_shooting::computeTerminalPerformance(ocpDefinition, tN, x[N]);
+    for (int i = 0; i < x.size(); i++) {
+      xNew[i] = x[i] + stepSizes[j] * dx[i];
     }
-
-    // Accumulate! Same worker might run multiple tasks
-    performance[workerId] += workerPerformance;
-  };
-  runParallel(std::move(parallelTask));
-
-  // Account for init state in performance
-  performance.front().dynamicsViolationSSE += (initState - x.front()).squaredNorm();
-
-  // Sum performance of the threads
-  PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
-  totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.inequalityLagrangian;
-  return totalPerformance;
+  });
+
+  // Evaluate all nodes of all candidates concurrently
+  nodePerformances_.resize(numCandidates * (N + 1));
+  parallelFor(numCandidates * (N + 1), [&](int workerId, int task) {
+    const int j = task / (N + 1);
+    const int i = task % (N + 1);
+    nodePerformances_[task] = computeNodePerformance(ocpDefinitions_[workerId], time, i, candidateStates_[j], candidateInputs_[j]);
+  });
+
+  // Sum in node order, such that the result does not depend on how the nodes were distributed over the workers
+  stepPerformances_.resize(numCandidates);
+  for (int j = 0; j < numCandidates; j++) {
+    auto& performance = stepPerformances_[j];
+    performance = nodePerformances_[j * (N + 1)];
+    for (int i = 1; i <= N; i++) {
+      performance += nodePerformances_[j * (N + 1) + i];
+    }
+    performance.dynamicsViolationSSE += (initState - candidateStates_[j].front()).squaredNorm();
+    performance.merit = performance.cost + performance.equalityLagrangian + performance.inequalityLagrangian;
+  }
+  return stepPerformances_;
 }
 
 scalar_t MultipleShootingSolver::trajectoryNorm(const vector_array_t& v) {
@@ -503,7 +629,7 @@ scalar_t MultipleShootingSolver::trajectoryNorm(const vector_array_t& v) {
 }
 
 scalar_t MultipleShootingSolver::totalConstraintViolation(const PerformanceIndex& performance) const {
-  return std::sqrt(performance.dynamicsViolationSSE + performance.equalityConstraintsSSE);
+  return std::sqrt(performance.dynamicsViolationSSE + performance.equalityConstraintsSSE + performance.inequalityConstraintsSSE);
 }
 
 multiple_shooting::StepInfo MultipleShootingSolver::takeStep(const PerformanceIndex& baseline,
@@ -535,71 +661,82 @@ multiple_shooting::StepInfo MultipleShootingSolver::takeStep(const PerformanceIn
   // Prepare step info
   multiple_shooting::StepInfo stepInfo;
 
+  // Step acceptance and record step type
+  auto isStepAccepted = [&](scalar_t alpha, const PerformanceIndex& performanceNew, scalar_t newConstraintViolation) {
+    if (newConstraintViolation > settings_.g_max) {
+      // High constraint violation. Only accept decrease in constraints.
+      stepInfo.stepType = StepType::CONSTRAINT;
+      return newConstraintViolation < ((1.0 - settings_.gamma_c) * baselineConstraintViolation);
+    } else if (newConstraintViolation < settings_.g_min && baselineConstraintViolation < settings_.g_min &&
+               subproblemSolution.armijoDescentMetric < 0.0) {
+      // With low violation and having a descent direction, require the armijo condition.
+      stepInfo.stepType = StepType::COST;
+      return performanceNew.merit < (baseline.merit + settings_.armijoFactor * alpha * subproblemSolution.armijoDescentMetric);
+    } else {
+      // Medium violation: either merit or constraints decrease (with small gamma_c mixing of old constraints)
+      stepInfo.stepType = StepType::DUAL;
+      return performanceNew.merit < (baseline.merit - settings_.gamma_c * baselineConstraintViolation) ||
+             newConstraintViolation < ((1.0 - settings_.gamma_c) * baselineConstraintViolation);
+    }
+  };
+
+  // Step sizes that the sequential backtracking would try after a rejection of alpha
+  auto isTooSmall = [&](scalar_t alpha) {
+    return alpha < settings_.alpha_min || (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol);
+  };
+
+  const size_t batchSize = std::max(settings_.linesearchBatchSize, size_t(1));
+  std::vector<scalar_t> stepSizes;
+  stepSizes.reserve(batchSize);
   scalar_t alpha = 1.0;
-  vector_array_t xNew(x.size());
-  vector_array_t uNew(u.size());
   do {
-    // Compute step
-    for (int i = 0; i < u.size(); i++) {
-      if (du[i].size() > 0) {  // account for absence of inputs at events.
-        uNew[i] = u[i] + alpha * du[i];
-      }
-    }
-    for (int i = 0; i < x.size(); i++) {
-      xNew[i] = x[i] + alpha * dx[i];
+    // Evaluate a batch of consecutive step sizes at once, then accept the first one in the order of the sequential backtracking
+    stepSizes.clear();
+    stepSizes.push_back(alpha);
+    while (stepSizes.size() < batchSize && !isTooSmall(stepSizes.back() * settings_.alpha_decay)) {
+      stepSizes.push_back(stepSizes.back() * settings_.alpha_decay);
     }
 
-    // Compute cost and constraints
-    const PerformanceIndex performanceNew = computePerformance(timeDiscretization, initState, xNew, uNew);
-    const scalar_t newConstraintViolation = totalConstraintViolation(performanceNew);
-
-    // Step acceptance and record step type
-    const bool stepAccepted = [&]() {
-      if (newConstraintViolation > settings_.g_max) {
-        // High constraint violation. Only accept decrease in constraints.
-        stepInfo.stepType = StepType::CONSTRAINT;
-        return newConstraintViolation < ((1.0 - settings_.gamma_c) * baselineConstraintViolation);
-      } else if (newConstraintViolation < settings_.g_min && baselineConstraintViolation < settings_.g_min &&
-                 subproblemSolution.armijoDescentMetric < 0.0) {
-        // With low violation and having a descent direction, require the armijo condition.
-        stepInfo.stepType = StepType::COST;
-        return performanceNew.merit < (baseline.merit + settings_.armijoFactor * alpha * subproblemSolution.armijoDescentMetric);
-      } else {
-        // Medium violation: either merit or constraints decrease (with small gamma_c mixing of old constraints)
-        stepInfo.stepType = StepType::DUAL;
-        return performanceNew.merit < (baseline.merit - settings_.gamma_c * baselineConstraintViolation) ||
-               newConstraintViolation < ((1.0 - settings_.gamma_c) * baselineConstraintViolation);
+    // Compute step, cost and constraints
+    const auto& performances = computeStepPerformances(stepSizes, timeDiscretization, initState, x, u, subproblemSolution);
+
+    for (size_t j = 0; j < stepSizes.size(); j++) {
+      alpha = stepSizes[j];
+      const PerformanceIndex& performanceNew = performances[j];
+      const scalar_t newConstraintViolation = totalConstraintViolation(performanceNew);
+      const bool stepAccepted = isStepAccepted(alpha, performanceNew, newConstraintViolation);
+
+      if (settings_.printLinesearch) {
+        std::cerr << "Step size: " << alpha << ", Step Type: " << toString(stepInfo.stepType)
+                  << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
+        std::cerr << "|dx| = " << alpha * deltaXnorm << "\t|du| = " << alpha * deltaUnorm << "\n";
+        std::cerr << performanceNew << "\n";
       }
-    }();
 
-    if (settings_.printLinesearch) {
-      std::cerr << "Step size: " << alpha << ", Step Type: " << toString(stepInfo.stepType)
-                << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
-      std::cerr << "|dx| = " << alpha * deltaXnorm << "\t|du| = " << alpha * deltaUnorm << "\n";
-      std::cerr << performanceNew << "\n";
+      if (stepAccepted) {  // Return if step accepted
+        // Swap, such that the candidate buffer keeps the memory of the old trajectory
+        x.swap(candidateStates_[j]);
+        u.swap(candidateInputs_[j]);
+
+        stepInfo.stepSize = alpha;
+        stepInfo.dx_norm = alpha * deltaXnorm;
+        stepInfo.du_norm = alpha * deltaUnorm;
+        stepInfo.performanceAfterStep = performanceNew;
+        stepInfo.totalConstraintViolationAfterStep = newConstraintViolation;
+        return stepInfo;
+      }
     }
 
-    if (stepAccepted) {  // Return if step accepted
-      x = std::move(xNew);
-      u = std::move(uNew);
-
-      stepInfo.stepSize = alpha;
-      stepInfo.dx_norm = alpha * deltaXnorm;
-      stepInfo.du_norm = alpha * deltaUnorm;
-      stepInfo.performanceAfterStep = performanceNew;
-      stepInfo.totalConstraintViolationAfterStep = newConstraintViolation;
-      return stepInfo;
-    } else {  // Try smaller step
-      alpha *= settings_.alpha_decay;
-
-      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
-      if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
-        if (settings_.printLinesearch) {
-          std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
-                    << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
-        }
-        break;
+    // Try smaller step
+    alpha *= settings_.alpha_decay;
+
+    // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
+    if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
+      if (settings_.printLinesearch) {
+        std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
+                  << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
       }
+      break;
     }
   } while (alpha >= settings_.alpha_min);
 
@@ -634,10 +771,22 @@ multiple_shooting::Convergence MultipleShootingSolver::checkConvergence(int iter
   } else if (stepInfo.dx_norm < settings_.deltaTol && stepInfo.du_norm < settings_.deltaTol) {
     // Converged because the change in primal variables is below the specified tolerance
     return Convergence::PRIMAL;
+  } else if (!isWithinTimeBudget(predictIterationDuration())) {
+    // Stopped because the next iteration is predicted to exceed the time budget
+    return Convergence::TIME;
   } else {
     // None of the above convergence criteria were met -> not converged.
     return Convergence::FALSE;
   }
 }
 
+scalar_t MultipleShootingSolver::predictIterationDuration() const {
+  // The slower of the average and the latest duration is used, such that a growing problem is anticipated.
+  auto predictDuration = [](const benchmark::RepeatedTimer& timer) {
+    return (timer.getNumTimedIntervals() > 0) ? std::max(timer.getAverageInMilliseconds(), timer.getLastIntervalInMilliseconds()) : 0.0;
+  };
+  return predictDuration(linearQuadraticApproximationTimer_) + predictDuration(solveQpTimer_) + predictDuration(linesearchTimer_) +
+         predictDuration(computeControllerTimer_);
+}
+
 }  // namespace ocs2
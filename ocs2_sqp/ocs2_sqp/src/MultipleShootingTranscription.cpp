@@ -40,17 +40,33 @@ namespace multiple_shooting {
 Transcription setupIntermediateNode(const OptimalControlProblem& optimalControlProblem,
                                     DynamicsSensitivityDiscretizer& sensitivityDiscretizer, bool projectStateInputEqualityConstraints,
                                     scalar_t t, scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u) {
-  // Results and short-hand notation
+  DynamicsSensitivityDiscretizerInPlace sensitivityDiscretizerInPlace =
+      [&](SystemDynamicsBase& system, scalar_t time, const vector_t& state, const vector_t& input, scalar_t timeStep,
+          SensitivityDiscretizationWorkspace&, VectorFunctionLinearApproximation& approximation) {
+        approximation = sensitivityDiscretizer(system, time, state, input, timeStep);
+      };
+
+  TranscriptionWorkspace workspace;
   Transcription transcription;
-  auto& dynamics = transcription.dynamics;
-  auto& performance = transcription.performance;
-  auto& cost = transcription.cost;
-  auto& constraints = transcription.constraints;
-  auto& projection = transcription.constraintsProjection;
+  transcription.performance = setupIntermediateNode(
+      optimalControlProblem, sensitivityDiscretizerInPlace, projectStateInputEqualityConstraints, t, dt, x, x_next, u, workspace,
+      transcription.dynamics, transcription.cost, transcription.constraints, transcription.constraintsProjection,
+      transcription.inequalityConstraints);
+  return transcription;
+}
+
+PerformanceIndex setupIntermediateNode(const OptimalControlProblem& optimalControlProblem,
+                                       DynamicsSensitivityDiscretizerInPlace& sensitivityDiscretizer,
+                                       bool projectStateInputEqualityConstraints, scalar_t t, scalar_t dt, const vector_t& x,
+                                       const vector_t& x_next, const vector_t& u, TranscriptionWorkspace& workspace,
+                                       VectorFunctionLinearApproximation& dynamics, ScalarFunctionQuadraticApproximation& cost,
+                                       VectorFunctionLinearApproximation& constraints, VectorFunctionLinearApproximation& projection,
+                                       VectorFunctionLinearApproximation& inequalityConstraints) {
+  PerformanceIndex performance;
 
   // Dynamics
   // Discretization returns x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
-  dynamics = sensitivityDiscretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt);
+  sensitivityDiscretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt, workspace.sensitivityDiscretization, dynamics);
   dynamics.f -= x_next;  // make it dx_{k+1} = ...
   performance.dynamicsViolationSSE = dt * dynamics.f.squaredNorm();
 
@@ -64,15 +80,19 @@ Transcription setupIntermediateNode(const OptimalControlProblem& optimalControlP
   performance.cost = cost.f;
 
   // Constraints
+  bool isProjected = false;
   if (!optimalControlProblem.equalityConstraintPtr->empty()) {
     // C_{k} * dx_{k} + D_{k} * du_{k} + e_{k} = 0
-    constraints = optimalControlProblem.equalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr);
-    if (constraints.f.size() > 0) {
-      performance.equalityConstraintsSSE = dt * constraints.f.squaredNorm();
+    // The projected constraints are only needed to compute the projection, therefore they are kept in the workspace.
+    auto& equalityConstraints = projectStateInputEqualityConstraints ? workspace.equalityConstraints : constraints;
+    equalityConstraints =
+        optimalControlProblem.equalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr);
+    if (equalityConstraints.f.size() > 0) {
+      performance.equalityConstraintsSSE = dt * equalityConstraints.f.squaredNorm();
       if (projectStateInputEqualityConstraints) {  // Handle equality constraints using projection.
         // Projection stored instead of constraint, // TODO: benchmark between lu and qr method. LU seems slightly faster.
-        projection = luConstraintProjection(constraints);
-        constraints = VectorFunctionLinearApproximation();
+        luConstraintProjection(equalityConstraints, workspace.constraintDecomposition, projection);
+        isProjected = true;
 
         // Adapt dynamics and cost
         changeOfInputVariables(dynamics, projection.dfdu, projection.dfdx, projection.f);
@@ -80,8 +100,30 @@ Transcription setupIntermediateNode(const OptimalControlProblem& optimalControlP
       }
     }
   }
+  // Empty approximations keep the shape used by the solver. They only release memory if the node's structure changes.
+  if (optimalControlProblem.equalityConstraintPtr->empty() || projectStateInputEqualityConstraints) {
+    constraints.setZero(0, x.size(), u.size());
+  }
+  if (!isProjected) {
+    projection.setZero(0, x.size(), 0);
+  }
+
+  // Inequality constraints
+  if (!optimalControlProblem.inequalityConstraintPtr->empty()) {
+    // H_{k} * dx_{k} + G_{k} * du_{k} + h_{k} >= 0
+    inequalityConstraints =
+        optimalControlProblem.inequalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr);
+    if (inequalityConstraints.f.size() > 0) {
+      performance.inequalityConstraintsSSE = dt * inequalityConstraints.f.cwiseMin(0.0).squaredNorm();
+      if (isProjected) {  // Express in the projected inputs
+        changeOfInputVariables(inequalityConstraints, projection.dfdu, projection.dfdx, projection.f);
+      }
+    }
+  } else {
+    inequalityConstraints.setZero(0, x.size(), u.size());
+  }
 
-  return transcription;
+  return performance;
 }
 
 PerformanceIndex computeIntermediatePerformance(const OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer,
@@ -108,25 +150,37 @@ PerformanceIndex computeIntermediatePerformance(const OptimalControlProblem& opt
     }
   }
 
+  // Inequality constraints
+  if (!optimalControlProblem.inequalityConstraintPtr->empty()) {
+    const vector_t inequalityConstraints =
+        optimalControlProblem.inequalityConstraintPtr->getValue(t, x, u, *optimalControlProblem.preComputationPtr);
+    if (inequalityConstraints.size() > 0) {
+      performance.inequalityConstraintsSSE = dt * inequalityConstraints.cwiseMin(0.0).squaredNorm();
+    }
+  }
+
   return performance;
 }
 
 TerminalTranscription setupTerminalNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x) {
-  // Results and short-hand notation
   TerminalTranscription transcription;
-  auto& performance = transcription.performance;
-  auto& cost = transcription.cost;
-  auto& constraints = transcription.constraints;
+  transcription.performance = setupTerminalNode(optimalControlProblem, t, x, transcription.cost, transcription.constraints);
+  return transcription;
+}
+
+PerformanceIndex setupTerminalNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x,
+                                   ScalarFunctionQuadraticApproximation& cost, VectorFunctionLinearApproximation& constraints) {
+  PerformanceIndex performance;
 
   constexpr auto request = Request::Cost + Request::SoftConstraint + Request::Approximation;
   optimalControlProblem.preComputationPtr->requestFinal(request, t, x);
 
-  cost = approximateFinalCost(optimalControlProblem, t, x);
+  approximateFinalCost(optimalControlProblem, t, x, cost);
   performance.cost = cost.f;
 
-  constraints = VectorFunctionLinearApproximation::Zero(0, x.size(), 0);
+  constraints.setZero(0, x.size(), 0);
 
-  return transcription;
+  return performance;
 }
 
 PerformanceIndex computeTerminalPerformance(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x) {
@@ -142,28 +196,34 @@ PerformanceIndex computeTerminalPerformance(const OptimalControlProblem& optimal
 
 EventTranscription setupEventNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x,
                                   const vector_t& x_next) {
-  // Results and short-hand notation
   EventTranscription transcription;
-  auto& performance = transcription.performance;
-  auto& dynamics = transcription.dynamics;
-  auto& cost = transcription.cost;
-  auto& constraints = transcription.constraints;
+  transcription.performance =
+      setupEventNode(optimalControlProblem, t, x, x_next, transcription.dynamics, transcription.cost, transcription.constraints);
+  return transcription;
+}
+
+PerformanceIndex setupEventNode(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next,
+                                VectorFunctionLinearApproximation& dynamics, ScalarFunctionQuadraticApproximation& cost,
+                                VectorFunctionLinearApproximation& constraints) {
+  PerformanceIndex performance;
 
   constexpr auto request = Request::Cost + Request::SoftConstraint + Request::Dynamics + Request::Approximation;
   optimalControlProblem.preComputationPtr->requestPreJump(request, t, x);
 
   // Dynamics
   // jump map returns // x_{k+1} = A_{k} * dx_{k} + b_{k}
-  dynamics = optimalControlProblem.dynamicsPtr->jumpMapLinearApproximation(t, x);
-  dynamics.f -= x_next;                // make it dx_{k+1} = ...
+  // The jump map is only linearized by value, it is copied such that the memory of the given approximation is kept.
+  const auto jumpMap = optimalControlProblem.dynamicsPtr->jumpMapLinearApproximation(t, x);
+  dynamics.dfdx = jumpMap.dfdx;
+  dynamics.f = jumpMap.f - x_next;     // make it dx_{k+1} = ...
   dynamics.dfdu.setZero(x.size(), 0);  // Overwrite derivative that shouldn't exist.
   performance.dynamicsViolationSSE = dynamics.f.squaredNorm();
 
-  cost = approximateEventCost(optimalControlProblem, t, x);
+  approximateEventCost(optimalControlProblem, t, x, cost);
   performance.cost = cost.f;
 
-  constraints = VectorFunctionLinearApproximation::Zero(0, x.size(), 0);
-  return transcription;
+  constraints.setZero(0, x.size(), 0);
+  return performance;
 }
 
 PerformanceIndex computeEventPerformance(const OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x,
@@ -141,3 +141,42 @@ TEST(test_circular_kinematics, solve_EqConstraints_inQPSubproblem) {
     ASSERT_TRUE(u.isApprox(primalSolution.controllerPtr_->computeInput(t, x)));
   }
 }
+
+TEST(test_circular_kinematics, linesearchBatch) {
+  // optimal control problem
+  ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/sqp_test_generated");
+
+  // Initializer
+  ocs2::DefaultInitializer zeroInitializer(2);
+
+  // Additional problem definitions
+  const ocs2::scalar_t startTime = 0.0;
+  const ocs2::scalar_t finalTime = 1.0;
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  // Solve with sequential and batched linesearch, with different number of threads.
+  auto solve = [&](size_t linesearchBatchSize, size_t nThreads) {
+    ocs2::multiple_shooting::Settings settings;
+    settings.dt = 0.01;
+    settings.sqpIteration = 20;
+    settings.linesearchBatchSize = linesearchBatchSize;
+    settings.nThreads = nThreads;
+    ocs2::MultipleShootingSolver solver(settings, problem, zeroInitializer);
+    solver.run(startTime, initState, finalTime);
+    return std::make_pair(solver.primalSolution(finalTime), solver.getIterationsLog());
+  };
+  const auto reference = solve(1, 1);
+
+  // The acceptance rules are the same and the performance is summed in node order: the results are identical
+  for (const auto& batchAndThreads : {std::make_pair(1, 3), std::make_pair(4, 1), std::make_pair(4, 3)}) {
+    const auto result = solve(batchAndThreads.first, batchAndThreads.second);
+    ASSERT_EQ(reference.second.size(), result.second.size());
+    for (int i = 0; i < reference.second.size(); i++) {
+      ASSERT_EQ(reference.second[i].merit, result.second[i].merit);
+    }
+    for (int i = 0; i < reference.first.timeTrajectory_.size(); i++) {
+      ASSERT_TRUE(reference.first.stateTrajectory_[i] == result.first.stateTrajectory_[i]);
+      ASSERT_TRUE(reference.first.inputTrajectory_[i] == result.first.inputTrajectory_[i]);
+    }
+  }
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "ocs2_sqp/MultipleShootingSolver.h"
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+
+#include <ocs2_oc/test/circular_kinematics.h>
+
+namespace {
+
+/** Cost term without contribution that slows down every evaluation */
+class SlowZeroCost final : public ocs2::StateInputCost {
+ public:
+  SlowZeroCost* clone() const override { return new SlowZeroCost(*this); }
+
+  ocs2::scalar_t getValue(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input,
+                          const ocs2::TargetTrajectories& targetTrajectories, const ocs2::PreComputation& preComp) const override {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+    return 0.0;
+  }
+
+  ocs2::ScalarFunctionQuadraticApproximation getQuadraticApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                       const ocs2::vector_t& input,
+                                                                       const ocs2::TargetTrajectories& targetTrajectories,
+                                                                       const ocs2::PreComputation& preComp) const override {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+    return ocs2::ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+  }
+};
+
+ocs2::multiple_shooting::Settings getSettings() {
+  ocs2::multiple_shooting::Settings settings;
+  settings.dt = 0.01;
+  settings.sqpIteration = 20;
+  settings.projectStateInputEqualityConstraints = true;
+  settings.useFeedbackPolicy = true;
+  settings.printSolverStatistics = false;
+  settings.printSolverStatus = false;
+  settings.printLinesearch = false;
+  settings.nThreads = 1;
+  return settings;
+}
+
+}  // namespace
+
+TEST(test_time_budget, iterationsWithinBudget) {
+  // optimal control problem
+  ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/sqp_test_generated");
+  ocs2::DefaultInitializer zeroInitializer(2);
+  const auto settings = getSettings();
+
+  const ocs2::scalar_t startTime = 0.0;
+  const ocs2::scalar_t finalTime = 1.0;
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  // run without time budget
+  ocs2::MultipleShootingSolver solverReference(settings, problem, zeroInitializer);
+  solverReference.run(startTime, initState, finalTime);
+  const auto numReferenceIterations = solverReference.getIterationsLog().size();
+  ASSERT_GT(numReferenceIterations, 3);
+
+  // a budget which is far larger than the solve time does not cut any iteration
+  ocs2::MultipleShootingSolver solverLargeBudget(settings, problem, zeroInitializer);
+  solverLargeBudget.setTimeBudget(1000.0);
+  solverLargeBudget.run(startTime, initState, finalTime);
+  EXPECT_EQ(solverLargeBudget.getIterationsLog().size(), numReferenceIterations);
+  EXPECT_FALSE(solverLargeBudget.isTimeBudgetMissed());
+
+  // a budget which is shorter than one iteration stops after the first iteration (Convergence::TIME), and still returns a full solution
+  ocs2::MultipleShootingSolver solverSmallBudget(settings, problem, zeroInitializer);
+  solverSmallBudget.setTimeBudget(1e-9);
+  solverSmallBudget.run(startTime, initState, finalTime);
+  EXPECT_EQ(solverSmallBudget.getIterationsLog().size(), 1);
+  EXPECT_TRUE(solverSmallBudget.isTimeBudgetMissed());
+  EXPECT_EQ(solverSmallBudget.getNumTimeBudgetMisses(), 1);
+  EXPECT_DOUBLE_EQ(solverSmallBudget.primalSolution(finalTime).timeTrajectory_.back(), finalTime);
+}
+
+TEST(test_time_budget, boundedLatencyWithSlowCost) {
+  // optimal control problem with a slowed down cost function, such that the solve time is dominated by the cost evaluations
+  ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/sqp_test_generated");
+  problem.costPtr->add("slowZeroCost", std::unique_ptr<ocs2::StateInputCost>(new SlowZeroCost));
+  ocs2::DefaultInitializer zeroInitializer(2);
+  const auto settings = getSettings();
+
+  const ocs2::scalar_t startTime = 0.0;
+  const ocs2::scalar_t finalTime = 1.0;
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  auto timedRun = [&](ocs2::MultipleShootingSolver& solver) {
+    const auto runStartTime = std::chrono::steady_clock::now();
+    solver.run(startTime, initState, finalTime);
+    return std::chrono::duration<ocs2::scalar_t>(std::chrono::steady_clock::now() - runStartTime).count();
+  };
+
+  // run without time budget
+  ocs2::MultipleShootingSolver solverReference(settings, problem, zeroInitializer);
+  const auto referenceDuration = timedRun(solverReference);
+  ASSERT_GT(solverReference.getIterationsLog().size(), 3);
+
+  // a budget of half the solve time cuts the iterations and bounds the latency
+  const ocs2::scalar_t timeBudget = 0.5 * referenceDuration;
+  ocs2::MultipleShootingSolver solver(settings, problem, zeroInitializer);
+  solver.setTimeBudget(timeBudget);
+  const auto duration = timedRun(solver);
+  EXPECT_LT(solver.getIterationsLog().size(), solverReference.getIterationsLog().size());
+  // generous bound, which leaves room for the jitter of the sleeps and of the scheduler
+  EXPECT_LT(duration, 1.5 * timeBudget);
+  EXPECT_DOUBLE_EQ(solver.primalSolution(finalTime).timeTrajectory_.back(), finalTime);
+}
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/MultipleShootingTranscription.h"
 
+#include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
 #include <ocs2_oc/test/circular_kinematics.h>
 #include <ocs2_oc/test/testProblemsGeneration.h>
 
@@ -38,8 +39,8 @@ namespace {
 /** Helper to compare if two performance indices are identical */
 bool areIdentical(const ocs2::PerformanceIndex& lhs, const ocs2::PerformanceIndex& rhs) {
   return lhs.merit == rhs.merit && lhs.cost == rhs.cost && lhs.dynamicsViolationSSE == rhs.dynamicsViolationSSE &&
-         lhs.equalityConstraintsSSE == rhs.equalityConstraintsSSE && lhs.equalityLagrangian == rhs.equalityLagrangian &&
-         lhs.inequalityLagrangian == rhs.inequalityLagrangian;
+         lhs.equalityConstraintsSSE == rhs.equalityConstraintsSSE && lhs.inequalityConstraintsSSE == rhs.inequalityConstraintsSSE &&
+         lhs.equalityLagrangian == rhs.equalityLagrangian && lhs.inequalityLagrangian == rhs.inequalityLagrangian;
 }
 }  // namespace
 
@@ -49,6 +50,7 @@ using namespace ocs2::multiple_shooting;
 TEST(test_transcription, intermediate_performance) {
   // optimal control problem
   OptimalControlProblem problem = createCircularKinematicsProblem("/tmp/sqp_test_generated");
+  problem.inequalityConstraintPtr->add("inequalityConstraint", getOcs2Constraints(getRandomConstraints(2, 2, 3)));
 
   auto discretizer = selectDynamicsDiscretization(SensitivityIntegratorType::RK4);
   auto sensitivityDiscretizer = selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
@@ -65,6 +67,69 @@ TEST(test_transcription, intermediate_performance) {
   ASSERT_TRUE(areIdentical(performance, transcription.performance));
 }
 
+TEST(test_transcription, intermediate_inPlace) {
+  // optimal control problem
+  OptimalControlProblem problem = createCircularKinematicsProblem("/tmp/sqp_test_generated");
+  problem.inequalityConstraintPtr->add("inequalityConstraint", getOcs2Constraints(getRandomConstraints(2, 2, 3)));
+
+  auto sensitivityDiscretizer = selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+  auto sensitivityDiscretizerInPlace = selectDynamicsSensitivityDiscretizationInPlace(SensitivityIntegratorType::RK4);
+
+  scalar_t t = 0.5;
+  scalar_t dt = 0.1;
+  const vector_t x_next = (vector_t(2) << 1.1, 0.2).finished();
+  const vector_t u = (vector_t(2) << 0.1, 1.3).finished();
+
+  // Outputs are reused across evaluations, alternating with and without projection
+  TranscriptionWorkspace workspace;
+  VectorFunctionLinearApproximation dynamics, constraints, projection, inequalityConstraints;
+  ScalarFunctionQuadraticApproximation cost;
+  for (bool projectConstraints : {true, false, true}) {
+    const vector_t x = vector_t::Random(2);
+    setupIntermediateNode(problem, sensitivityDiscretizerInPlace, projectConstraints, t, dt, x, x_next, u, workspace, dynamics, cost,
+                          constraints, projection, inequalityConstraints);
+
+    // Reference: the unprojected approximations and the LU projection formulas of the by-value implementation
+    auto dynamicsCheck = sensitivityDiscretizer(*problem.dynamicsPtr, t, x, u, dt);
+    dynamicsCheck.f -= x_next;
+    problem.preComputationPtr->request(Request::Cost + Request::Constraint + Request::Approximation, t, x, u);
+    auto costCheck = approximateCost(problem, t, x, u);
+    costCheck *= dt;
+    const auto constraintsCheck = problem.equalityConstraintPtr->getLinearApproximation(t, x, u, *problem.preComputationPtr);
+    auto inequalityConstraintsCheck = problem.inequalityConstraintPtr->getLinearApproximation(t, x, u, *problem.preComputationPtr);
+
+    if (projectConstraints) {
+      const Eigen::FullPivLU<matrix_t> lu(constraintsCheck.dfdu);
+      const matrix_t Pu = lu.kernel();
+      const matrix_t Px = -lu.solve(constraintsCheck.dfdx);
+      const vector_t Pe = -lu.solve(constraintsCheck.f);
+      ASSERT_TRUE(projection.dfdu.isApprox(Pu));
+      ASSERT_TRUE(projection.dfdx.isApprox(Px));
+      ASSERT_TRUE(projection.f.isApprox(Pe));
+      ASSERT_EQ(constraints.f.size(), 0);
+
+      // A + B * Px, b + B * Pe, B * Pu
+      ASSERT_TRUE(dynamics.dfdx.isApprox(dynamicsCheck.dfdx + dynamicsCheck.dfdu * Px));
+      ASSERT_TRUE(dynamics.f.isApprox(dynamicsCheck.f + dynamicsCheck.dfdu * Pe));
+      ASSERT_TRUE(dynamics.dfdu.isApprox(dynamicsCheck.dfdu * Pu));
+      // R_projected = Pu' * R * Pu, H_projected = H + G * Px
+      ASSERT_TRUE(cost.dfduu.isApprox(Pu.transpose() * costCheck.dfduu * Pu));
+      ASSERT_TRUE(inequalityConstraints.dfdx.isApprox(inequalityConstraintsCheck.dfdx + inequalityConstraintsCheck.dfdu * Px));
+      ASSERT_TRUE(inequalityConstraints.dfdu.isApprox(inequalityConstraintsCheck.dfdu * Pu));
+    } else {
+      ASSERT_EQ(projection.f.size(), 0);
+      ASSERT_TRUE(constraints.f.isApprox(constraintsCheck.f));
+      ASSERT_TRUE(constraints.dfdx.isApprox(constraintsCheck.dfdx));
+      ASSERT_TRUE(constraints.dfdu.isApprox(constraintsCheck.dfdu));
+      ASSERT_TRUE(dynamics.f.isApprox(dynamicsCheck.f));
+      ASSERT_TRUE(dynamics.dfdx.isApprox(dynamicsCheck.dfdx));
+      ASSERT_TRUE(dynamics.dfdu.isApprox(dynamicsCheck.dfdu));
+      ASSERT_TRUE(cost.dfduu.isApprox(costCheck.dfduu));
+      ASSERT_TRUE(inequalityConstraints.dfdu.isApprox(inequalityConstraintsCheck.dfdu));
+    }
+  }
+}
+
 TEST(test_transcription, terminal_performance) {
   int nx = 3;
 
@@ -109,3 +174,70 @@ TEST(test_transcription, event_performance) {
 
   ASSERT_TRUE(areIdentical(performance, transcription.performance));
 }
+
+TEST(test_transcription, terminal_inPlace) {
+  int nx = 3;
+
+  OptimalControlProblem problem;
+
+  // cost
+  problem.finalCostPtr->add("finalCost", getOcs2StateCost(getRandomCost(nx, 0)));
+  problem.finalSoftConstraintPtr->add("finalSoftCost", getOcs2StateCost(getRandomCost(nx, 0)));
+
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(nx)}, {vector_t::Random(0)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+
+  // Outputs are reused across evaluations
+  const scalar_t t = 0.5;
+  ScalarFunctionQuadraticApproximation cost;
+  VectorFunctionLinearApproximation constraints;
+  for (int i = 0; i < 3; ++i) {
+    const vector_t x = vector_t::Random(nx);
+    const auto performance = setupTerminalNode(problem, t, x, cost, constraints);
+
+    const auto costCheck = approximateFinalCost(problem, t, x);
+    ASSERT_TRUE(areIdentical(performance, computeTerminalPerformance(problem, t, x)));
+    ASSERT_DOUBLE_EQ(cost.f, costCheck.f);
+    ASSERT_TRUE(cost.dfdx.isApprox(costCheck.dfdx));
+    ASSERT_TRUE(cost.dfdxx.isApprox(costCheck.dfdxx));
+    ASSERT_EQ(constraints.f.size(), 0);
+    ASSERT_EQ(constraints.dfdx.cols(), nx);
+  }
+}
+
+TEST(test_transcription, event_inPlace) {
+  int nx = 2;
+
+  OptimalControlProblem problem;
+
+  // dynamics
+  const auto dynamics = getRandomDynamics(nx, 0);
+  const matrix_t jumpMap = matrix_t::Random(nx, nx);
+  problem.dynamicsPtr.reset(new LinearSystemDynamics(dynamics.dfdx, dynamics.dfdu, jumpMap));
+
+  // cost
+  problem.preJumpCostPtr->add("eventCost", getOcs2StateCost(getRandomCost(nx, 0)));
+
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(nx)}, {vector_t::Random(0)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+
+  // Outputs are reused across evaluations
+  const scalar_t t = 0.5;
+  VectorFunctionLinearApproximation jumpMapApproximation, constraints;
+  ScalarFunctionQuadraticApproximation cost;
+  for (int i = 0; i < 3; ++i) {
+    const vector_t x = vector_t::Random(nx);
+    const vector_t x_next = vector_t::Random(nx);
+    const auto performance = setupEventNode(problem, t, x, x_next, jumpMapApproximation, cost, constraints);
+
+    const auto costCheck = approximateEventCost(problem, t, x);
+    ASSERT_TRUE(areIdentical(performance, computeEventPerformance(problem, t, x, x_next)));
+    ASSERT_TRUE(jumpMapApproximation.dfdx.isApprox(jumpMap));
+    ASSERT_TRUE(jumpMapApproximation.f.isApprox(jumpMap * x - x_next));
+    ASSERT_EQ(jumpMapApproximation.dfdu.cols(), 0);
+    ASSERT_DOUBLE_EQ(cost.f, costCheck.f);
+    ASSERT_TRUE(cost.dfdx.isApprox(costCheck.dfdx));
+    ASSERT_TRUE(cost.dfdxx.isApprox(costCheck.dfdxx));
+    ASSERT_EQ(constraints.f.size(), 0);
+  }
+}
@@ -160,3 +160,48 @@ TEST(test_unconstrained, noFeedback) {
         withEmptyConstraint.controllerPtr_->computeInput(t, x).isApprox(withNullConstraint.controllerPtr_->computeInput(t, x), tol));
   }
 }
+
+TEST(test_unconstrained, realTimeIteration) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+
+  ocs2::OptimalControlProblem problem;
+  problem.dynamicsPtr = ocs2::getOcs2Dynamics(dynamics);
+  problem.costPtr->add("intermediateCost", ocs2::getOcs2Cost(costs));
+  problem.finalCostPtr->add("finalCost", ocs2::getOcs2StateCost(costs));
+  ocs2::TargetTrajectories targetTrajectories({0.0}, {ocs2::vector_t::Ones(n)}, {ocs2::vector_t::Ones(m)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+  ocs2::DefaultInitializer zeroInitializer(m);
+
+  ocs2::multiple_shooting::Settings settings;
+  settings.dt = 0.05;
+  settings.nThreads = 2;
+  ocs2::MultipleShootingSolver sqpSolver(settings, problem, zeroInitializer);
+  sqpSolver.setReferenceManager(std::make_shared<ocs2::ReferenceManager>(targetTrajectories));
+  settings.realTimeIteration = true;
+  ocs2::MultipleShootingSolver rtiSolver(settings, problem, zeroInitializer);
+  rtiSolver.setReferenceManager(std::make_shared<ocs2::ReferenceManager>(targetTrajectories));
+
+  // The QP is exact for a linear quadratic problem, a single real-time iteration gives the SQP solution, prepared or not.
+  const ocs2::scalar_t horizon = 1.0;
+  for (ocs2::scalar_t initTime : {0.0, 0.1, 0.15}) {
+    const ocs2::vector_t initState = ocs2::vector_t::Random(n);
+    sqpSolver.run(initTime, initState, initTime + horizon);
+    rtiSolver.run(initTime, initState, initTime + horizon);
+    ASSERT_EQ(rtiSolver.getIterationsLog().size(), 1);
+
+    const auto sqpSolution = sqpSolver.primalSolution(initTime + horizon);
+    const auto rtiSolution = rtiSolver.primalSolution(initTime + horizon);
+    ASSERT_EQ(sqpSolution.timeTrajectory_.size(), rtiSolution.timeTrajectory_.size());
+    for (int i = 0; i < sqpSolution.timeTrajectory_.size(); i++) {
+      ASSERT_TRUE(sqpSolution.stateTrajectory_[i].isApprox(rtiSolution.stateTrajectory_[i], tol));
+      ASSERT_TRUE(sqpSolution.inputTrajectory_[i].isApprox(rtiSolution.inputTrajectory_[i], tol));
+    }
+
+    // Preparation for the next run, which only uses the new initial state.
+    rtiSolver.prepare(initTime + 0.1, initTime + 0.1 + horizon);
+  }
+}